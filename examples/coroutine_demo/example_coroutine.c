@@ -202,10 +202,10 @@ void consumer_task(void *user_data)
     SAFETIMER_CORO_END();
 }
 
-/* Producer (called from interrupt or another coroutine) */
+/* Producer (interrupt; another coroutine uses SAFETIMER_SEM_SIGNAL) */
 void data_ready_isr(void)
 {
-    SAFETIMER_SEM_SIGNAL(data_ready_sem);
+    SAFETIMER_SEM_SIGNAL_FROM_ISR(data_ready_sem);
 }
 
 /**
@@ -215,7 +215,7 @@ void data_ready_isr(void)
 void uart_rx_isr_auth_mock(void)
 {
     /* In production: Copy received data to g_uart_buffer here */
-    SAFETIMER_SEM_SIGNAL(auth_rx_sem);
+    SAFETIMER_SEM_SIGNAL_FROM_ISR(auth_rx_sem);
 }
 
 /* ========== Example 4: Authentication Handshake ========== */
@@ -13,14 +13,15 @@
 /* ========== Type Definitions ========== */
 
 /**
- * @brief BSP tick type (milliseconds)
+ * @brief BSP tick type (ticks of SAFETIMER_TICK_US, default milliseconds)
  *
  * Width depends on BSP_TICK_TYPE_16BIT configuration:
  * - BSP_TICK_TYPE_16BIT=0: uint32_t (default) - supports up to 49.7 days
  * - BSP_TICK_TYPE_16BIT=1: uint16_t - supports up to 65.5 seconds, saves 8
  * bytes RAM
  *
- * @note MUST represent milliseconds since power-on/reset
+ * @note MUST count ticks of SAFETIMER_TICK_US microseconds (default 1000:
+ *       milliseconds) since power-on/reset
  * @note Automatically wraps around at max value (SafeTimer handles this)
  *
  * @warning With 16-bit ticks: max timer period is 65535ms (65.5 seconds)
@@ -61,13 +62,39 @@ typedef uint32_t bsp_tick_t; /* 32-bit: 0 ~ 4294967295 ms (49.7 days max) */
 void safetimer_tick_isr(void);
 #endif
 
+/**
+ * @brief Credit ticks slept with the tick interrupt stopped (optional)
+ *
+ * Tickless counterpart of safetimer_tick_isr() for the default BSP: adds
+ * all slept ticks in one step, so the next safetimer_process() handles
+ * the whole jump in one pass.
+ *
+ * @param ticks Ticks elapsed since the tick interrupt was stopped
+ *
+ * @note Only available when SAFETIMER_BSP_IMPLEMENTATION > 0 and
+ *       SAFETIMER_BSP_TICKLESS=1
+ * @note Call with interrupts disabled (read-modify-write of the counter)
+ *
+ * @par Example Usage:
+ * @code
+ * void RTC_Compare_ISR(void) {
+ *     RTC_CLEAR_FLAG();
+ *     safetimer_tick_advance(rtc_elapsed_ticks());
+ * }
+ * @endcode
+ */
+#if (SAFETIMER_BSP_IMPLEMENTATION > 0) && SAFETIMER_BSP_TICKLESS
+void safetimer_tick_advance(bsp_tick_t ticks);
+#endif
+
 /**
  * @brief Get current system tick in milliseconds
  *
  * @return Current tick count (milliseconds since power-on)
  *
  * @note MUST return monotonically increasing value
- * @note MUST have ≤1ms resolution for timer accuracy
+ * @note MUST advance once per SAFETIMER_TICK_US (default 1 ms); a
+ *       prescaled free-running hardware counter needs no tick ISR
  * @note Wraps around at 2^32-1 (~49.7 days) - this is NORMAL
  * @note SafeTimer automatically handles wraparound (ADR-005)
  *
@@ -133,6 +160,89 @@ void bsp_enter_critical(void);
  */
 void bsp_exit_critical(void);
 
+/**
+ * @brief Get a free-running cycle counter (optional)
+ *
+ * Timebase for SafeTimer statistics (callback, pass and critical section
+ * durations). Only required with SAFETIMER_STATS_CYCLES=1.
+ *
+ * @return Counter value, any unit, wraps at 2^32
+ *
+ * @warning MUST be callable inside a critical section (no masking)
+ *
+ * @par Example Implementation (Cortex-M3+):
+ * @code
+ * uint32_t bsp_get_cycles(void)
+ * {
+ *     return DWT->CYCCNT;
+ * }
+ * @endcode
+ */
+#if SAFETIMER_STATS_CYCLES
+uint32_t bsp_get_cycles(void);
+#endif
+
+/**
+ * @brief Program the wakeup compare register (tickless mode only)
+ *
+ * Called by safetimer_tickless_arm() with the ticks until the earliest
+ * SafeTimer deadline. The BSP stops the periodic tick, sets a one-shot
+ * compare match that many ticks ahead and, on wakeup, credits the ticks
+ * actually slept (safetimer_tick_advance() with the default BSP).
+ *
+ * @param ticks Ticks from now (>= 1), or SAFETIMER_NO_EXPIRY (0xFFFFFFFF)
+ *              when no timer is running (sleep until an external event)
+ *
+ * @note Only required with SAFETIMER_BSP_TICKLESS=1
+ * @note Clamp to the hardware counter range: waking early is harmless,
+ *       safetimer_tickless_arm() simply programs the remainder
+ *
+ * @par Example Implementation (RTC compare):
+ * @code
+ * void bsp_set_wakeup(uint32_t ticks)
+ * {
+ *     if (ticks > RTC_MAX_TICKS) {
+ *         ticks = RTC_MAX_TICKS;
+ *     }
+ *     RTC->CMP = RTC->CNT + ticks;
+ * }
+ * @endcode
+ */
+#if SAFETIMER_BSP_TICKLESS
+void bsp_set_wakeup(uint32_t ticks);
+#endif
+
+/**
+ * @brief Program the one-shot compare for the nearest deadline (optional)
+ *
+ * SafeTimer keeps the earliest running deadline programmed here; the
+ * compare-match interrupt then runs the pass (safetimer_process(), or
+ * safetimer_isr_detect() with SAFETIMER_ENABLE_ISR_DISPATCH) at that tick.
+ * Each call replaces the previous deadline.
+ *
+ * @param deadline Absolute tick (same counter as bsp_get_ticks())
+ *
+ * @note Only required with SAFETIMER_ENABLE_HW_COMPARE=1
+ * @note Called inside the SafeTimer critical section: register writes
+ *       only, no SafeTimer calls
+ * @note MUST fire at once (set the interrupt pending) when the deadline
+ *       is not in the future
+ *
+ * @par Example Implementation (free-running TIM2 at SAFETIMER_TICK_US):
+ * @code
+ * void bsp_set_compare(bsp_tick_t deadline)
+ * {
+ *     TIM2->CCR1 = deadline;
+ *     if ((int32_t)(deadline - TIM2->CNT) <= 0) {
+ *         TIM2->EGR = TIM_EGR_CC1G;  // Already due: fire now
+ *     }
+ * }
+ * @endcode
+ */
+#if SAFETIMER_ENABLE_HW_COMPARE
+void bsp_set_compare(bsp_tick_t deadline);
+#endif
+
 /* ========== BSP Requirements Summary ========== */
 
 /**
@@ -0,0 +1,90 @@
+/**
+ * @file    bsp_rtos.h
+ * @brief   RTOS BSP Adapter for SafeTimer (FreeRTOS / Zephyr)
+ * @version 1.0.0
+ * @date    2026-10-14
+ *
+ * Implements the bsp.h interface on an RTOS kernel and runs
+ * safetimer_process() in a daemon task that sleeps until the earliest
+ * deadline instead of polling every tick.
+ *
+ * @note Only compiled when SAFETIMER_BSP_RTOS != SAFETIMER_BSP_RTOS_NONE
+ * @note src/bsp_rtos.c provides bsp_get_ticks(), bsp_enter_critical(),
+ *       bsp_exit_critical() and bsp_set_compare(): do not implement them
+ *       in the application (bsp_get_cycles() is still user-provided with
+ *       SAFETIMER_STATS_CYCLES=1)
+ */
+
+#ifndef BSP_RTOS_H
+#define BSP_RTOS_H
+
+#include "bsp.h"
+
+#if (SAFETIMER_BSP_RTOS != SAFETIMER_BSP_RTOS_NONE)
+
+/**
+ * @brief SafeTimer daemon task entry (never returns)
+ *
+ * Loop: safetimer_process(), then block on the wake signal for
+ * safetimer_get_next_expiry() ticks (forever when no timer runs).
+ * All callbacks of the default pool run in this task.
+ *
+ * The daemon is woken early when another task moves the earliest
+ * deadline forward (safetimer_start(), safetimer_trigger(),
+ * safetimer_set_period(), ...); calls from the daemon's own callbacks
+ * need no wake, the next timeout is recomputed after each pass.
+ *
+ * @note FreeRTOS: requires INCLUDE_xTaskGetCurrentTaskHandle=1 and
+ *       configTICK_RATE_HZ = 1000000 / SAFETIMER_TICK_US
+ * @note Zephyr: requires CONFIG_SYS_CLOCK_TICKS_PER_SEC =
+ *       1000000 / SAFETIMER_TICK_US
+ *
+ * @par Example Usage (FreeRTOS):
+ * @code
+ * xTaskCreate(safetimer_rtos_daemon, "stimer", 256, NULL,
+ *             tskIDLE_PRIORITY + 2, NULL);
+ * vTaskStartScheduler();
+ * @endcode
+ *
+ * @par Example Usage (Zephyr):
+ * @code
+ * K_THREAD_DEFINE(stimer_tid, 1024, safetimer_rtos_daemon, NULL, NULL,
+ *                 NULL, 5, 0, 0);
+ * @endcode
+ */
+#if (SAFETIMER_BSP_RTOS == SAFETIMER_BSP_RTOS_FREERTOS)
+void safetimer_rtos_daemon(void *arg);
+#else
+void safetimer_rtos_daemon(void *p1, void *p2, void *p3);
+#endif
+
+/**
+ * @brief Wake the daemon from interrupt context
+ *
+ * SafeTimer calls from ISRs go through the *_from_isr() queue
+ * (SAFETIMER_ENABLE_ISR_QUEUE), which is applied by the next pass; call
+ * this after queueing so the daemon runs that pass now.
+ *
+ * @note Rule: ISRs never call the task-context APIs. On FreeRTOS their
+ *       taskENTER_CRITICAL() and xTaskNotifyGive() are not ISR-safe (the
+ *       Cortex-M port asserts in vPortEnterCritical()). Semaphores are
+ *       signaled with SAFETIMER_SEM_SIGNAL_FROM_ISR(), then this call
+ * @note FreeRTOS with SAFETIMER_ENABLE_SEM_WAKE: the adapter still switches
+ *       to taskENTER_CRITICAL_FROM_ISR() and vTaskNotifyGiveFromISR()
+ *       when SAFETIMER_SEM_SIGNAL() is reached from an ISR, which needs a
+ *       port with xPortIsInsideInterrupt() (Cortex-M, FreeRTOS >= 10.2)
+ *
+ * @par Example Usage:
+ * @code
+ * void USART1_IRQHandler(void) {
+ *     safetimer_start_from_isr(g_rx_idle_timer);
+ *     SAFETIMER_SEM_SIGNAL_FROM_ISR(g_rx_sem);
+ *     safetimer_rtos_notify_from_isr();
+ * }
+ * @endcode
+ */
+void safetimer_rtos_notify_from_isr(void);
+
+#endif /* SAFETIMER_BSP_RTOS != SAFETIMER_BSP_RTOS_NONE */
+
+#endif /* BSP_RTOS_H */
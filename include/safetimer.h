@@ -54,6 +54,65 @@ typedef int safetimer_handle_t;
  */
 #define SAFETIMER_INVALID_HANDLE (-1)
 
+/**
+ * @brief safetimer_get_next_expiry() result when no timer is active
+ */
+#define SAFETIMER_NO_EXPIRY 0xFFFFFFFFUL
+
+/**
+ * @brief Longest accepted period, in ticks (ENABLE_PARAM_CHECK)
+ */
+#if SAFETIMER_COMPACT_SLOTS
+#define SAFETIMER_MAX_PERIOD (255UL * SAFETIMER_COMPACT_PERIOD_UNIT)
+#elif BSP_TICK_TYPE_16BIT
+#define SAFETIMER_MAX_PERIOD 65535UL
+#else
+#define SAFETIMER_MAX_PERIOD 0x7FFFFFFFUL
+#endif
+
+/**
+ * @brief Nonzero if safetimer_create() accepts period @p p (ticks)
+ *
+ * 1 ~ SAFETIMER_MAX_PERIOD; with SAFETIMER_COMPACT_SLOTS also a whole
+ * number of SAFETIMER_COMPACT_PERIOD_UNIT ticks.
+ */
+#if SAFETIMER_COMPACT_SLOTS
+#define SAFETIMER_PERIOD_FITS(p)                                               \
+  ((p) >= 1UL && (p) <= SAFETIMER_MAX_PERIOD &&                                \
+   ((p) % SAFETIMER_COMPACT_PERIOD_UNIT) == 0)
+#else
+#define SAFETIMER_PERIOD_FITS(p) ((p) >= 1UL && (p) <= SAFETIMER_MAX_PERIOD)
+#endif
+
+/**
+ * @brief Convert a duration to ticks of SAFETIMER_TICK_US (rounded up)
+ *
+ * Rounding up never fires early. Compile-time constants for constant
+ * arguments; a result above SAFETIMER_MAX_PERIOD is rejected by the
+ * period checks.
+ *
+ * @note SAFETIMER_US_TO_TICKS() overflows above 2^32 - SAFETIMER_TICK_US us
+ *
+ * @par Example (SAFETIMER_TICK_US=10):
+ * @code
+ * h = safetimer_create(SAFETIMER_US_TO_TICKS(250), TIMER_MODE_REPEAT,
+ *                      bit_cb, NULL);  // 25 ticks
+ * @endcode
+ */
+#define SAFETIMER_US_TO_TICKS(us)                                              \
+  (((uint32_t)(us) + (SAFETIMER_TICK_US - 1UL)) / SAFETIMER_TICK_US)
+
+#if SAFETIMER_TICK_US <= 1000 && (1000 % SAFETIMER_TICK_US) == 0
+#define SAFETIMER_MS_TO_TICKS(ms)                                              \
+  ((uint32_t)(ms) * (1000UL / SAFETIMER_TICK_US))
+#elif (SAFETIMER_TICK_US % 1000) == 0
+#define SAFETIMER_MS_TO_TICKS(ms)                                              \
+  (((uint32_t)(ms) + (SAFETIMER_TICK_US / 1000UL - 1UL)) /                     \
+   (SAFETIMER_TICK_US / 1000UL))
+#else
+#define SAFETIMER_MS_TO_TICKS(ms) SAFETIMER_US_TO_TICKS((uint32_t)(ms) * 1000UL)
+#endif
+
 /**
  * @brief Timer operating modes
  */
@@ -83,6 +142,203 @@ typedef void (*timer_callback_t)(void *user_data);
 #else
 typedef void (*timer_callback_t)(void);
 #endif
+
+/**
+ * @brief Timers safetimer_create() can allocate in one pool
+ *
+ * MAX_TIMERS minus the static timers (SAFETIMER_STATIC_TIMERS), which hold
+ * slots 0 ~ SAFETIMER_STATIC_TIMERS-1 of every pool.
+ */
+#define SAFETIMER_RUNTIME_TIMERS (MAX_TIMERS - SAFETIMER_STATIC_TIMERS)
+
+#if SAFETIMER_STATIC_TIMERS > 0
+/**
+ * @brief One build-time timer (SAFETIMER_STATIC_TIMERS > 0)
+ *
+ * Entries are placed in flash by SAFETIMER_STATIC_TABLE; only the deadline
+ * and state of a static timer live in RAM.
+ */
+typedef struct {
+  bsp_tick_t period;         /**< 1 ~ SAFETIMER_MAX_PERIOD ticks */
+  timer_callback_t callback; /**< User callback (can be NULL) */
+#if SAFETIMER_ENABLE_USER_DATA
+  void *user_data; /**< User data passed to callback */
+#endif
+  uint8_t mode; /**< timer_mode_t */
+} safetimer_static_timer_t;
+
+/**
+ * @brief Static timer table, defined once by the application
+ *
+ * @par Example:
+ * @code
+ * SAFETIMER_STATIC_TABLE = {
+ *     SAFETIMER_STATIC_TIMER(500, TIMER_MODE_REPEAT, led_toggle, NULL),
+ *     SAFETIMER_STATIC_TIMER(10, TIMER_MODE_REPEAT, wdt_kick, NULL)};
+ *
+ * #define LED_TIMER SAFETIMER_STATIC_HANDLE(0)
+ *
+ * safetimer_start(LED_TIMER); // No safetimer_create() needed
+ * @endcode
+ *
+ * @note Entry k is the timer of SAFETIMER_STATIC_HANDLE(k)
+ * @note Drop the user_data argument when SAFETIMER_ENABLE_USER_DATA=0
+ */
+extern const safetimer_static_timer_t
+    safetimer_static_table[SAFETIMER_STATIC_TIMERS];
+
+#define SAFETIMER_STATIC_TABLE                                                 \
+  const safetimer_static_timer_t safetimer_static_table[SAFETIMER_STATIC_TIMERS]
+
+#if SAFETIMER_ENABLE_USER_DATA
+#define SAFETIMER_STATIC_TIMER(period, mode, callback, user_data)              \
+  {(bsp_tick_t)(period), (callback), (user_data), (uint8_t)(mode)}
+#else
+#define SAFETIMER_STATIC_TIMER(period, mode, callback)                         \
+  {(bsp_tick_t)(period), (callback), (uint8_t)(mode)}
+#endif
+
+/**
+ * @brief Compile-time handle of static timer k (0 ~ SAFETIMER_STATIC_TIMERS-1)
+ *
+ * Static slots are never deleted, so they keep the fixed top generation
+ * (HANDLE_GEN_MAX) with slot index k.
+ */
+#define SAFETIMER_STATIC_HANDLE(k)                                             \
+  ((safetimer_handle_t)((HANDLE_GEN_MAX << HANDLE_INDEX_BITS) | (k)))
+#endif
+
+#if SAFETIMER_ENABLE_STATS
+/**
+ * @brief Per-timer statistics (safetimer_get_stats())
+ *
+ * Durations are in bsp_get_cycles() units with SAFETIMER_STATS_CYCLES=1,
+ * otherwise in ticks.
+ */
+typedef struct {
+  uint32_t fire_count;      /**< Expirations dispatched */
+  uint32_t missed_count;    /**< Periods coalesced by skip-mode catch-up */
+  uint32_t max_duration;    /**< Longest callback run */
+  bsp_tick_t last_lateness; /**< current_tick - expire_time, last expiry */
+  bsp_tick_t max_lateness;  /**< Largest lateness seen */
+} safetimer_stats_t;
+
+/**
+ * @brief Pool-wide statistics (safetimer_get_pool_stats())
+ */
+typedef struct {
+  uint32_t max_pass;     /**< Longest safetimer_process() pass */
+  uint32_t max_critical; /**< Longest critical section (cycles only) */
+} safetimer_pool_stats_t;
+#endif
+
+#if SAFETIMER_ENABLE_CRIT_PROFILE
+/**
+ * @brief Public API groups profiled by safetimer_get_crit_api_max()
+ *
+ * A critical section counts towards the group of the API running it:
+ * sections of library code called by an API (start, reschedule, queue
+ * drain) count towards that API, sections of a callback's own API calls
+ * towards those calls.
+ */
+typedef enum {
+  SAFETIMER_API_CREATE = 0,  /**< create, create_flag, create_batch */
+  SAFETIMER_API_DELETE,      /**< delete */
+  SAFETIMER_API_START,       /**< start, sched_start */
+  SAFETIMER_API_STOP,        /**< stop */
+  SAFETIMER_API_SET_PERIOD,  /**< set_period, advance_period */
+  SAFETIMER_API_TRIGGER,     /**< trigger */
+  SAFETIMER_API_CONFIG,      /**< set_priority, set_slack, trace_attach */
+  SAFETIMER_API_QUERY,       /**< Status, expiry, usage, stats, polling */
+  SAFETIMER_API_PROCESS,     /**< process, process_budget, dispatch_ready */
+  SAFETIMER_API_ISR_DETECT,  /**< isr_detect */
+  SAFETIMER_API_SEM,         /**< sem_wait_on, sem_wake, semaphore macros */
+  SAFETIMER_API_COUNT        /**< Number of groups */
+} safetimer_api_t;
+
+/**
+ * @brief Profile record of one critical section call site
+ *
+ * One static record per bsp_enter_critical() call site, linked into the
+ * site list (safetimer_crit_first_site()) the first time it runs.
+ */
+typedef struct safetimer_crit_site {
+  const char *file;                 /**< __FILE__ of the call site */
+  struct safetimer_crit_site *next; /**< Next site, NULL = last */
+  uint32_t max_cycles;              /**< Longest masked duration */
+  uint16_t line;                    /**< __LINE__ of the call site */
+  uint8_t registered;               /**< Linked into the site list */
+} safetimer_crit_site_t;
+
+/** @brief Static initializer of a call site record (at the call site) */
+#define SAFETIMER_CRIT_SITE_INIT {__FILE__, NULL, 0, __LINE__, 0}
+#endif
+
+#if SAFETIMER_ENABLE_TRACE
+/**
+ * @brief Trace event codes (safetimer_trace_record_t.event)
+ *
+ * Values are part of the dump format read by safetimer_trace_decode.py.
+ */
+#define SAFETIMER_TRACE_CREATE 0    /**< Timer created */
+#define SAFETIMER_TRACE_START 1     /**< Timer started / restarted */
+#define SAFETIMER_TRACE_FIRE 2      /**< Expired at its deadline */
+#define SAFETIMER_TRACE_LATE_FIRE 3 /**< Expired late, arg = lateness */
+#define SAFETIMER_TRACE_SKIP 4      /**< Periods coalesced, arg = count */
+#define SAFETIMER_TRACE_STOP 5      /**< Timer stopped */
+#define SAFETIMER_TRACE_DELETE 6    /**< Timer deleted */
+
+/**
+ * @brief Trace record (8 bytes, 6 with 16-bit ticks)
+ *
+ * arg is saturated at 255. The ring is dumped as raw memory, so the
+ * decoder needs the target tick width and byte order.
+ */
+typedef struct {
+  bsp_tick_t tick; /**< bsp_get_ticks() at the event */
+  uint16_t handle; /**< safetimer_handle_t of the timer */
+  uint8_t event;   /**< SAFETIMER_TRACE_* code */
+  uint8_t arg;     /**< Event argument (0 if unused) */
+} safetimer_trace_record_t;
+#endif
+
+/* ========== Timer Pool Type ========== */
+#include "safetimer_pool.h" /* safetimer_pool_t (opaque, see header) */
+
+#if SAFETIMER_ENABLE_CORO_SCHED
+#include "coro_base.h"
+
+/**
+ * @brief Common header of a scheduler task context
+ *
+ * User contexts start with SAFETIMER_TASK_CONTEXT (safetimer_coro.h),
+ * which expands to the same members.
+ */
+typedef struct {
+  CORO_CONTEXT;          /**< Resume point (coro_base.h) */
+  bsp_tick_t _task_wake; /**< Tick the task runs next */
+} safetimer_task_ctx_t;
+
+/**
+ * @brief Scheduler task: coroutine function and its context
+ *
+ * @note The task table is only read, it may be const (ROM)
+ */
+typedef struct {
+  void (*fn)(void *ctx); /**< Coroutine (SAFETIMER_TASK_BEGIN/END) */
+  void *ctx;             /**< Context, starts with SAFETIMER_TASK_CONTEXT */
+} safetimer_task_t;
+
+/**
+ * @brief Coroutine scheduler state (one timer slot for all tasks)
+ */
+typedef struct {
+  const safetimer_task_t *tasks; /**< Task table */
+  safetimer_pool_t *pool;        /**< Pool that owns the timer */
+  safetimer_handle_t timer;      /**< Scheduler timer */
+  uint8_t count;                 /**< Number of tasks */
+} safetimer_sched_t;
+#endif
 /**
  * @warning CRITICAL RESTRICTIONS (violating these causes system failure):
  * @warning 1. Callback MUST NOT create, delete, or modify other timers
@@ -203,6 +459,100 @@ safetimer_handle_t safetimer_get_current_handle(void);
 timer_error_t safetimer_advance_period(safetimer_handle_t handle,
                                        uint32_t new_period_ms);
 #endif
+
+#if SAFETIMER_ENABLE_CATCHUP == SAFETIMER_CATCHUP_REPORT
+/**
+ * @brief Get periods missed by the currently executing REPEAT callback
+ *
+ * With SAFETIMER_CATCHUP_REPORT a REPEAT timer that fell N periods behind
+ * fires once and stays phase-locked; this returns N - 1, the expiries
+ * coalesced into this callback (0 when on time).
+ *
+ * @return Missed periods, 0 for ONE_SHOT timers and outside callbacks
+ *
+ * @par Example Usage:
+ * @code
+ * void meter_callback(void *user_data) {
+ *     g_energy += g_power * (safetimer_get_missed_count() + 1U);
+ * }
+ * @endcode
+ */
+uint32_t safetimer_get_missed_count(void);
+#endif
+
+#if SAFETIMER_ENABLE_SEM_WAKE
+/**
+ * @brief Register a coroutine timer as waiting on a semaphore
+ *
+ * Used by SAFETIMER_CORO_WAIT_SEM*: SAFETIMER_SEM_SIGNAL() then triggers
+ * the waiting timer instead of the coroutine polling the semaphore.
+ *
+ * @param handle Coroutine timer handle
+ * @param sem    Semaphore address, NULL = no longer waiting
+ * @return TIMER_OK on success, TIMER_ERR_INVALID on invalid handle
+ */
+timer_error_t safetimer_sem_wait_on(safetimer_handle_t handle,
+                                    const volatile void *sem);
+
+/**
+ * @brief Trigger every timer waiting on a semaphore (see safetimer_trigger())
+ * @param sem Semaphore address
+ * @note Called by SAFETIMER_SEM_SIGNAL(), each waiter is released
+ * @warning Task context only: reads bsp_get_ticks() and takes the pool lock
+ *          once per bitmap word plus once per waiter. ISRs use
+ *          safetimer_sem_wake_from_isr() (SAFETIMER_SEM_SIGNAL_FROM_ISR())
+ */
+void safetimer_sem_wake(const volatile void *sem);
+#endif
+
+#if SAFETIMER_ENABLE_CORO_SCHED
+/**
+ * @brief Run a task table on one timer slot of the default pool
+ *
+ * Creates and starts the scheduler timer and makes every task due, so
+ * the next safetimer_process() pass runs each task once. Afterwards a
+ * task runs when its wake tick is reached; the timer is re-armed for the
+ * earliest wake tick after every run.
+ *
+ * @param sched Scheduler state (caller-owned, static storage)
+ * @param tasks Task table (caller-owned, may be const)
+ * @param count Number of tasks (1 ~ 255)
+ * @return TIMER_OK on success, TIMER_ERR_INVALID on NULL/empty table,
+ *         TIMER_ERR_FULL if no timer slot is free
+ *
+ * @note Requires SAFETIMER_ENABLE_CORO_SCHED=1 in safetimer_config.h
+ *
+ * @par Example:
+ * @code
+ * typedef struct {
+ *     SAFETIMER_TASK_CONTEXT;
+ *     int count;
+ * } blink_ctx_t;
+ *
+ * static blink_ctx_t led1, led2;
+ * static const safetimer_task_t tasks[] = {
+ *     {blink_task, &led1}, {blink_task, &led2}};
+ * static safetimer_sched_t sched;
+ *
+ * safetimer_sched_start(&sched, tasks, 2);
+ * @endcode
+ */
+timer_error_t safetimer_sched_start(safetimer_sched_t *sched,
+                                    const safetimer_task_t *tasks,
+                                    uint8_t count);
+
+/**
+ * @brief Advance a task's wake tick by one period (for SAFETIMER_TASK_WAIT)
+ *
+ * Phase-locked like safetimer_advance_period(): a task that fell behind
+ * skips the missed periods instead of running back-to-back.
+ *
+ * @param ctx  Task context (starts with SAFETIMER_TASK_CONTEXT)
+ * @param ms   Period in milliseconds (1 ~ 2^31-1, 65535 with 16-bit ticks)
+ * @return TIMER_OK on success, TIMER_ERR_INVALID on NULL/out-of-range
+ */
+timer_error_t safetimer_task_advance(void *ctx, uint32_t ms);
+#endif
 timer_error_t safetimer_start(safetimer_handle_t handle);
 
 /**
@@ -214,7 +564,8 @@ timer_error_t safetimer_start(safetimer_handle_t handle);
  * @param handle Valid timer handle
  *
  * @return TIMER_OK on success, error code otherwise
- * @retval TIMER_ERR_INVALID Invalid handle
+ * @retval TIMER_ERR_INVALID Invalid handle, or a static timer
+ *                           (SAFETIMER_STATIC_HANDLE())
  */
 timer_error_t safetimer_delete(safetimer_handle_t handle);
 
@@ -229,7 +580,8 @@ timer_error_t safetimer_delete(safetimer_handle_t handle);
  * @param new_period_ms New period in milliseconds (1 ~ 2^31-1)
  *
  * @return TIMER_OK on success, error code otherwise
- * @retval TIMER_ERR_INVALID Invalid handle or period
+ * @retval TIMER_ERR_INVALID Invalid handle or period, or a static timer
+ *                           (period fixed in SAFETIMER_STATIC_TABLE)
  * @retval TIMER_ERR_NOT_FOUND Timer not found or deleted
  *
  * @warning Behavior equivalent to "restart with new period"
@@ -270,6 +622,83 @@ timer_error_t safetimer_delete(safetimer_handle_t handle);
 timer_error_t safetimer_set_period(safetimer_handle_t handle,
                                    uint32_t new_period_ms);
 
+/**
+ * @brief Make a timer due now (fires on the next safetimer_process() pass)
+ *
+ * Sets the deadline of the timer to the current tick, starting it if it
+ * is stopped. The period is unchanged: a REPEAT timer then continues one
+ * period after the triggered fire, a ONE_SHOT timer fires once.
+ *
+ * @param handle Timer handle
+ * @return TIMER_OK on success, TIMER_ERR_INVALID on invalid handle
+ *
+ * @note Use to wake an event-driven timer (e.g. a coroutine waiting for
+ *       data) instead of polling: the producer triggers the consumer
+ * @note Wheel engine: if the current tick was already processed, the
+ *       timer fires in the first pass of a later tick
+ *
+ * @par Example:
+ * @code
+ * void uart_rx_done(void) {
+ *     safetimer_trigger(parser_timer);  // Parse on the next pass
+ * }
+ * @endcode
+ */
+timer_error_t safetimer_trigger(safetimer_handle_t handle);
+
+#if SAFETIMER_PRIORITY_LEVELS > 1
+/**
+ * @brief Set timer dispatch priority
+ *
+ * Timers due in the same safetimer_process() pass are dispatched highest
+ * priority first, then in slot order. New timers start at priority 0.
+ *
+ * @param handle   Timer handle
+ * @param priority 0 (lowest, default) ~ SAFETIMER_PRIORITY_LEVELS-1
+ * @return TIMER_OK on success, TIMER_ERR_INVALID on invalid handle/priority
+ *
+ * @note Requires SAFETIMER_PRIORITY_LEVELS > 1 in safetimer_config.h
+ * @note Priority only orders callbacks of one pass; it does not preempt a
+ *       running callback
+ *
+ * @par Example:
+ * @code
+ * wdt = safetimer_create(10, TIMER_MODE_REPEAT, wdt_kick, NULL);
+ * safetimer_set_priority(wdt, SAFETIMER_PRIORITY_LEVELS - 1);
+ * @endcode
+ */
+timer_error_t safetimer_set_priority(safetimer_handle_t handle,
+                                     uint8_t priority);
+#endif
+
+#if SAFETIMER_ENABLE_SLACK
+/**
+ * @brief Set how early a timer may fire to share another timer's wakeup
+ *
+ * A pass that dispatches a due timer also fires every running timer whose
+ * deadline is at most slack_ms ticks ahead. A pass with nothing due fires
+ * nothing early. REPEAT timers stay phase-locked (the next deadline is
+ * still old deadline + period). New timers start with no slack.
+ *
+ * @param handle   Timer handle
+ * @param slack_ms Tolerated early firing, 0 (default) ~ period - 1
+ * @return TIMER_OK on success, TIMER_ERR_INVALID on invalid handle or
+ *         slack not below the period
+ *
+ * @note Requires SAFETIMER_ENABLE_SLACK=1 in safetimer_config.h
+ * @note Slack never delays a timer: safetimer_get_next_expiry() still
+ *       reports the earliest deadline
+ *
+ * @par Example:
+ * @code
+ * led = safetimer_create(500, TIMER_MODE_REPEAT, led_toggle, NULL);
+ * safetimer_set_slack(led, 20);  // May ride along up to 20 ms early
+ * @endcode
+ */
+timer_error_t safetimer_set_slack(safetimer_handle_t handle,
+                                  uint8_t slack_ms);
+#endif
+
 /**
  * @brief Advance timer period (phase-locked, zero cumulative error)
  *
@@ -391,6 +820,104 @@ timer_error_t safetimer_set_period(safetimer_handle_t handle,
  */
 void safetimer_process(void);
 
+#if SAFETIMER_ENABLE_PROCESS_BUDGET
+/**
+ * @brief Process timers, bounded by a callback count and/or a tick budget
+ *
+ * @param max_callbacks Stop after this many callbacks ran (0 = no limit)
+ * @param max_ticks     Stop once this many ticks passed since the call
+ *                      started (0 = no limit)
+ *
+ * @return 1 if the budget ran out with due timers left (call again soon),
+ *         0 if the pass completed
+ *
+ * Same pass as safetimer_process(), but caps the callback work done per
+ * main-loop iteration. The budget is checked after each callback, so at
+ * least one due callback runs per call. The next call (budgeted or plain
+ * safetimer_process()) resumes at the first slot that was not dispatched,
+ * so high-index timers are never starved by low-index ones.
+ *
+ * @note Timers left over fire late by the time until the next call, never
+ *       early; REPEAT timers keep their phase (expire_time not touched)
+ * @note The tick budget has BSP tick resolution (ms): a callback that starts
+ *       just before a tick boundary can still end past it
+ * @note Requires SAFETIMER_ENABLE_PROCESS_BUDGET=1 in safetimer_config.h
+ *
+ * @par Example:
+ * @code
+ * while (1) {
+ *     safetimer_process_budget(2, 0);  // at most 2 callbacks per iteration
+ *     uart_poll();
+ *     motor_control_poll();
+ * }
+ * @endcode
+ */
+int safetimer_process_budget(uint16_t max_callbacks, uint32_t max_ticks);
+#endif
+
+/**
+ * @brief Get ticks until the earliest active deadline (low-power support)
+ *
+ * Returns how long the application may sleep before safetimer_process()
+ * has work to do. Wraparound follows the same safetimer_tick_diff() rules
+ * as safetimer_process().
+ *
+ * @return Ticks (milliseconds) until the soonest active timer expires
+ * @retval 0 A timer is already due (call safetimer_process() now)
+ * @retval SAFETIMER_NO_EXPIRY No timer is active
+ *
+ * @note Always available (not gated by ENABLE_QUERY_API)
+ * @note O(1) right after safetimer_process(); rescans once if timers were
+ *       modified since the last pass
+ *
+ * @par Example:
+ * @code
+ * while (1) {
+ *     uint32_t idle;
+ *
+ *     safetimer_process();
+ *     idle = safetimer_get_next_expiry();
+ *     if (idle > 2) {
+ *         bsp_sleep_ms(idle);  // Program wake-up, enter stop mode
+ *     }
+ * }
+ * @endcode
+ */
+uint32_t safetimer_get_next_expiry(void);
+
+#if SAFETIMER_BSP_TICKLESS
+/**
+ * @brief Program the tickless wakeup for the earliest deadline
+ *
+ * Queries safetimer_get_next_expiry() and, unless a timer is already due,
+ * passes the result to bsp_set_wakeup() so the compare-match interrupt
+ * fires at the next deadline. After wakeup, credit the slept ticks in one
+ * step (safetimer_tick_advance() with the default BSP); the following
+ * safetimer_process() handles the whole jump in one pass.
+ *
+ * @return Ticks programmed (SAFETIMER_NO_EXPIRY: no timer is running)
+ * @retval 0 A timer is due: nothing programmed, call safetimer_process()
+ *
+ * @note Requires SAFETIMER_BSP_TICKLESS=1 and a user bsp_set_wakeup()
+ * @note Call after safetimer_process(), right before sleeping, with
+ *       interrupts masked as usual for the sleep instruction
+ *
+ * @par Example:
+ * @code
+ * while (1) {
+ *     safetimer_process();
+ *     DISABLE_IRQ();
+ *     if (safetimer_tickless_arm() != 0) {
+ *         bsp_stop_tick();
+ *         ENTER_STOP_MODE();  // Wakes on compare match or other IRQ
+ *     }
+ *     ENABLE_IRQ();            // Wakeup ISR ran safetimer_tick_advance()
+ * }
+ * @endcode
+ */
+uint32_t safetimer_tickless_arm(void);
+#endif
+
 /* ========== Optional Query/Diagnostic APIs ========== */
 #if ENABLE_QUERY_API
 
@@ -456,9 +983,655 @@ timer_error_t safetimer_get_pool_usage(int *used_count, int *total_count);
 
 #endif /* ENABLE_QUERY_API */
 
+/* ========== Statistics API ========== */
+#if SAFETIMER_ENABLE_STATS
+
+/**
+ * @brief Get timer statistics
+ *
+ * @param handle Valid timer handle
+ * @param stats  Output: fire/missed counts, lateness, max callback duration
+ *
+ * @return TIMER_OK on success
+ * @retval TIMER_ERR_INVALID Invalid handle or null output pointer
+ *
+ * @note Requires SAFETIMER_ENABLE_STATS=1 in safetimer_config.h
+ * @note Statistics restart from zero when the timer is created
+ *
+ * @par Example:
+ * @code
+ * safetimer_stats_t st;
+ * if (safetimer_get_stats(motor_timer, &st) == TIMER_OK &&
+ *     st.max_lateness > 2) {
+ *     log_deadline_miss(st.max_lateness, st.missed_count);
+ * }
+ * @endcode
+ */
+timer_error_t safetimer_get_stats(safetimer_handle_t handle,
+                                  safetimer_stats_t *stats);
+
+/**
+ * @brief Reset timer statistics to zero
+ *
+ * @param handle Valid timer handle
+ * @return TIMER_OK on success, TIMER_ERR_INVALID on invalid handle
+ */
+timer_error_t safetimer_reset_stats(safetimer_handle_t handle);
+
+/**
+ * @brief Get pool-wide statistics (longest pass and critical section)
+ *
+ * @param stats Output statistics
+ * @return TIMER_OK on success, TIMER_ERR_INVALID on null output pointer
+ *
+ * @note max_critical is only measured with SAFETIMER_STATS_CYCLES=1
+ */
+timer_error_t safetimer_get_pool_stats(safetimer_pool_stats_t *stats);
+
+/**
+ * @brief Reset pool-wide statistics (per-timer statistics are kept)
+ */
+void safetimer_reset_pool_stats(void);
+
+#endif /* SAFETIMER_ENABLE_STATS */
+
+/* ========== Critical Section Profile API ========== */
+#if SAFETIMER_ENABLE_CRIT_PROFILE
+
+/**
+ * @brief First record of the critical section site list
+ *
+ * @return Site profiled most recently registered, NULL before any section
+ *         ran; follow ->next for the others
+ *
+ * @note Requires SAFETIMER_ENABLE_CRIT_PROFILE=1 in safetimer_config.h
+ * @note Durations are in bsp_get_cycles() units, from the cycle count
+ *       read just after bsp_enter_critical() to the one just before
+ *       bsp_exit_critical()
+ *
+ * @par Example:
+ * @code
+ * const safetimer_crit_site_t *site = safetimer_crit_first_site();
+ * for (; site != NULL; site = site->next) {
+ *     printf("%s:%u %lu\n", site->file, site->line,
+ *            (unsigned long)site->max_cycles);
+ * }
+ * @endcode
+ */
+const safetimer_crit_site_t *safetimer_crit_first_site(void);
+
+/**
+ * @brief Longest critical section seen while an API group ran
+ *
+ * @param api Public API group
+ * @return Longest masked duration in bsp_get_cycles() units, 0 if the
+ *         group never ran a critical section or api is out of range
+ */
+uint32_t safetimer_get_crit_api_max(safetimer_api_t api);
+
+/**
+ * @brief Restart critical section profiling (sites stay registered)
+ */
+void safetimer_reset_crit_profile(void);
+
+/**
+ * @brief Profiled bsp_enter_critical() for code outside safetimer.c
+ *
+ * @param site Static record of the call site (SAFETIMER_CRIT_SITE_INIT)
+ *
+ * @note Used by the semaphore macros; sections count towards
+ *       SAFETIMER_API_SEM. Leave with safetimer_crit_exit()
+ */
+void safetimer_crit_enter(safetimer_crit_site_t *site);
+
+/**
+ * @brief Profiled bsp_exit_critical(), pairs with safetimer_crit_enter()
+ */
+void safetimer_crit_exit(void);
+
+#endif /* SAFETIMER_ENABLE_CRIT_PROFILE */
+
+/* ========== Event Trace API ========== */
+#if SAFETIMER_ENABLE_TRACE
+
+/**
+ * @brief Attach a RAM ring that receives timer events
+ *
+ * @param buffer   Ring storage, NULL to detach
+ * @param capacity Number of records: power of two, 2~32768
+ *
+ * @return TIMER_OK on success
+ * @retval TIMER_ERR_INVALID capacity is not a power of two in range
+ *
+ * @note Requires SAFETIMER_ENABLE_TRACE=1 in safetimer_config.h
+ * @note Restarts the record count; once full, the oldest records are
+ *       overwritten. Dump the buffer together with
+ *       safetimer_trace_count() to decode it on the host
+ *
+ * @par Example:
+ * @code
+ * static safetimer_trace_record_t trace[64];
+ * safetimer_trace_attach(trace, 64);
+ * ...
+ * // Debugger: dump trace[] and safetimer_trace_count(), then run
+ * // scripts/safetimer_trace_decode.py trace.bin --count N
+ * @endcode
+ */
+timer_error_t safetimer_trace_attach(safetimer_trace_record_t *buffer,
+                                     uint16_t capacity);
+
+/**
+ * @brief Number of records written since the last attach
+ *
+ * @return Record count, the newest record is at index
+ *         (count - 1) % capacity. Once 2 * capacity records were written
+ *         the count stays within capacity ~ 2 * capacity - 1, so a count
+ *         above capacity always means the ring wrapped
+ */
+uint16_t safetimer_trace_count(void);
+
+#endif /* SAFETIMER_ENABLE_TRACE */
+
+/* ========== ISR Command Queue API ========== */
+#if SAFETIMER_ENABLE_ISR_QUEUE
+
+/**
+ * @brief Wait-free timer control from interrupt context
+ *
+ * The *_from_isr() functions never call bsp_enter_critical(): they append a
+ * command to a small per-pool ring (SAFETIMER_ISR_QUEUE_SIZE) and return.
+ * safetimer_process() applies queued commands, in order, at the start of
+ * its next pass, so ISR re-arms add no interrupt-masking jitter.
+ *
+ * @return TIMER_OK if queued
+ * @retval TIMER_ERR_FULL    Ring full, command dropped (retry or enlarge
+ *                           SAFETIMER_ISR_QUEUE_SIZE)
+ * @retval TIMER_ERR_INVALID SAFETIMER_INVALID_HANDLE or period out of range
+ *
+ * @note Handle validity is checked when the command is applied; commands
+ *       for timers deleted meanwhile are silently dropped
+ * @note Start and set_period count from the tick read inside the ISR
+ * @note Calls made directly from the main loop between the ISR and the next
+ *       pass take effect first (the queued command is applied after them)
+ *
+ * @warning Single producer: call only from ISRs that cannot preempt each
+ *          other (same priority level), never from the main loop
+ *
+ * @par Example:
+ * @code
+ * void uart_rx_isr(void) {
+ *     rx_buf[rx_len++] = UART_DATA;
+ *     safetimer_start_from_isr(g_rx_idle_timer);  // restart idle timeout
+ * }
+ * @endcode
+ */
+timer_error_t safetimer_start_from_isr(safetimer_handle_t handle);
+
+/** @brief Queue safetimer_stop() from interrupt context */
+timer_error_t safetimer_stop_from_isr(safetimer_handle_t handle);
+
+/** @brief Queue safetimer_set_period() from interrupt context */
+timer_error_t safetimer_set_period_from_isr(safetimer_handle_t handle,
+                                            uint32_t new_period_ms);
+
+/** @brief Queue safetimer_delete() from interrupt context */
+timer_error_t safetimer_delete_from_isr(safetimer_handle_t handle);
+
+/** @brief Queue safetimer_trigger() from interrupt context */
+timer_error_t safetimer_trigger_from_isr(safetimer_handle_t handle);
+
+#if SAFETIMER_ENABLE_SEM_WAKE
+/**
+ * @brief Queue safetimer_sem_wake() from interrupt context
+ *
+ * Used by SAFETIMER_SEM_SIGNAL_FROM_ISR(). The next pass triggers every
+ * timer still waiting on sem at that point.
+ *
+ * @note TIMER_ERR_FULL only loses the early wake: the signaled semaphore
+ *       is still seen at the waiter's deadline
+ */
+timer_error_t safetimer_sem_wake_from_isr(const volatile void *sem);
+#endif
+
+#endif /* SAFETIMER_ENABLE_ISR_QUEUE */
+
+/* ========== ISR Dispatch API ========== */
+#if SAFETIMER_ENABLE_ISR_DISPATCH
+
+/**
+ * @brief Detect due timers (call from the 1ms tick ISR, after the tick)
+ *
+ * O(1) compare against the cached earliest deadline; raises the ready flag
+ * read by safetimer_dispatch_ready(). Called automatically by
+ * safetimer_tick_isr() of the default BSP (SAFETIMER_BSP_IMPLEMENTATION>0).
+ *
+ * @note ISR-safe: one short critical section, never invokes callbacks
+ * @note Requires SAFETIMER_ENABLE_ISR_DISPATCH=1 in safetimer_config.h
+ *
+ * @par Example (custom BSP):
+ * @code
+ * void SysTick_Handler(void) {
+ *     s_ticks++;
+ *     safetimer_isr_detect();
+ * }
+ * @endcode
+ */
+void safetimer_isr_detect(void);
+
+/**
+ * @brief Dispatch due timers flagged by safetimer_isr_detect()
+ *
+ * Replaces safetimer_process() in the main loop. Returns after a single
+ * flag read while nothing is due; otherwise runs one full process pass
+ * (ISR command queue, callbacks, cache rebuild).
+ *
+ * @warning Main loop only, same restrictions as safetimer_process()
+ *
+ * @par Example:
+ * @code
+ * while (1) {
+ *     safetimer_dispatch_ready();  // ~1 load when idle
+ *     uart_poll();
+ * }
+ * @endcode
+ */
+void safetimer_dispatch_ready(void);
+
+#endif /* SAFETIMER_ENABLE_ISR_DISPATCH */
+
+/* ========== Flag Timer API ========== */
+#if SAFETIMER_ENABLE_FLAG_TIMERS
+
+/**
+ * @brief Create a callback-free flag timer
+ *
+ * Same as safetimer_create() without callback and user_data: each expiry
+ * only sets the timer's bit in the pool's expired bitmap, read with
+ * safetimer_poll_expired(). Start, stop, delete and period changes work as
+ * for any timer.
+ *
+ * @param period_ms Period in ticks (1 ~ SAFETIMER_MAX_PERIOD)
+ * @param mode      TIMER_MODE_ONE_SHOT or TIMER_MODE_REPEAT
+ *
+ * @return Handle, or SAFETIMER_INVALID_HANDLE (pool full, bad parameter)
+ *
+ * @note Requires SAFETIMER_ENABLE_FLAG_TIMERS=1 in safetimer_config.h
+ */
+safetimer_handle_t safetimer_create_flag(uint32_t period_ms,
+                                         timer_mode_t mode);
+
+/**
+ * @brief Fetch and clear the flag timers that expired since the last poll
+ *
+ * @param expired Out: BITMAP_WORDS words, bit = slot of the handle
+ *                (test with SAFETIMER_EXPIRED())
+ *
+ * @return TIMER_OK if at least one bit is set
+ * @retval TIMER_ERR_NOT_FOUND No flag timer expired (expired[] all zero)
+ * @retval TIMER_ERR_INVALID   expired is NULL
+ *
+ * @note One critical section; repeated expiries of one timer between two
+ *       polls report one bit
+ * @note A deleted timer's pending bit is dropped by safetimer_delete()
+ *
+ * @par Example:
+ * @code
+ * safetimer_bitmap_t fired[BITMAP_WORDS];
+ *
+ * if (safetimer_poll_expired(fired) == TIMER_OK) {
+ *     if (SAFETIMER_EXPIRED(fired, adc_timer)) {
+ *         adc_start();
+ *     }
+ * }
+ * @endcode
+ */
+timer_error_t safetimer_poll_expired(safetimer_bitmap_t *expired);
+
+/** @brief Slot index of a handle (bit position in the expired bitmap) */
+#define SAFETIMER_HANDLE_SLOT(handle)                                          \
+  ((handle) & ((1 << HANDLE_INDEX_BITS) - 1))
+
+/** @brief Test the bit of a handle in a safetimer_poll_expired() bitmap */
+#define SAFETIMER_EXPIRED(expired, handle)                                     \
+  ((((expired)[SAFETIMER_HANDLE_SLOT(handle) / BITMAP_WORD_BITS] >>            \
+     (SAFETIMER_HANDLE_SLOT(handle) % BITMAP_WORD_BITS)) &                     \
+    1U) != 0)
+
+#endif /* SAFETIMER_ENABLE_FLAG_TIMERS */
+
+/* ========== Multiple Pool API ========== */
+
+/**
+ * @brief Independent timer pools (one per core or subsystem)
+ *
+ * Every pool has its own slots, generation counter, earliest-deadline state,
+ * recursion guard and (optionally) lock, so a slow subsystem's callbacks
+ * cannot delay another pool's deadlines. The functions above operate on a
+ * built-in default pool; the *_in() variants below take an explicit pool and
+ * otherwise behave identically.
+ *
+ * @warning Handles belong to the pool that created them: passing a handle to
+ *          another pool is not detected reliably (same as a stale handle)
+ * @note Coroutine and semaphore helpers (safetimer_coro.h) use the default
+ *       pool
+ *
+ * @par Example:
+ * @code
+ * static safetimer_pool_t radio_pool;
+ *
+ * void radio_init(void) {
+ *     safetimer_handle_t h;
+ *
+ *     safetimer_pool_init(&radio_pool);
+ *     h = safetimer_create_in(&radio_pool, 20, TIMER_MODE_REPEAT,
+ *                             radio_poll, NULL);
+ *     safetimer_start_in(&radio_pool, h);
+ * }
+ *
+ * void core1_main(void) {
+ *     while (1) {
+ *         safetimer_process_pool(&radio_pool);
+ *     }
+ * }
+ * @endcode
+ */
+
+/**
+ * @brief Initialize (or reset) a timer pool
+ *
+ * @param pool Pool storage provided by the application
+ *
+ * @note Required for pools not in zero-initialized static storage
+ * @note Not thread-safe: call before the pool is used by any other context
+ */
+void safetimer_pool_init(safetimer_pool_t *pool);
+
+#if SAFETIMER_ENABLE_POOL_LOCK
+/**
+ * @brief Install the critical section used by one pool
+ *
+ * @param pool           Initialized pool
+ * @param enter_critical Lock function (NULL together with exit_critical:
+ *                       restore bsp_enter_critical())
+ * @param exit_critical  Unlock function
+ *
+ * @return TIMER_OK on success
+ * @retval TIMER_ERR_INVALID NULL pool or only one hook given
+ *
+ * @note The lock must exclude every context (ISR, other core) that calls
+ *       into this pool
+ * @note Requires SAFETIMER_ENABLE_POOL_LOCK=1 in safetimer_config.h
+ */
+timer_error_t safetimer_pool_set_lock(safetimer_pool_t *pool,
+                                      void (*enter_critical)(void),
+                                      void (*exit_critical)(void));
+#endif
+
+/** @brief safetimer_create() on an explicit pool */
+#if SAFETIMER_ENABLE_USER_DATA
+safetimer_handle_t safetimer_create_in(safetimer_pool_t *pool,
+                                       uint32_t period_ms, timer_mode_t mode,
+                                       timer_callback_t callback,
+                                       void *user_data);
+#else
+safetimer_handle_t safetimer_create_in(safetimer_pool_t *pool,
+                                       uint32_t period_ms, timer_mode_t mode,
+                                       timer_callback_t callback);
+#endif
+
+/** @brief safetimer_start() on an explicit pool */
+timer_error_t safetimer_start_in(safetimer_pool_t *pool,
+                                 safetimer_handle_t handle);
+
+/** @brief safetimer_delete() on an explicit pool */
+timer_error_t safetimer_delete_in(safetimer_pool_t *pool,
+                                  safetimer_handle_t handle);
+
+/** @brief safetimer_set_period() on an explicit pool */
+timer_error_t safetimer_set_period_in(safetimer_pool_t *pool,
+                                      safetimer_handle_t handle,
+                                      uint32_t new_period_ms);
+
+/** @brief safetimer_trigger() on an explicit pool */
+timer_error_t safetimer_trigger_in(safetimer_pool_t *pool,
+                                   safetimer_handle_t handle);
+
+#if SAFETIMER_PRIORITY_LEVELS > 1
+/** @brief safetimer_set_priority() on an explicit pool */
+timer_error_t safetimer_set_priority_in(safetimer_pool_t *pool,
+                                        safetimer_handle_t handle,
+                                        uint8_t priority);
+#endif
+
+#if SAFETIMER_ENABLE_SLACK
+/** @brief safetimer_set_slack() on an explicit pool */
+timer_error_t safetimer_set_slack_in(safetimer_pool_t *pool,
+                                     safetimer_handle_t handle,
+                                     uint8_t slack_ms);
+#endif
+
+#if SAFETIMER_ENABLE_ISR_QUEUE
+/** @brief safetimer_start_from_isr() on an explicit pool */
+timer_error_t safetimer_start_from_isr_in(safetimer_pool_t *pool,
+                                          safetimer_handle_t handle);
+
+/** @brief safetimer_stop_from_isr() on an explicit pool */
+timer_error_t safetimer_stop_from_isr_in(safetimer_pool_t *pool,
+                                         safetimer_handle_t handle);
+
+/** @brief safetimer_set_period_from_isr() on an explicit pool */
+timer_error_t safetimer_set_period_from_isr_in(safetimer_pool_t *pool,
+                                               safetimer_handle_t handle,
+                                               uint32_t new_period_ms);
+
+/** @brief safetimer_delete_from_isr() on an explicit pool */
+timer_error_t safetimer_delete_from_isr_in(safetimer_pool_t *pool,
+                                           safetimer_handle_t handle);
+
+/** @brief safetimer_trigger_from_isr() on an explicit pool */
+timer_error_t safetimer_trigger_from_isr_in(safetimer_pool_t *pool,
+                                            safetimer_handle_t handle);
+
+#if SAFETIMER_ENABLE_SEM_WAKE
+/** @brief safetimer_sem_wake_from_isr() on an explicit pool */
+timer_error_t safetimer_sem_wake_from_isr_in(safetimer_pool_t *pool,
+                                             const volatile void *sem);
+#endif
+#endif
+
+#if SAFETIMER_ENABLE_CORO
+/** @brief safetimer_advance_period() on an explicit pool */
+timer_error_t safetimer_advance_period_in(safetimer_pool_t *pool,
+                                          safetimer_handle_t handle,
+                                          uint32_t new_period_ms);
+
+/** @brief safetimer_get_current_handle() for callbacks of one pool */
+safetimer_handle_t safetimer_get_current_handle_in(safetimer_pool_t *pool);
+#endif
+
+#if SAFETIMER_ENABLE_CATCHUP == SAFETIMER_CATCHUP_REPORT
+/** @brief safetimer_get_missed_count() for callbacks of one pool */
+uint32_t safetimer_get_missed_count_in(safetimer_pool_t *pool);
+#endif
+
+#if SAFETIMER_ENABLE_SEM_WAKE
+/** @brief safetimer_sem_wait_on() on an explicit pool */
+timer_error_t safetimer_sem_wait_on_in(safetimer_pool_t *pool,
+                                       safetimer_handle_t handle,
+                                       const volatile void *sem);
+
+/** @brief safetimer_sem_wake() on an explicit pool */
+void safetimer_sem_wake_in(safetimer_pool_t *pool, const volatile void *sem);
+#endif
+
+#if SAFETIMER_ENABLE_CORO_SCHED
+/** @brief safetimer_sched_start() on an explicit pool */
+timer_error_t safetimer_sched_start_in(safetimer_pool_t *pool,
+                                       safetimer_sched_t *sched,
+                                       const safetimer_task_t *tasks,
+                                       uint8_t count);
+#endif
+
+/**
+ * @brief safetimer_process() on an explicit pool
+ *
+ * @note Pools are processed independently: the recursion guard only blocks
+ *       re-entering the same pool, so a callback may process another pool
+ */
+void safetimer_process_pool(safetimer_pool_t *pool);
+
+#if SAFETIMER_ENABLE_ISR_DISPATCH
+/** @brief safetimer_isr_detect() on an explicit pool */
+void safetimer_isr_detect_in(safetimer_pool_t *pool);
+
+/** @brief safetimer_dispatch_ready() on an explicit pool */
+void safetimer_dispatch_ready_in(safetimer_pool_t *pool);
+#endif
+
+#if SAFETIMER_ENABLE_PROCESS_BUDGET
+/** @brief safetimer_process_budget() on an explicit pool */
+int safetimer_process_budget_in(safetimer_pool_t *pool,
+                                uint16_t max_callbacks, uint32_t max_ticks);
+#endif
+
+/** @brief safetimer_get_next_expiry() on an explicit pool */
+uint32_t safetimer_get_next_expiry_in(safetimer_pool_t *pool);
+
+#if SAFETIMER_BSP_TICKLESS
+/** @brief safetimer_tickless_arm() on an explicit pool */
+uint32_t safetimer_tickless_arm_in(safetimer_pool_t *pool);
+#endif
+
+#if ENABLE_QUERY_API
+/** @brief safetimer_stop() on an explicit pool */
+timer_error_t safetimer_stop_in(safetimer_pool_t *pool,
+                                safetimer_handle_t handle);
+
+/** @brief safetimer_get_status() on an explicit pool */
+timer_error_t safetimer_get_status_in(safetimer_pool_t *pool,
+                                      safetimer_handle_t handle,
+                                      int *is_running);
+
+/** @brief safetimer_get_remaining() on an explicit pool */
+timer_error_t safetimer_get_remaining_in(safetimer_pool_t *pool,
+                                         safetimer_handle_t handle,
+                                         uint32_t *remaining_ms);
+
+/** @brief safetimer_get_pool_usage() on an explicit pool */
+timer_error_t safetimer_get_pool_usage_in(safetimer_pool_t *pool,
+                                          int *used_count, int *total_count);
+#endif /* ENABLE_QUERY_API */
+
+#if SAFETIMER_ENABLE_STATS
+/** @brief safetimer_get_stats() on an explicit pool */
+timer_error_t safetimer_get_stats_in(safetimer_pool_t *pool,
+                                     safetimer_handle_t handle,
+                                     safetimer_stats_t *stats);
+
+/** @brief safetimer_reset_stats() on an explicit pool */
+timer_error_t safetimer_reset_stats_in(safetimer_pool_t *pool,
+                                       safetimer_handle_t handle);
+
+/** @brief safetimer_get_pool_stats() on an explicit pool */
+timer_error_t safetimer_get_pool_stats_in(safetimer_pool_t *pool,
+                                          safetimer_pool_stats_t *stats);
+
+/** @brief safetimer_reset_pool_stats() on an explicit pool */
+void safetimer_reset_pool_stats_in(safetimer_pool_t *pool);
+#endif /* SAFETIMER_ENABLE_STATS */
+
+#if SAFETIMER_ENABLE_TRACE
+/** @brief safetimer_trace_attach() on an explicit pool */
+timer_error_t safetimer_trace_attach_in(safetimer_pool_t *pool,
+                                        safetimer_trace_record_t *buffer,
+                                        uint16_t capacity);
+
+/** @brief safetimer_trace_count() on an explicit pool */
+uint16_t safetimer_trace_count_in(safetimer_pool_t *pool);
+#endif
+
+#if SAFETIMER_ENABLE_FLAG_TIMERS
+/** @brief safetimer_create_flag() on an explicit pool */
+safetimer_handle_t safetimer_create_flag_in(safetimer_pool_t *pool,
+                                            uint32_t period_ms,
+                                            timer_mode_t mode);
+
+/** @brief safetimer_poll_expired() on an explicit pool */
+timer_error_t safetimer_poll_expired_in(safetimer_pool_t *pool,
+                                        safetimer_bitmap_t *expired);
+#endif
+
 /* ========== Convenience Functions (Helpers) ========== */
 #if ENABLE_HELPER_API
 
+/**
+ * @brief Create and start a group of timers in one atomic step
+ *
+ * All timers share period and mode and count from one tick read, taken
+ * once for the group, so their deadlines stay phase-locked. The whole
+ * group is allocated under a single critical section: either every timer
+ * is created and running, or none is.
+ *
+ * @param count     Number of timers (0 ~ free slots)
+ * @param period_ms Period of every timer (1 ~ SAFETIMER_MAX_PERIOD)
+ * @param mode      TIMER_MODE_ONE_SHOT or TIMER_MODE_REPEAT
+ * @param callbacks count callbacks (NULL entries allowed)
+ * @param user_data count user_data pointers (SAFETIMER_ENABLE_USER_DATA)
+ * @param offsets   NULL (aligned), or count start offsets in ticks
+ *                  (0 ~ period_ms-1): timer i first expires at
+ *                  start + offsets[i] + period_ms, later periods keep
+ *                  that phase
+ * @param handles   Out: count handles (all SAFETIMER_INVALID_HANDLE on
+ *                  failure)
+ *
+ * @return TIMER_OK, TIMER_ERR_FULL if fewer than count slots are free
+ *         (nothing created), TIMER_ERR_INVALID on NULL arrays or (with
+ *         ENABLE_PARAM_CHECK) out-of-range period, mode or offset
+ *
+ * @note The critical section grows with count (one create + start per
+ *       timer); heap engine O(count log n)
+ *
+ * @par Example (8 ADC channels, 10 ms apart within an 80 ms frame):
+ * @code
+ * static const uint32_t stagger[8] = {0, 10, 20, 30, 40, 50, 60, 70};
+ * safetimer_handle_t ch[8];
+ *
+ * if (safetimer_create_batch(8, 80, TIMER_MODE_REPEAT, adc_cbs, adc_args,
+ *                            stagger, ch) != TIMER_OK) {
+ *     error_handler();
+ * }
+ * @endcode
+ */
+#if SAFETIMER_ENABLE_USER_DATA
+timer_error_t safetimer_create_batch(uint8_t count, uint32_t period_ms,
+                                     timer_mode_t mode,
+                                     timer_callback_t *callbacks,
+                                     void **user_data, const uint32_t *offsets,
+                                     safetimer_handle_t *handles);
+#else
+timer_error_t safetimer_create_batch(uint8_t count, uint32_t period_ms,
+                                     timer_mode_t mode,
+                                     timer_callback_t *callbacks,
+                                     const uint32_t *offsets,
+                                     safetimer_handle_t *handles);
+#endif
+
+/** @brief safetimer_create_batch() on an explicit pool */
+#if SAFETIMER_ENABLE_USER_DATA
+timer_error_t safetimer_create_batch_in(safetimer_pool_t *pool, uint8_t count,
+                                        uint32_t period_ms, timer_mode_t mode,
+                                        timer_callback_t *callbacks,
+                                        void **user_data,
+                                        const uint32_t *offsets,
+                                        safetimer_handle_t *handles);
+#else
+timer_error_t safetimer_create_batch_in(safetimer_pool_t *pool, uint8_t count,
+                                        uint32_t period_ms, timer_mode_t mode,
+                                        timer_callback_t *callbacks,
+                                        const uint32_t *offsets,
+                                        safetimer_handle_t *handles);
+#endif
+
 /**
  * @brief Create and immediately start a timer (convenience wrapper)
  */
@@ -482,6 +1655,12 @@ safetimer_create_started(uint32_t period_ms, timer_mode_t mode,
 
 /**
  * @brief Create and start multiple timers with identical parameters (batch)
+ *
+ * safetimer_create_batch() without offsets: one tick read, one critical
+ * section, all-or-nothing.
+ *
+ * @return count on success, 0 if the pool cannot hold all of them or on
+ *         invalid parameters (no timer created, all handles invalid)
  */
 #if SAFETIMER_ENABLE_USER_DATA
 static inline uint8_t
@@ -494,30 +1673,16 @@ safetimer_create_started_batch(uint8_t count, uint32_t period_ms,
                                timer_mode_t mode, timer_callback_t *callbacks,
                                safetimer_handle_t *handles) {
 #endif
-  uint8_t i;
-  uint8_t success_count = 0;
+  timer_error_t result;
 
-  if (callbacks == NULL || handles == NULL) {
-    return 0;
-  }
 #if SAFETIMER_ENABLE_USER_DATA
-  if (user_data == NULL) {
-    return 0;
-  }
-#endif
-
-  for (i = 0; i < count; i++) {
-#if SAFETIMER_ENABLE_USER_DATA
-    handles[i] =
-        safetimer_create_started(period_ms, mode, callbacks[i], user_data[i]);
+  result = safetimer_create_batch(count, period_ms, mode, callbacks, user_data,
+                                  NULL, handles);
 #else
-    handles[i] = safetimer_create_started(period_ms, mode, callbacks[i]);
+  result = safetimer_create_batch(count, period_ms, mode, callbacks, NULL,
+                                  handles);
 #endif
-    if (handles[i] != SAFETIMER_INVALID_HANDLE) {
-      success_count++;
-    }
-  }
-  return success_count;
+  return (result == TIMER_OK) ? count : 0;
 }
 
 /**
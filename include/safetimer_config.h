@@ -58,14 +58,16 @@
 /**
  * @brief Maximum number of concurrent timers
  *
- * Range: 1 ~ 32
+ * Range: 1 ~ 32 (bitmap engine), 1 ~ 512 (wheel/heap engine, SAFETIMER_ENGINE)
  * Default: 4 timers (optimized for 176-byte RAM MCUs like SC8F072)
  *
  * RAM Impact (persistent, global variables):
- *   - Bitmap: 1 byte (MAX_TIMERS<=8) or 4 bytes (MAX_TIMERS>8)
+ *   - Bitmaps (used + active): 2 bytes (MAX_TIMERS<=8) or 8 bytes
+ *     (MAX_TIMERS>8)
+ *   - Earliest-deadline cache: 3 bytes (16-bit tick) or 5 bytes (32-bit)
  *   - Per timer slot: 13 bytes (32-bit tick) or 9 bytes (16-bit tick)
  * [Compressed]
- *   - Overhead: 2 bytes (s_processing + g_executing_handle)
+ *   - Overhead: 2 bytes (recursion guard + executing handle, per pool)
  *
  *   MAX_TIMERS=4:  56 bytes (32-bit) | 40 bytes (16-bit)  (Includes overhead)
  *   MAX_TIMERS=8:  108 bytes (32-bit) | 74 bytes (16-bit)
@@ -89,6 +91,134 @@
 #define MAX_TIMERS 4
 #endif
 
+/* ========== Scheduling Engine ========== */
+
+#define SAFETIMER_ENGINE_BITMAP 0 /**< Linear scan of the active bitmap */
+#define SAFETIMER_ENGINE_WHEEL 1  /**< Hashed timing wheel */
+#define SAFETIMER_ENGINE_HEAP 2   /**< Deadline-ordered binary min-heap */
+
+/**
+ * @brief Engine that tracks running timers for safetimer_process()
+ *
+ * SAFETIMER_ENGINE_BITMAP (default):
+ *   - Visits every running timer on each non-idle pass: O(running)
+ *   - MAX_TIMERS <= 32, no extra RAM
+ *
+ * SAFETIMER_ENGINE_WHEEL:
+ *   - Running timers are linked into SAFETIMER_WHEEL_SIZE buckets by
+ *     expire_time; a pass only walks the buckets of the ticks elapsed since
+ *     the previous pass (at most one full turn)
+ *   - O(1) start/stop/delete, pass cost ~ timers in the walked buckets
+ *   - MAX_TIMERS up to 512 (handles grow past 8 bits, still int)
+ *   - RAM: +2 links per timer, +1 link per bucket, +1 tick (cursor)
+ *
+ * SAFETIMER_ENGINE_HEAP:
+ *   - Running timers are kept in a binary min-heap keyed on expire_time
+ *     (wrap-safe order); a pass only looks at the root and pops due timers
+ *   - O(log n) start/stop/delete/set_period/advance_period, O(1)
+ *     safetimer_get_next_expiry(), exact ordering for any period mix
+ *   - MAX_TIMERS up to 512; suits ~32~256 timers with widely varying periods
+ *   - RAM: +2 slot indices per timer, +1 (heap size); the earliest-deadline
+ *     cache is replaced by the heap root
+ *
+ * Handle API and generation-based ABA protection are identical.
+ *
+ * @note safetimer_get_next_expiry() is O(running) with the wheel engine
+ *       (the wheel does not keep an exact earliest deadline)
+ * @note SAFETIMER_PROCESS_SNAPSHOT requires SAFETIMER_ENGINE_BITMAP
+ */
+#ifndef SAFETIMER_ENGINE
+#define SAFETIMER_ENGINE SAFETIMER_ENGINE_BITMAP
+#endif
+
+/**
+ * @brief Number of timing wheel buckets (wheel engine only)
+ *
+ * Range: 4 ~ 256, power of two (default: 64)
+ *
+ * One bucket per tick; timers further out than one turn share buckets and
+ * are skipped by a single compare until their turn comes. Choose about the
+ * typical period in ticks (or the pool size, whichever is smaller).
+ */
+#ifndef SAFETIMER_WHEEL_SIZE
+#define SAFETIMER_WHEEL_SIZE 64
+#endif
+
+/* ========== Multiple Pools ========== */
+
+/**
+ * @brief Per-pool critical section hooks (safetimer_pool_set_lock())
+ *
+ * 0 = Disabled (default): every pool uses bsp_enter/exit_critical()
+ * 1 = Enabled: a pool may install its own lock pair, e.g. a per-core
+ *     spinlock or the interrupt mask of the one ISR that touches the pool,
+ *     so independent pools do not contend on one global critical section
+ *
+ * RAM Impact: +2 function pointers per pool
+ * Flash Impact: one NULL check per critical section
+ *
+ * @note Additional pools (safetimer_pool_init(), safetimer_create_in(),
+ *       safetimer_process_pool()) are always available; the pool-less API
+ *       operates on a default pool
+ */
+#ifndef SAFETIMER_ENABLE_POOL_LOCK
+#define SAFETIMER_ENABLE_POOL_LOCK 0
+#endif
+
+/* ========== ISR Command Queue ========== */
+
+/**
+ * @brief Wait-free timer control from interrupts (*_from_isr() APIs)
+ *
+ * 0 = Disabled (default): ISRs call safetimer_start() etc. directly, which
+ *     masks interrupts through bsp_enter_critical()
+ * 1 = Enabled: safetimer_start/stop/set_period/delete_from_isr() push a
+ *     command into a per-pool single-producer ring; safetimer_process()
+ *     applies queued commands at the start of each pass
+ *
+ * RAM Impact: SAFETIMER_ISR_QUEUE_SIZE * (2 ticks + handle + 1) + 2 bytes
+ *             per pool (+1 pointer per entry with SAFETIMER_ENABLE_SEM_WAKE,
+ *             for safetimer_sem_wake_from_isr())
+ *
+ * @note Single producer: only ISRs that cannot preempt each other (one
+ *       priority level) may push into the same pool
+ * @note Start deadlines are based on the tick read in the ISR, not on the
+ *       time the command is applied
+ */
+#ifndef SAFETIMER_ENABLE_ISR_QUEUE
+#define SAFETIMER_ENABLE_ISR_QUEUE 0
+#endif
+
+/**
+ * @brief ISR command ring capacity (entries, power of two)
+ *
+ * Range: 2 ~ 128 (default: 8). One entry is kept free to tell a full ring
+ * from an empty one, so up to SIZE-1 commands can wait between two
+ * safetimer_process() passes.
+ */
+#ifndef SAFETIMER_ISR_QUEUE_SIZE
+#define SAFETIMER_ISR_QUEUE_SIZE 8
+#endif
+
+/**
+ * @brief Expiry detection in the tick ISR (safetimer_dispatch_ready())
+ *
+ * 0 = Disabled (default): the main loop polls with safetimer_process()
+ * 1 = Enabled: safetimer_isr_detect() (called by safetimer_tick_isr() of
+ *     the default BSP, or by a custom tick ISR) compares the tick against
+ *     the earliest-deadline cache and raises a per-pool ready flag;
+ *     safetimer_dispatch_ready() returns after one flag read until then
+ *
+ * RAM Impact: +1 byte per pool
+ * Detection latency: 1 tick (one short critical section per tick in the
+ * ISR; a stale cache counts as due and is rebuilt by the next dispatch)
+ *
+ * @note Callbacks still run in the main loop (safetimer_dispatch_ready())
+ */
+#ifndef SAFETIMER_ENABLE_ISR_DISPATCH
+#define SAFETIMER_ENABLE_ISR_DISPATCH 0
+#endif
+
 /* ========== Optional Query APIs ========== */
 
 /**
@@ -126,6 +256,83 @@
 #define ENABLE_QUERY_API 0 /* Default: disabled for minimal footprint */
 #endif
 
+/**
+ * @brief Enable timing statistics (safetimer_get_stats())
+ *
+ * 0 = Disabled (default): no statistics code or RAM
+ * 1 = Enabled: per timer fire count, periods coalesced by skip-mode
+ *     catch-up, last/max lateness and max callback duration; per pool the
+ *     longest process pass and the longest critical section
+ *
+ * RAM Impact: +20 bytes per timer (16 with 16-bit ticks), +8~12 per pool
+ * ROM Impact: ~300 bytes
+ *
+ * @note Durations are measured with bsp_get_ticks() unless
+ *       SAFETIMER_STATS_CYCLES=1
+ */
+#ifndef SAFETIMER_ENABLE_STATS
+#define SAFETIMER_ENABLE_STATS 0
+#endif
+
+/**
+ * @brief Measure statistics durations with a BSP cycle counter
+ *
+ * 0 = Disabled (default): callback and pass durations in ticks (ms);
+ *     critical sections are not timed (always far below one tick)
+ * 1 = Enabled: the BSP provides bsp_get_cycles() (e.g. DWT->CYCCNT on
+ *     Cortex-M3+), used for all durations including critical sections
+ *
+ * @note Requires SAFETIMER_ENABLE_STATS=1
+ */
+#ifndef SAFETIMER_STATS_CYCLES
+#define SAFETIMER_STATS_CYCLES 0
+#endif
+
+/**
+ * @brief Profile critical sections per call site and per public API
+ *
+ * 0 = Disabled (default): only the pool-wide longest critical section
+ * 1 = Enabled: every critical section of safetimer.c and of the semaphore
+ *     macros (safetimer_sem.h) keeps its own longest masked duration in
+ *     bsp_get_cycles() units (safetimer_crit_first_site()), and the
+ *     longest section seen while each public API group runs is kept too
+ *     (safetimer_get_crit_api_max()), so the interrupt latency budget can
+ *     be read back from the target instead of a logic analyzer
+ *
+ * RAM Impact: +16 bytes per critical section that has run (~50 sites),
+ *             +56 bytes
+ * ROM Impact: ~250 bytes, plus a file name and record per call site
+ *
+ * @note Requires SAFETIMER_STATS_CYCLES=1
+ * @note Requires SAFETIMER_ENABLE_POOL_LOCK=0: profiling times the one
+ *       BSP lock, so sections never nest or overlap
+ * @note A site registers on its first run: query after exercising the
+ *       paths of interest
+ */
+#ifndef SAFETIMER_ENABLE_CRIT_PROFILE
+#define SAFETIMER_ENABLE_CRIT_PROFILE 0
+#endif
+
+/**
+ * @brief Enable the binary event trace (safetimer_trace_attach())
+ *
+ * 0 = Disabled (default): no trace code
+ * 1 = Enabled: create/start/fire/late-fire/skip/stop/delete events are
+ *     appended to a RAM ring provided by the application (oldest records
+ *     are overwritten), decoded on the host by
+ *     scripts/safetimer_trace_decode.py
+ *
+ * RAM Impact: +4~8 bytes per pool, plus the application ring
+ *             (8 bytes per record, 6 with 16-bit ticks)
+ * ROM Impact: ~150 bytes
+ *
+ * @note Recording is a few stores inside critical sections that are
+ *       already taken; with no ring attached it is a single NULL check
+ */
+#ifndef SAFETIMER_ENABLE_TRACE
+#define SAFETIMER_ENABLE_TRACE 0
+#endif
+
 /* ========== Optional Helper APIs ========== */
 
 /**
@@ -138,9 +345,11 @@
  *   - safetimer_create_started()      (inline, ~0 bytes if unused)
  *   - safetimer_create_started_batch() (inline, ~0 bytes if unused)
  *   - SAFETIMER_CREATE_STARTED_OR()   (macro)
+ *   - safetimer_create_batch()        (safetimer.c, ~250 bytes)
  *
  * Flash Impact:
- *   These are inline functions/macros, only compiled if actually used.
+ *   The inline functions/macros are only compiled if actually used; the
+ *   atomic batch create is a core function in safetimer.c.
  *   Disabling removes declarations to prevent accidental usage.
  *
  * Use Cases:
@@ -156,18 +365,237 @@
 
 /* ========== REPEAT Timer Behavior ========== */
 
+#define SAFETIMER_CATCHUP_SKIP 0   /**< Coalesce missed periods silently */
+#define SAFETIMER_CATCHUP_BURST 1  /**< One callback per missed period */
+#define SAFETIMER_CATCHUP_REPORT 2 /**< Coalesce, report the missed count */
+
 /**
  * @brief Enable catch-up behavior for REPEAT timers
  *
- * 0 = Disabled (default): Skip missed intervals, single callback fires
- * 1 = Enabled: Fire callbacks for each missed interval (burst mode)
+ * 0 = SAFETIMER_CATCHUP_SKIP (default): Skip missed intervals, single
+ *     callback fires
+ * 1 = SAFETIMER_CATCHUP_BURST: Fire callbacks for each missed interval
+ *     (burst mode, one per safetimer_process() pass until caught up)
+ * 2 = SAFETIMER_CATCHUP_REPORT: Skip like 0, but the single callback can
+ *     read how many periods were coalesced with safetimer_get_missed_count()
+ *     (elapsed periods = missed + 1), so counters and integrators stay
+ *     exact without a callback storm
  *
- * Flash Impact: ~30 bytes
+ * Flash Impact: ~30 bytes (REPORT: ~40 bytes)
+ * RAM Impact (REPORT only): 4 bytes per pool (missed count of the running
+ * callback)
  *
  * @note Default DISABLED for deterministic CPU usage
+ * @note Callback signature is unchanged in all modes
  */
 #ifndef SAFETIMER_ENABLE_CATCHUP
-#define SAFETIMER_ENABLE_CATCHUP 0
+#define SAFETIMER_ENABLE_CATCHUP SAFETIMER_CATCHUP_SKIP
+#endif
+
+/**
+ * @brief Division-free catch-up for lagging timers
+ *
+ * Skip-mode REPEAT and safetimer_advance_period() compute how many periods
+ * were missed (lag / period). Without a hardware divider that 32-bit divide
+ * costs 50~150us on 8-bit MCUs.
+ *
+ * 0 = Always divide (for cores with a hardware divider, e.g. Cortex-M3+)
+ * N = Divide-free fast paths (default: 4):
+ *     - Power-of-two period: shift instead of divide
+ *     - Lag below N periods: repeated subtraction (at most N iterations)
+ *     - Larger lag: single divide of the remainder (rare, deep overrun)
+ *
+ * Range: 0 ~ 255
+ *
+ * Flash Impact: ~40 bytes
+ *
+ * @note Results are identical to plain division; skip semantics unchanged
+ */
+#ifndef SAFETIMER_CATCHUP_SUBTRACT_LIMIT
+#define SAFETIMER_CATCHUP_SUBTRACT_LIMIT 4
+#endif
+
+/* ========== Dispatch Strategy ========== */
+
+/**
+ * @brief Single-snapshot dispatch pass in safetimer_process()
+ *
+ * 0 = Per-slot (default): one short critical section per running slot, plus
+ *     the catch-up commit and TOCTOU re-check for each expired timer
+ * 1 = Snapshot: collect every due timer under ONE critical section, run
+ *     catch-up math outside it, commit all new expire times (with generation
+ *     validation) under a second critical section, then invoke callbacks
+ *
+ * Critical sections per pass (N running, K expired):
+ *   Per-slot: ~N + 2K + 2
+ *   Snapshot: 2
+ *
+ * Stack Impact (snapshot only):
+ *   SAFETIMER_SNAPSHOT_BATCH entries of ~12 bytes (8-bit, 16-bit ticks) to
+ *   ~32 bytes (64-bit host) each
+ *
+ * @note Masked time per critical section grows with N (loop over running
+ *       slots), so prefer 0 on 8-bit parts with tight ISR latency budgets
+ * @note Recommended for 32-bit cores where mask/unmask pairs dominate
+ */
+#ifndef SAFETIMER_PROCESS_SNAPSHOT
+#define SAFETIMER_PROCESS_SNAPSHOT 0
+#endif
+
+/**
+ * @brief Maximum expired timers collected per snapshot pass
+ *
+ * Range: 1 ~ MAX_TIMERS (default: MAX_TIMERS)
+ *
+ * Bounds the snapshot stack buffer. Timers beyond the batch stay due and are
+ * dispatched by the next safetimer_process() call.
+ */
+#ifndef SAFETIMER_SNAPSHOT_BATCH
+#define SAFETIMER_SNAPSHOT_BATCH MAX_TIMERS
+#endif
+
+/**
+ * @brief Bounded-work dispatch (safetimer_process_budget())
+ *
+ * 0 = Disabled (default): every safetimer_process() call dispatches all due
+ *     timers back to back
+ * 1 = Enabled: safetimer_process_budget() stops after a callback count or a
+ *     tick budget and the next call resumes at the first slot not yet
+ *     dispatched (no starvation of high slot indices)
+ *
+ * RAM Impact: +1~2 bytes per pool (resume cursor); the wheel and heap
+ * engines add a bitmap of due timers carried over to the next call
+ * (+BITMAP_WORDS words + 1 byte)
+ *
+ * @note Requires SAFETIMER_PROCESS_SNAPSHOT=0 (a snapshot batch is
+ *       committed as a whole)
+ */
+#ifndef SAFETIMER_ENABLE_PROCESS_BUDGET
+#define SAFETIMER_ENABLE_PROCESS_BUDGET 0
+#endif
+
+/**
+ * @brief Number of dispatch priority levels (safetimer_set_priority())
+ *
+ * 1 = Disabled (default): due timers are dispatched in slot index order
+ * 2~8 = Due timers of a higher level are dispatched first within each pass
+ *       (slot order within a level); new timers start at level 0
+ *
+ * RAM Impact: +(LEVELS-1) bitmaps per pool (one per level above 0)
+ *
+ * @note Combine with safetimer_process_budget() to keep critical timers
+ *       ahead of a burst of low-priority expiries
+ */
+#ifndef SAFETIMER_PRIORITY_LEVELS
+#define SAFETIMER_PRIORITY_LEVELS 1
+#endif
+
+/**
+ * @brief Enable per-timer slack (safetimer_set_slack())
+ *
+ * 0 = Disabled (default): every timer fires at its deadline
+ * 1 = Enabled: a timer with slack S may fire up to S ticks early, in a
+ *     pass that is already dispatching another timer's deadline. Timers
+ *     that tolerate some error (LED blink, sensor poll, housekeeping) then
+ *     share the wakeups of other timers instead of adding their own
+ *
+ * RAM Impact: +1 byte per timer, +1 bitmap per pool
+ * ROM Impact: ~150 bytes
+ *
+ * @note Requires SAFETIMER_ENGINE_BITMAP
+ * @note Never fires late: safetimer_get_next_expiry() still reports the
+ *       earliest deadline, the slack only widens what that wakeup fires
+ */
+#ifndef SAFETIMER_ENABLE_SLACK
+#define SAFETIMER_ENABLE_SLACK 0
+#endif
+
+/**
+ * @brief Event-driven semaphore waits (SAFETIMER_CORO_WAIT_SEM*)
+ *
+ * 0 = Disabled (default): a waiting coroutine polls the semaphore every
+ *     poll_ms and times out after timeout_count polls
+ * 1 = Enabled: the waiting coroutine registers its timer with the pool and
+ *     SAFETIMER_SEM_SIGNAL() triggers it (safetimer_trigger()), so it
+ *     resumes on the next pass. The timeout is one deadline of
+ *     poll_ms x timeout_count; WAIT_SEM_FOREVER re-checks every poll_ms
+ *
+ * RAM Impact: +1 pointer per timer, +1 bitmap per pool
+ * ROM Impact: ~200 bytes
+ *
+ * @note Requires SAFETIMER_ENABLE_CORO (waits on the default pool)
+ * @note SAFETIMER_SEM_SIGNAL() reads the tick and takes the pool lock (once
+ *       per bitmap word plus once per waiter): task context only. ISRs use
+ *       SAFETIMER_SEM_SIGNAL_FROM_ISR(), which needs
+ *       SAFETIMER_ENABLE_ISR_QUEUE (+1 pointer per ring entry)
+ */
+#ifndef SAFETIMER_ENABLE_SEM_WAKE
+#define SAFETIMER_ENABLE_SEM_WAKE 0
+#endif
+
+/**
+ * @brief Coroutine task scheduler (safetimer_sched_start())
+ *
+ * 0 = Disabled (default): each SAFETIMER_CORO_CONTEXT coroutine runs as
+ *     the callback of its own timer slot
+ * 1 = Enabled: a table of SAFETIMER_TASK_CONTEXT coroutines shares one
+ *     timer slot. Each task keeps only its resume point and wake tick, the
+ *     scheduler re-arms its timer for the earliest wake tick
+ *
+ * RAM Impact: 2 + sizeof(bsp_tick_t) bytes per task (vs. one timer slot),
+ *             + safetimer_sched_t per scheduler; the task table can be const
+ * ROM Impact: ~250 bytes
+ *
+ * @note Requires SAFETIMER_ENABLE_CORO and SAFETIMER_ENABLE_USER_DATA
+ * @note SAFETIMER_TASK_WAIT is phase-locked like SAFETIMER_CORO_WAIT
+ */
+#ifndef SAFETIMER_ENABLE_CORO_SCHED
+#define SAFETIMER_ENABLE_CORO_SCHED 0
+#endif
+
+/**
+ * @brief Callback-free flag timers (safetimer_create_flag())
+ *
+ * 0 = Disabled (default): every expiry calls the timer's callback
+ * 1 = Enabled: a flag timer's expiry only sets its slot bit in the pool's
+ *     expired bitmap, inside the critical section that re-arms it. The
+ *     main loop fetches and clears the bitmap with safetimer_poll_expired()
+ *
+ * A flag expiry skips the indirect call, the TOCTOU re-validation
+ * critical section and the executing handle bookkeeping of a callback.
+ *
+ * RAM Impact: +1 bitmap per pool (the flag mode uses a spare meta bit)
+ * ROM Impact: ~120 bytes
+ *
+ * @note Expiries of one timer between two polls collapse into one bit
+ * @note Flag timers leave their callback/user_data fields unused (NULL)
+ */
+#ifndef SAFETIMER_ENABLE_FLAG_TIMERS
+#define SAFETIMER_ENABLE_FLAG_TIMERS 0
+#endif
+
+/**
+ * @brief C11 atomics for the read side of safetimer_process()
+ *
+ * 0 = Disabled (default): every slot check runs under the pool lock
+ * 1 = Enabled: expire_time, active_bitmap and the earliest-deadline cache
+ *     are _Atomic (<stdatomic.h>). safetimer_process() checks the cache and
+ *     every running slot without locking and only takes the lock for slots
+ *     that are due (bitmap engine: idle passes take no lock at all)
+ *
+ * Critical sections per pass (N running, K expired, bitmap engine):
+ *   Disabled: ~N + 2K + 2 (1 while nothing is due)
+ *   Enabled:  ~3K + 2     (0 while nothing is due)
+ *
+ * @note Writers (start/stop/delete/set_period, dispatch) still use the pool
+ *       lock: bitmap, wheel and heap updates span several words. On SMP
+ *       parts install a cross-core lock with safetimer_pool_set_lock()
+ * @note Requires a C11 compiler with atomics (no __STDC_NO_ATOMICS__) and
+ *       lock-free atomics of bsp_tick_t / bitmap word size; intended for
+ *       32-bit cores (Cortex-M3+, RISC-V)
+ */
+#ifndef SAFETIMER_ENABLE_ATOMICS
+#define SAFETIMER_ENABLE_ATOMICS 0
 #endif
 
 /* ========== Parameter Validation ========== */
@@ -257,6 +685,116 @@
 #define SAFETIMER_BSP_IMPLEMENTATION 0 /* Default: user-provided */
 #endif
 
+/**
+ * @brief Tickless BSP mode (compare-match wakeup)
+ *
+ * 0 = Disabled (default): periodic tick interrupt
+ * 1 = Enabled: the tick interrupt may be stopped while idle
+ *     - safetimer_tickless_arm() programs the next deadline through the
+ *       user-provided bsp_set_wakeup() (hardware compare register)
+ *     - On wakeup, the slept ticks are credited in one step (default BSP:
+ *       safetimer_tick_advance(n)); the next safetimer_process() handles
+ *       the jump in one pass
+ *
+ * RAM Impact: 0 bytes
+ * ROM Impact: ~40 bytes (arm helper; default BSP: tick advance hook)
+ *
+ * @note bsp_set_wakeup() must be provided by the user (also with the
+ *       default BSP), see bsp.h
+ * @note Wheel engine: a jump of more than MAX_TIMERS ticks scans the
+ *       running slots instead of walking one bucket per elapsed tick
+ */
+#ifndef SAFETIMER_BSP_TICKLESS
+#define SAFETIMER_BSP_TICKLESS 0
+#endif
+
+/**
+ * @brief Tick unit in microseconds
+ *
+ * Duration of one bsp_get_ticks() count. SafeTimer itself only counts
+ * ticks: every period, delay and query result of the API is in ticks, and
+ * the "ms" in parameter names means ticks of this unit.
+ *
+ * 1000 = 1 ms tick (default, backward compatible)
+ * < 1000 = sub-millisecond tick, e.g. 10 for a free-running hardware
+ *          counter prescaled to 10 us (100~500 us periods, bit timing)
+ * > 1000 = coarse tick, e.g. 10000 for a 10 ms tick
+ *
+ * Period limits (ENABLE_PARAM_CHECK=1): 1 ~ SAFETIMER_MAX_PERIOD ticks
+ *   16-bit ticks: 65535 ticks (65.5 ms with a 1 us tick)
+ *   32-bit ticks: 2^31-1 ticks (~35.8 minutes with a 1 us tick)
+ *
+ * RAM Impact: 0 bytes
+ * ROM Impact: 0 bytes (SAFETIMER_MS_TO_TICKS()/SAFETIMER_US_TO_TICKS()
+ *             fold to constants)
+ *
+ * @note Reading a prescaled hardware counter in bsp_get_ticks() needs no
+ *       tick interrupt at all; see SAFETIMER_ENABLE_HW_COMPARE for firing
+ *       at the exact tick
+ */
+#ifndef SAFETIMER_TICK_US
+#define SAFETIMER_TICK_US 1000
+#endif
+
+/**
+ * @brief Hardware one-shot compare for the nearest deadline
+ *
+ * 0 = Disabled (default): expiry is seen by the next safetimer_process()
+ * 1 = Enabled: the earliest deadline is kept programmed in a hardware
+ *     compare register through the user-provided bsp_set_compare(); its
+ *     interrupt runs the pass at the deadline tick, so fire precision is
+ *     one tick without a tick ISR at that rate
+ *     - Bitmap engine: follows the earliest-deadline cache where it is
+ *       published, and any start/trigger/set_period moving it earlier
+ *     - Heap engine: follows the heap root
+ *     - No extra critical section or scan per pass
+ *
+ * RAM Impact: +3 (16-bit ticks) or +5 bytes per pool (armed deadline)
+ * ROM Impact: ~150 bytes
+ *
+ * @note Requires the bitmap or heap engine (the wheel engine does not
+ *       track its earliest deadline)
+ * @note Bitmap engine: a compare match for a deadline that went away
+ *       (stopped timer) only causes one empty pass, which re-programs it
+ */
+#ifndef SAFETIMER_ENABLE_HW_COMPARE
+#define SAFETIMER_ENABLE_HW_COMPARE 0
+#endif
+
+#define SAFETIMER_BSP_RTOS_NONE 0     /**< No RTOS adapter */
+#define SAFETIMER_BSP_RTOS_FREERTOS 1 /**< FreeRTOS adapter */
+#define SAFETIMER_BSP_RTOS_ZEPHYR 2   /**< Zephyr adapter */
+
+/**
+ * @brief RTOS BSP adapter with a blocking daemon task (bsp_rtos.h)
+ *
+ * SAFETIMER_BSP_RTOS_NONE (default): user BSP, the application calls
+ *     safetimer_process()
+ * SAFETIMER_BSP_RTOS_FREERTOS: src/bsp_rtos.c implements the BSP on the
+ *     kernel tick count and taskENTER_CRITICAL()/taskEXIT_CRITICAL()
+ * SAFETIMER_BSP_RTOS_ZEPHYR: kernel ticks (k_uptime_ticks()) and a
+ *     k_spinlock (SMP and ISR safe)
+ *
+ * safetimer_rtos_daemon() runs safetimer_process() and then blocks until
+ * the earliest deadline (safetimer_get_next_expiry()). A start, trigger
+ * or set_period from another task that moves the earliest deadline
+ * forward wakes it early (bsp_set_compare() hook, signalled after the
+ * critical section). Timer CPU cost follows the expirations, not a
+ * polling rate.
+ *
+ * RAM Impact: ~6 bytes (daemon handle, wake flag) + daemon stack
+ * ROM Impact: ~200 bytes
+ *
+ * @note Requires SAFETIMER_ENABLE_HW_COMPARE=1 and
+ *       SAFETIMER_BSP_IMPLEMENTATION=0; not with SAFETIMER_BSP_TICKLESS
+ *       (the RTOS owns the tick and its own tickless idle)
+ * @note The RTOS tick period must equal SAFETIMER_TICK_US
+ * @note The daemon serves the default pool only
+ */
+#ifndef SAFETIMER_BSP_RTOS
+#define SAFETIMER_BSP_RTOS SAFETIMER_BSP_RTOS_NONE
+#endif
+
 /* ========== Compiler Compatibility ========== */
 
 /**
@@ -302,6 +840,94 @@
 #define USE_BITFIELD_META 1
 #endif
 
+/**
+ * @brief Timer pool memory layout
+ *
+ * 0 = Array of structs (default): one timer_slot_t per timer
+ * 1 = Struct of arrays: expire_time[], meta[], period[], callback[],
+ *     user_data[] stored as separate arrays in the pool
+ *
+ * Benefits of 1:
+ * - Expiry scan in safetimer_process() touches only the expire_time[] array
+ *   (32 timers x 4 bytes = 2 cache lines on Cortex-M7 / A-class cores)
+ * - No per-slot struct padding (e.g. 16-bit ticks + 4-byte pointers)
+ *
+ * @note Same RAM on 8-bit targets (no padding there); API unaffected
+ */
+#ifndef SAFETIMER_POOL_SOA
+#define SAFETIMER_POOL_SOA 0
+#endif
+
+/**
+ * @brief Timers declared at build time in a ROM table
+ *
+ * 0 = Disabled (default): every timer is created at runtime
+ * N = Slots 0 ~ N-1 are static timers whose period, mode, callback and
+ *     user_data come from the const table the application defines with
+ *     SAFETIMER_STATIC_TABLE / SAFETIMER_STATIC_TIMER() (safetimer.h)
+ *
+ * Static timers need no safetimer_create(): their handles are the compile
+ * time constants SAFETIMER_STATIC_HANDLE(0 ~ N-1), valid from reset.
+ *
+ * RAM Impact: period[], callback[] and user_data[] shrink to
+ *             MAX_TIMERS - N entries (2 + 2 + 2 bytes per static timer
+ *             on SC8F072 with 16-bit ticks)
+ * ROM Impact: the table (same bytes, in flash) plus ~40 bytes of index
+ *             checks in the field accessors
+ *
+ * @note Requires SAFETIMER_POOL_SOA=1 (per-field arrays)
+ * @note Static timers cannot be deleted or change period
+ *       (TIMER_ERR_INVALID); start/stop/trigger and queries work as usual
+ * @note Every pool reserves slots 0 ~ N-1 for the same table, each with its
+ *       own running state
+ */
+#ifndef SAFETIMER_STATIC_TIMERS
+#define SAFETIMER_STATIC_TIMERS 0
+#endif
+
+/**
+ * @brief Prescaled compact timer slots for RAM-starved 8-bit targets
+ *
+ * 0 = Full slots (default): bsp_tick_t period and expire_time
+ * 1 = Compact: 8-bit period in SAFETIMER_COMPACT_PERIOD_UNIT ticks,
+ *     16-bit expire_time relative to the pool epoch
+ * 2 = Compact without user_data: as 1, and callbacks always receive NULL
+ *     (for SAFETIMER_ENABLE_USER_DATA=1 code that never uses it)
+ *
+ * Slot size on SC8F072 (2-byte pointers), 16-bit / 32-bit ticks:
+ *   0: 9 / 13 bytes   1: 8 bytes   2: 6 bytes
+ * MAX_TIMERS=8 pool (bitmap engine, SAFETIMER_ENABLE_CORO=0):
+ *   0: 79 / 113 bytes   2: 55 / 61 bytes (32-bit ticks add the epoch)
+ *
+ * With 32-bit ticks the slot stores the low 16 bits of its deadline; the
+ * full deadline is rebuilt against the pool epoch (the last deadline
+ * written), so running deadlines must stay within 32767 ticks of each
+ * other: a timer left late by more than 32767 - SAFETIMER_MAX_PERIOD
+ * ticks aliases, as with 16-bit ticks.
+ *
+ * @note SAFETIMER_MAX_PERIOD becomes 255 * SAFETIMER_COMPACT_PERIOD_UNIT;
+ *       periods must be multiples of the unit (ENABLE_PARAM_CHECK rejects
+ *       others, TIMER_ERR_INVALID / SAFETIMER_INVALID_HANDLE)
+ * @note 2 rejects non-NULL user_data (ENABLE_PARAM_CHECK), so it cannot
+ *       host safetimer_coro.h coroutines (their context is the user_data)
+ * @note Requires SAFETIMER_POOL_SOA=0, SAFETIMER_ENABLE_ATOMICS=0 and
+ *       SAFETIMER_ENABLE_CORO_SCHED=0 (arbitrary wake delays)
+ */
+#ifndef SAFETIMER_COMPACT_SLOTS
+#define SAFETIMER_COMPACT_SLOTS 0
+#endif
+
+/**
+ * @brief Period granularity of compact slots, in ticks
+ *
+ * Range: 1 ~ 128 (e.g. 10 at 1 ms ticks: periods 10 ms ~ 2.55 s)
+ *
+ * @note Only used with SAFETIMER_COMPACT_SLOTS
+ */
+#ifndef SAFETIMER_COMPACT_PERIOD_UNIT
+#define SAFETIMER_COMPACT_PERIOD_UNIT 10
+#endif
+
 /**
  * @brief Use stdint.h for integer types
  *
@@ -367,8 +993,26 @@ typedef signed long int32_t;
 #error "MAX_TIMERS must be >= 1"
 #endif
 
-#if MAX_TIMERS > 32
-#error "MAX_TIMERS must be <= 32 (bitmap limitation)"
+#if SAFETIMER_ENGINE != SAFETIMER_ENGINE_BITMAP &&                             \
+    SAFETIMER_ENGINE != SAFETIMER_ENGINE_WHEEL &&                              \
+    SAFETIMER_ENGINE != SAFETIMER_ENGINE_HEAP
+#error "SAFETIMER_ENGINE must be SAFETIMER_ENGINE_BITMAP, _WHEEL or _HEAP"
+#endif
+
+#if SAFETIMER_ENGINE == SAFETIMER_ENGINE_BITMAP && MAX_TIMERS > 32
+#error "MAX_TIMERS must be <= 32 (bitmap limitation, see SAFETIMER_ENGINE)"
+#endif
+
+#if MAX_TIMERS > 512
+#error "MAX_TIMERS must be <= 512 (handle encoding limitation)"
+#endif
+
+/* Validate SAFETIMER_WHEEL_SIZE */
+#if SAFETIMER_ENGINE == SAFETIMER_ENGINE_WHEEL
+#if SAFETIMER_WHEEL_SIZE < 4 || SAFETIMER_WHEEL_SIZE > 256 ||                  \
+    (SAFETIMER_WHEEL_SIZE & (SAFETIMER_WHEEL_SIZE - 1)) != 0
+#error "SAFETIMER_WHEEL_SIZE must be a power of two in 4 ~ 256"
+#endif
 #endif
 
 /* Validate ENABLE_PARAM_CHECK */
@@ -376,11 +1020,64 @@ typedef signed long int32_t;
 #error "ENABLE_PARAM_CHECK must be 0 or 1"
 #endif
 
+/* Validate SAFETIMER_ENABLE_ISR_QUEUE */
+#if SAFETIMER_ENABLE_ISR_QUEUE != 0 && SAFETIMER_ENABLE_ISR_QUEUE != 1
+#error "SAFETIMER_ENABLE_ISR_QUEUE must be 0 or 1"
+#endif
+
+/* Validate SAFETIMER_ISR_QUEUE_SIZE */
+#if SAFETIMER_ISR_QUEUE_SIZE < 2 || SAFETIMER_ISR_QUEUE_SIZE > 128 ||          \
+    (SAFETIMER_ISR_QUEUE_SIZE & (SAFETIMER_ISR_QUEUE_SIZE - 1)) != 0
+#error "SAFETIMER_ISR_QUEUE_SIZE must be a power of two in 2 ~ 128"
+#endif
+
+/* Validate SAFETIMER_ENABLE_ISR_DISPATCH */
+#if SAFETIMER_ENABLE_ISR_DISPATCH != 0 && SAFETIMER_ENABLE_ISR_DISPATCH != 1
+#error "SAFETIMER_ENABLE_ISR_DISPATCH must be 0 or 1"
+#endif
+
+/* Validate SAFETIMER_ENABLE_POOL_LOCK */
+#if SAFETIMER_ENABLE_POOL_LOCK != 0 && SAFETIMER_ENABLE_POOL_LOCK != 1
+#error "SAFETIMER_ENABLE_POOL_LOCK must be 0 or 1"
+#endif
+
 /* Validate ENABLE_QUERY_API */
 #if ENABLE_QUERY_API != 0 && ENABLE_QUERY_API != 1
 #error "ENABLE_QUERY_API must be 0 or 1"
 #endif
 
+/* Validate SAFETIMER_ENABLE_STATS */
+#if SAFETIMER_ENABLE_STATS != 0 && SAFETIMER_ENABLE_STATS != 1
+#error "SAFETIMER_ENABLE_STATS must be 0 or 1"
+#endif
+
+/* Validate SAFETIMER_STATS_CYCLES */
+#if SAFETIMER_STATS_CYCLES != 0 && SAFETIMER_STATS_CYCLES != 1
+#error "SAFETIMER_STATS_CYCLES must be 0 or 1"
+#endif
+
+#if SAFETIMER_STATS_CYCLES && !SAFETIMER_ENABLE_STATS
+#error "SAFETIMER_STATS_CYCLES requires SAFETIMER_ENABLE_STATS=1"
+#endif
+
+/* Validate SAFETIMER_ENABLE_CRIT_PROFILE */
+#if SAFETIMER_ENABLE_CRIT_PROFILE != 0 && SAFETIMER_ENABLE_CRIT_PROFILE != 1
+#error "SAFETIMER_ENABLE_CRIT_PROFILE must be 0 or 1"
+#endif
+
+#if SAFETIMER_ENABLE_CRIT_PROFILE && !SAFETIMER_STATS_CYCLES
+#error "SAFETIMER_ENABLE_CRIT_PROFILE requires SAFETIMER_STATS_CYCLES=1"
+#endif
+
+#if SAFETIMER_ENABLE_CRIT_PROFILE && SAFETIMER_ENABLE_POOL_LOCK
+#error "SAFETIMER_ENABLE_CRIT_PROFILE requires SAFETIMER_ENABLE_POOL_LOCK=0"
+#endif
+
+/* Validate SAFETIMER_ENABLE_TRACE */
+#if SAFETIMER_ENABLE_TRACE != 0 && SAFETIMER_ENABLE_TRACE != 1
+#error "SAFETIMER_ENABLE_TRACE must be 0 or 1"
+#endif
+
 /* Validate ENABLE_HELPER_API */
 #if ENABLE_HELPER_API != 0 && ENABLE_HELPER_API != 1
 #error "ENABLE_HELPER_API must be 0 or 1"
@@ -406,6 +1103,150 @@ typedef signed long int32_t;
 #error "SAFETIMER_REPEAT_ONLY must be 0 or 1"
 #endif
 
+/* Validate SAFETIMER_ENABLE_CATCHUP */
+#if SAFETIMER_ENABLE_CATCHUP < SAFETIMER_CATCHUP_SKIP ||                       \
+    SAFETIMER_ENABLE_CATCHUP > SAFETIMER_CATCHUP_REPORT
+#error "SAFETIMER_ENABLE_CATCHUP must be 0 (skip), 1 (burst) or 2 (report)"
+#endif
+
+/* Validate SAFETIMER_CATCHUP_SUBTRACT_LIMIT */
+#if SAFETIMER_CATCHUP_SUBTRACT_LIMIT < 0 ||                                    \
+    SAFETIMER_CATCHUP_SUBTRACT_LIMIT > 255
+#error "SAFETIMER_CATCHUP_SUBTRACT_LIMIT must be 0 ~ 255"
+#endif
+
+/* Validate SAFETIMER_POOL_SOA */
+#if SAFETIMER_POOL_SOA != 0 && SAFETIMER_POOL_SOA != 1
+#error "SAFETIMER_POOL_SOA must be 0 or 1"
+#endif
+
+/* Validate SAFETIMER_PROCESS_SNAPSHOT */
+#if SAFETIMER_PROCESS_SNAPSHOT != 0 && SAFETIMER_PROCESS_SNAPSHOT != 1
+#error "SAFETIMER_PROCESS_SNAPSHOT must be 0 or 1"
+#endif
+
+#if SAFETIMER_PROCESS_SNAPSHOT && SAFETIMER_ENGINE != SAFETIMER_ENGINE_BITMAP
+#error "SAFETIMER_PROCESS_SNAPSHOT requires SAFETIMER_ENGINE_BITMAP"
+#endif
+
+/* Validate SAFETIMER_SNAPSHOT_BATCH */
+#if SAFETIMER_SNAPSHOT_BATCH < 1 || SAFETIMER_SNAPSHOT_BATCH > MAX_TIMERS
+#error "SAFETIMER_SNAPSHOT_BATCH must be 1 ~ MAX_TIMERS"
+#endif
+
+/* Validate SAFETIMER_ENABLE_ATOMICS */
+#if SAFETIMER_ENABLE_ATOMICS != 0 && SAFETIMER_ENABLE_ATOMICS != 1
+#error "SAFETIMER_ENABLE_ATOMICS must be 0 or 1"
+#endif
+
+#if SAFETIMER_ENABLE_ATOMICS &&                                                \
+    (!defined(__STDC_VERSION__) || __STDC_VERSION__ < 201112L ||               \
+     defined(__STDC_NO_ATOMICS__))
+#error "SAFETIMER_ENABLE_ATOMICS requires a C11 compiler with <stdatomic.h>"
+#endif
+
+/* Validate SAFETIMER_PRIORITY_LEVELS */
+#if SAFETIMER_PRIORITY_LEVELS < 1 || SAFETIMER_PRIORITY_LEVELS > 8
+#error "SAFETIMER_PRIORITY_LEVELS must be 1 ~ 8"
+#endif
+
+/* Validate SAFETIMER_ENABLE_SLACK */
+#if SAFETIMER_ENABLE_SLACK != 0 && SAFETIMER_ENABLE_SLACK != 1
+#error "SAFETIMER_ENABLE_SLACK must be 0 or 1"
+#endif
+
+#if SAFETIMER_ENABLE_SLACK && SAFETIMER_ENGINE != SAFETIMER_ENGINE_BITMAP
+#error "SAFETIMER_ENABLE_SLACK requires SAFETIMER_ENGINE_BITMAP"
+#endif
+
+/* Validate SAFETIMER_ENABLE_SEM_WAKE */
+#if SAFETIMER_ENABLE_SEM_WAKE != 0 && SAFETIMER_ENABLE_SEM_WAKE != 1
+#error "SAFETIMER_ENABLE_SEM_WAKE must be 0 or 1"
+#endif
+
+#if SAFETIMER_ENABLE_SEM_WAKE && !SAFETIMER_ENABLE_CORO
+#error "SAFETIMER_ENABLE_SEM_WAKE requires SAFETIMER_ENABLE_CORO"
+#endif
+
+/* Validate SAFETIMER_ENABLE_CORO_SCHED */
+#if SAFETIMER_ENABLE_CORO_SCHED != 0 && SAFETIMER_ENABLE_CORO_SCHED != 1
+#error "SAFETIMER_ENABLE_CORO_SCHED must be 0 or 1"
+#endif
+
+#if SAFETIMER_ENABLE_CORO_SCHED &&                                             \
+    (!SAFETIMER_ENABLE_CORO || !SAFETIMER_ENABLE_USER_DATA)
+#error "SAFETIMER_ENABLE_CORO_SCHED requires CORO and USER_DATA enabled"
+#endif
+
+/* Validate SAFETIMER_BSP_TICKLESS */
+#if SAFETIMER_BSP_TICKLESS != 0 && SAFETIMER_BSP_TICKLESS != 1
+#error "SAFETIMER_BSP_TICKLESS must be 0 or 1"
+#endif
+
+/* Validate SAFETIMER_TICK_US */
+#if SAFETIMER_TICK_US < 1 || SAFETIMER_TICK_US > 1000000
+#error "SAFETIMER_TICK_US must be 1 ~ 1000000 (microseconds per tick)"
+#endif
+
+/* Validate SAFETIMER_ENABLE_HW_COMPARE */
+#if SAFETIMER_ENABLE_HW_COMPARE != 0 && SAFETIMER_ENABLE_HW_COMPARE != 1
+#error "SAFETIMER_ENABLE_HW_COMPARE must be 0 or 1"
+#endif
+
+#if SAFETIMER_ENABLE_HW_COMPARE && SAFETIMER_ENGINE == SAFETIMER_ENGINE_WHEEL
+#error "SAFETIMER_ENABLE_HW_COMPARE requires the bitmap or heap engine"
+#endif
+
+/* Validate SAFETIMER_BSP_RTOS */
+#if SAFETIMER_BSP_RTOS < SAFETIMER_BSP_RTOS_NONE ||                            \
+    SAFETIMER_BSP_RTOS > SAFETIMER_BSP_RTOS_ZEPHYR
+#error "SAFETIMER_BSP_RTOS must be SAFETIMER_BSP_RTOS_NONE/FREERTOS/ZEPHYR"
+#endif
+
+#if SAFETIMER_BSP_RTOS != SAFETIMER_BSP_RTOS_NONE &&                           \
+    (!SAFETIMER_ENABLE_HW_COMPARE || SAFETIMER_BSP_IMPLEMENTATION != 0 ||      \
+     SAFETIMER_BSP_TICKLESS)
+#error "SAFETIMER_BSP_RTOS needs HW_COMPARE=1, BSP_IMPLEMENTATION=0, TICKLESS=0"
+#endif
+
+/* Validate SAFETIMER_ENABLE_FLAG_TIMERS */
+#if SAFETIMER_ENABLE_FLAG_TIMERS != 0 && SAFETIMER_ENABLE_FLAG_TIMERS != 1
+#error "SAFETIMER_ENABLE_FLAG_TIMERS must be 0 or 1"
+#endif
+
+/* Validate SAFETIMER_STATIC_TIMERS */
+#if SAFETIMER_STATIC_TIMERS < 0 || SAFETIMER_STATIC_TIMERS >= MAX_TIMERS
+#error "SAFETIMER_STATIC_TIMERS must be 0 ~ MAX_TIMERS-1"
+#endif
+
+#if SAFETIMER_STATIC_TIMERS > 0 && !SAFETIMER_POOL_SOA
+#error "SAFETIMER_STATIC_TIMERS requires SAFETIMER_POOL_SOA=1"
+#endif
+
+/* Validate SAFETIMER_COMPACT_SLOTS */
+#if SAFETIMER_COMPACT_SLOTS < 0 || SAFETIMER_COMPACT_SLOTS > 2
+#error "SAFETIMER_COMPACT_SLOTS must be 0, 1 or 2"
+#endif
+
+#if SAFETIMER_COMPACT_PERIOD_UNIT < 1 || SAFETIMER_COMPACT_PERIOD_UNIT > 128
+#error "SAFETIMER_COMPACT_PERIOD_UNIT must be 1 ~ 128 ticks"
+#endif
+
+#if SAFETIMER_COMPACT_SLOTS &&                                                 \
+    (SAFETIMER_POOL_SOA || SAFETIMER_ENABLE_ATOMICS ||                         \
+     SAFETIMER_ENABLE_CORO_SCHED)
+#error "SAFETIMER_COMPACT_SLOTS needs POOL_SOA=0, ATOMICS=0, CORO_SCHED=0"
+#endif
+
+/* Validate SAFETIMER_ENABLE_PROCESS_BUDGET */
+#if SAFETIMER_ENABLE_PROCESS_BUDGET != 0 && SAFETIMER_ENABLE_PROCESS_BUDGET != 1
+#error "SAFETIMER_ENABLE_PROCESS_BUDGET must be 0 or 1"
+#endif
+
+#if SAFETIMER_ENABLE_PROCESS_BUDGET && SAFETIMER_PROCESS_SNAPSHOT
+#error "SAFETIMER_ENABLE_PROCESS_BUDGET requires SAFETIMER_PROCESS_SNAPSHOT=0"
+#endif
+
 /* ========== Configuration Summary ========== */
 
 /**
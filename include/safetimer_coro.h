@@ -17,6 +17,8 @@
  * - Extends coro_base.h with timer handle binding
  * - Automatic handle binding (no manual assignment needed)
  * - Zero-drift WAIT via safetimer_advance_period()
+ * - Optional task scheduler: many coroutines on one timer slot
+ *   (SAFETIMER_ENABLE_CORO_SCHED, SAFETIMER_TASK_*)
  * - Backward compatible with existing code
  *
  * ## Usage Pattern:
@@ -157,6 +159,8 @@
  *
  * @note Blocks coroutine until condition is met
  * @note If condition never becomes true, coroutine never advances
+ * @note Code that makes cond true can call safetimer_trigger() on the
+ *       coroutine's timer to resume it on the next pass, before its poll
  *
  * @par Example:
  * @code
@@ -191,6 +195,88 @@
  */
 #define SAFETIMER_CORO_EXIT() CORO_EXIT()
 
+#if SAFETIMER_ENABLE_CORO_SCHED
+/* ========== Scheduler Tasks (safetimer_sched_start()) ========== */
+
+/**
+ * @brief Scheduler task context base (embed as FIRST member)
+ *
+ * Same layout as safetimer_task_ctx_t. Unlike SAFETIMER_CORO_CONTEXT the
+ * task owns no timer slot: all tasks of a safetimer_sched_t share one.
+ *
+ * @par Memory Cost:
+ * - 2 bytes (_coro_lc) + sizeof(bsp_tick_t) (_task_wake)
+ *
+ * @par Example:
+ * @code
+ * typedef struct {
+ *     SAFETIMER_TASK_CONTEXT;
+ *     int count;
+ * } blink_ctx_t;
+ *
+ * void blink_task(void *arg) {
+ *     blink_ctx_t *ctx = (blink_ctx_t *)arg;
+ *     SAFETIMER_TASK_BEGIN(ctx);
+ *     while (1) {
+ *         led_toggle();
+ *         SAFETIMER_TASK_WAIT(500);  // Zero-drift, like SAFETIMER_CORO_WAIT
+ *     }
+ *     SAFETIMER_TASK_END();
+ * }
+ * @endcode
+ */
+#define SAFETIMER_TASK_CONTEXT                                                 \
+  CORO_CONTEXT;                                                                \
+  bsp_tick_t _task_wake
+
+/**
+ * @brief Begin scheduler task body (no handle binding needed)
+ */
+#define SAFETIMER_TASK_BEGIN(ctx) CORO_BEGIN(ctx)
+
+/**
+ * @brief End scheduler task body
+ */
+#define SAFETIMER_TASK_END() CORO_END()
+
+/**
+ * @brief Yield, run again on the next scheduler tick
+ */
+#define SAFETIMER_TASK_YIELD() CORO_YIELD()
+
+/**
+ * @brief Wait for specified milliseconds (zero-drift timing)
+ *
+ * Advances the task's wake tick by `ms` from its previous wake tick
+ * (safetimer_task_advance()) and yields.
+ *
+ * @param ms Delay time in milliseconds (1 ~ 2^31-1)
+ */
+#define SAFETIMER_TASK_WAIT(ms)                                                \
+  do {                                                                         \
+    (void)safetimer_task_advance((ctx), (ms));                                 \
+    (ctx)->_coro_lc = __LINE__;                                                \
+    return;                                                                    \
+  case __LINE__:;                                                              \
+  } while (0)
+
+/**
+ * @brief Wait until condition is true, checked every poll_ms
+ *
+ * @param cond Condition expression (evaluated each poll)
+ * @param poll_ms Polling interval in milliseconds
+ */
+#define SAFETIMER_TASK_WAIT_UNTIL(cond, poll_ms)                               \
+  do {                                                                         \
+    (ctx)->_coro_lc = __LINE__;                                                \
+  case __LINE__:                                                               \
+    if (!(cond)) {                                                             \
+      (void)safetimer_task_advance((ctx), (poll_ms));                          \
+      return;                                                                  \
+    }                                                                          \
+  } while (0)
+#endif /* SAFETIMER_ENABLE_CORO_SCHED */
+
 /* ========== Coroutine Helper Functions ========== */
 
 /**
@@ -0,0 +1,335 @@
+/**
+ * @file    safetimer_pool.h
+ * @brief   SafeTimer timer pool layout (safetimer_pool_t)
+ * @version 1.2.6
+ * @date    2026-10-14
+ * @author  SafeTimer Project
+ * @license MIT
+ *
+ * Exposes the pool structure so applications can allocate additional pools
+ * (safetimer_pool_init() / safetimer_create_in() / safetimer_process_pool()).
+ *
+ * @warning Fields are internal: never access them directly, the layout
+ *          changes with the configuration in safetimer_config.h
+ *
+ * @note Included by safetimer.h, do not include directly
+ */
+
+#ifndef SAFETIMER_POOL_H
+#define SAFETIMER_POOL_H
+
+/* ========== Internal Pool Types ========== */
+
+/* Qualifier of fields read without the pool lock (SAFETIMER_ENABLE_ATOMICS) */
+#if SAFETIMER_ENABLE_ATOMICS
+#include <stdatomic.h>
+#define SAFETIMER_ATOMIC _Atomic
+#else
+#define SAFETIMER_ATOMIC
+#endif
+
+/* Slot index type (uint16_t only for pools above 255 timers) */
+#if MAX_TIMERS <= 255
+typedef uint8_t slot_index_t;
+#else
+typedef uint16_t slot_index_t;
+#endif
+
+/* Handle index/generation bits (handle encoding, SAFETIMER_STATIC_HANDLE()) */
+#if MAX_TIMERS <= 2
+#define HANDLE_INDEX_BITS 1
+#elif MAX_TIMERS <= 4
+#define HANDLE_INDEX_BITS 2
+#elif MAX_TIMERS <= 8
+#define HANDLE_INDEX_BITS 3
+#elif MAX_TIMERS <= 16
+#define HANDLE_INDEX_BITS 4
+#elif MAX_TIMERS <= 32
+#define HANDLE_INDEX_BITS 5
+#elif MAX_TIMERS <= 64
+#define HANDLE_INDEX_BITS 6
+#elif MAX_TIMERS <= 128
+#define HANDLE_INDEX_BITS 7
+#elif MAX_TIMERS <= 256
+#define HANDLE_INDEX_BITS 8
+#else
+#define HANDLE_INDEX_BITS 9
+#endif
+
+/* Derive generation bits */
+/* CRITICAL: Must cap GEN_BITS at 6 to fit in uint8_t meta with mode+flag */
+#if HANDLE_INDEX_BITS <= 5
+#define RAW_GEN_BITS (8 - HANDLE_INDEX_BITS)
+#else
+/* MAX_TIMERS > 32 (wheel engine): handle grows past 8 bits, int holds 15 */
+#define RAW_GEN_BITS 6
+#endif
+#define HANDLE_GEN_BITS (RAW_GEN_BITS > 6 ? 6 : RAW_GEN_BITS)
+#define HANDLE_GEN_MAX ((1 << HANDLE_GEN_BITS) - 1)
+
+/* Compressed per-slot state: mode(1) + generation(6) */
+#if USE_BITFIELD_META
+/* C Bitfields: Cleaner syntax, but compiler-dependent order */
+typedef struct {
+  uint8_t flag : 1; /* Flag timer (formerly active, now in active_bitmap) */
+  uint8_t mode : 1;
+  uint8_t generation : 6;
+} timer_meta_t;
+#else
+/* Manual Masking: Layout [gen:6][mode:1][flag:1] */
+typedef uint8_t timer_meta_t;
+#endif
+
+#if SAFETIMER_COMPACT_SLOTS
+/**
+ * @brief Compact timer slot (SAFETIMER_COMPACT_SLOTS)
+ *
+ * Memory layout (8-bit MCU, 2-byte pointers):
+ *   callback:        2 bytes (function pointer)
+ *   user_data:       2 bytes (SAFETIMER_COMPACT_SLOTS=1 only)
+ *   expire_time:     2 bytes (low 16 bits, rebuilt against pool epoch)
+ *   period:          1 byte  (SAFETIMER_COMPACT_PERIOD_UNIT ticks)
+ *   meta:            1 byte
+ *   TOTAL:           8 bytes/timer (6 bytes without user_data)
+ */
+typedef struct {
+  timer_callback_t callback; /**< User callback function (can be NULL) */
+#if SAFETIMER_ENABLE_USER_DATA && SAFETIMER_COMPACT_SLOTS == 1
+  void *user_data; /**< User data passed to callback */
+#endif
+  uint16_t expire_time; /**< Deadline, low 16 bits */
+  uint8_t period;       /**< Period in SAFETIMER_COMPACT_PERIOD_UNIT ticks */
+  timer_meta_t meta;    /**< Compressed state: mode(1)+gen(6) */
+} timer_slot_t;
+#elif !SAFETIMER_POOL_SOA
+/**
+ * @brief Timer slot structure (13 bytes per timer with meta compression)
+ *
+ * Memory layout (8-bit MCU, 2-byte pointers):
+ *   period:          4 bytes (uint32_t)
+ *   expire_time:     4 bytes (uint32_t / bsp_tick_t)
+ *   callback:        2 bytes (function pointer)
+ *   user_data:       2 bytes (void pointer)
+ *   meta:            1 byte  (mode:1 + generation:6, active bit moved to
+ *                    safetimer_pool_t.active_bitmap)
+ *   TOTAL:          13 bytes/timer (11 bytes w/ 16-bit ticks)
+ */
+typedef struct {
+  bsp_tick_t period;      /**< Timer period in milliseconds */
+  SAFETIMER_ATOMIC bsp_tick_t expire_time; /**< Expiration timestamp */
+  timer_callback_t callback; /**< User callback function (can be NULL) */
+#if SAFETIMER_ENABLE_USER_DATA
+  void *user_data; /**< User data passed to callback */
+#endif
+  timer_meta_t meta; /**< Compressed state: mode(1)+gen(6) */
+} timer_slot_t;
+#endif /* !SAFETIMER_POOL_SOA */
+
+/**
+ * @brief Bitmap type selection based on MAX_TIMERS
+ *
+ * Automatically selects the smallest type that can hold MAX_TIMERS bits:
+ * - MAX_TIMERS <= 8:  uint8_t  (saves 3 bytes RAM)
+ * - MAX_TIMERS <= 32: uint32_t (supports more timers)
+ * - MAX_TIMERS > 32:  array of uint32_t words (wheel/heap engine)
+ *
+ * Bitmaps are always stored as BITMAP_WORDS-sized arrays; with
+ * MAX_TIMERS <= 32 that is a single word and the word loops fold away.
+ */
+#if MAX_TIMERS <= 8
+typedef uint8_t safetimer_bitmap_t;
+#define BITMAP_ONE 1U
+#define BITMAP_WORD_BITS 8
+#else
+typedef uint32_t safetimer_bitmap_t;
+#define BITMAP_ONE 1UL
+#define BITMAP_WORD_BITS 32
+#endif
+
+#define BITMAP_WORDS ((MAX_TIMERS + BITMAP_WORD_BITS - 1) / BITMAP_WORD_BITS)
+
+#if SAFETIMER_ENGINE == SAFETIMER_ENGINE_WHEEL
+/**
+ * @brief Timing wheel link (wheel engine only)
+ *
+ * Encoding (0 so that the zero-initialized pool is an empty wheel):
+ *   0                          = none (end of list / not linked)
+ *   1 ~ MAX_TIMERS             = slot (index + 1)
+ *   MAX_TIMERS + 1 + bucket    = bucket head (wheel_prev of a first node)
+ */
+#if MAX_TIMERS + SAFETIMER_WHEEL_SIZE <= 255
+typedef uint8_t wheel_link_t;
+#else
+typedef uint16_t wheel_link_t;
+#endif
+#endif /* SAFETIMER_ENGINE_WHEEL */
+
+#if SAFETIMER_ENABLE_ISR_QUEUE
+/**
+ * @brief Queued ISR command (*_from_isr() APIs)
+ *
+ * Written by the ISR before it publishes isr_head, read by
+ * safetimer_process() before it releases the entry through isr_tail.
+ */
+typedef struct {
+  safetimer_handle_t handle; /**< Target timer */
+  bsp_tick_t tick;           /**< bsp_get_ticks() in the ISR */
+  bsp_tick_t period;         /**< New period (set_period only) */
+  uint8_t op;                /**< ISR_CMD_* operation */
+#if SAFETIMER_ENABLE_SEM_WAKE
+  const volatile void *sem; /**< Semaphore (sem_wake only) */
+#endif
+} safetimer_isr_cmd_t;
+#endif
+
+/**
+ * @brief Timer pool structure
+ *
+ * Memory layout:
+ *   slots:           MAX_TIMERS * 13 bytes (timer_slot_t array)
+ *   used_bitmap:     1 or 4 bytes (depends on MAX_TIMERS)
+ *   active_bitmap:   1 or 4 bytes (depends on MAX_TIMERS)
+ *   next_generation: 1 byte (uint8_t, global generation counter)
+ *   next_expiry:     2 or 4 bytes (bsp_tick_t, earliest-deadline cache)
+ *   expiry_state:    1 byte (EXPIRY_CACHE_* state)
+ *   processing:      1 byte (recursion guard)
+ *   executing_handle: sizeof(int) (SAFETIMER_ENABLE_CORO only)
+ *   executing_missed: 4 bytes (SAFETIMER_CATCHUP_REPORT only)
+ *
+ * For MAX_TIMERS=4:  4*13 + 1 + 1 = 54 bytes (was 62)
+ * For MAX_TIMERS=8:  8*13 + 1 + 1 = 106 bytes (was 122)
+ * For MAX_TIMERS=16: 16*13 + 4 + 1 = 213 bytes (was 245)
+ *
+ * Wheel engine adds wheel_head[SAFETIMER_WHEEL_SIZE], wheel_next/prev[]
+ * (1 or 2 bytes per entry) and wheel_cursor.
+ *
+ * Heap engine drops next_expiry/expiry_state (the heap root is the earliest
+ * deadline) and adds heap[], heap_pos[] and heap_size (slot_index_t each).
+ *
+ * With SAFETIMER_POOL_SOA=1 the slot fields are stored as parallel arrays
+ * (same total, minus per-slot struct padding). expire_time[] comes first so
+ * the dispatch scan reads a contiguous block of deadlines only.
+ * SAFETIMER_STATIC_TIMERS drops period[], callback[] and user_data[] for
+ * the static slots (read from the ROM table instead).
+ * SAFETIMER_COMPACT_SLOTS shrinks each slot to 8 or 6 bytes and adds the
+ * deadline epoch (bsp_tick_t, 32-bit ticks only).
+ *
+ * SAFETIMER_ENABLE_POOL_LOCK adds two function pointers (per-pool lock).
+ * SAFETIMER_ENABLE_ATOMICS makes expire_time, active_bitmap and the cache
+ * fields _Atomic (same size on the supported 32-bit targets).
+ * SAFETIMER_ENABLE_ISR_QUEUE adds the ISR command ring and its two indices
+ * (plus one pointer per ring entry with SAFETIMER_ENABLE_SEM_WAKE).
+ * SAFETIMER_ENABLE_ISR_DISPATCH adds the ready flag (1 byte).
+ * SAFETIMER_ENABLE_HW_COMPARE adds the programmed compare deadline and its
+ * armed flag.
+ * SAFETIMER_PRIORITY_LEVELS > 1 adds one bitmap per level above 0.
+ * SAFETIMER_ENABLE_SLACK adds slack[] (1 byte per slot) and a bitmap of
+ * the slots with non-zero slack.
+ * SAFETIMER_ENABLE_SEM_WAKE adds sem_wait[] (one pointer per slot) and a
+ * bitmap of the slots waiting on a semaphore.
+ * SAFETIMER_ENABLE_FLAG_TIMERS adds the bitmap of unpolled flag expiries.
+ * SAFETIMER_ENABLE_STATS adds stats[] (safetimer_stats_t per slot) and the
+ * pool-wide stats (plus the critical section start with cycle counting).
+ * SAFETIMER_ENABLE_TRACE adds the trace ring pointer, mask and head.
+ * SAFETIMER_ENABLE_PROCESS_BUDGET adds resume_cursor (plus resume_due[] and
+ * resume_pending with the wheel/heap engines, whose due timers are already
+ * unlinked when a budgeted pass stops).
+ *
+ * A zero-initialized pool (static storage) is a valid empty pool.
+ */
+typedef struct {
+#if SAFETIMER_POOL_SOA
+  SAFETIMER_ATOMIC bsp_tick_t expire_time[MAX_TIMERS]; /**< Deadlines (hot) */
+  timer_meta_t meta[MAX_TIMERS];         /**< Compressed state: mode+gen */
+  /* Runtime slots only (static slots read safetimer_static_table) */
+  bsp_tick_t period[MAX_TIMERS - SAFETIMER_STATIC_TIMERS]; /**< Periods */
+  timer_callback_t
+      callback[MAX_TIMERS - SAFETIMER_STATIC_TIMERS]; /**< Can be NULL */
+#if SAFETIMER_ENABLE_USER_DATA
+  void *user_data[MAX_TIMERS - SAFETIMER_STATIC_TIMERS]; /**< Callback arg */
+#endif
+#else
+  timer_slot_t slots[MAX_TIMERS]; /**< Timer slot array */
+#endif
+#if SAFETIMER_COMPACT_SLOTS && !BSP_TICK_TYPE_16BIT
+  bsp_tick_t epoch; /**< Last deadline written (compact expire_time base) */
+#endif
+  safetimer_bitmap_t used_bitmap[BITMAP_WORDS];   /**< Used slots */
+  SAFETIMER_ATOMIC safetimer_bitmap_t
+      active_bitmap[BITMAP_WORDS]; /**< Running slots */
+  uint8_t next_generation; /**< Next generation ID (1~7, wraps, 0 reserved) */
+#if SAFETIMER_ENGINE != SAFETIMER_ENGINE_HEAP
+  SAFETIMER_ATOMIC bsp_tick_t next_expiry; /**< Earliest active deadline */
+  SAFETIMER_ATOMIC uint8_t expiry_state;   /**< EXPIRY_CACHE_* state */
+#endif
+#if SAFETIMER_ENGINE == SAFETIMER_ENGINE_WHEEL
+  wheel_link_t wheel_head[SAFETIMER_WHEEL_SIZE]; /**< First slot per bucket */
+  wheel_link_t wheel_next[MAX_TIMERS]; /**< Next slot in bucket */
+  wheel_link_t wheel_prev[MAX_TIMERS]; /**< Previous slot or bucket tag */
+  bsp_tick_t wheel_cursor; /**< Last tick whose bucket was walked */
+#endif
+#if SAFETIMER_ENGINE == SAFETIMER_ENGINE_HEAP
+  slot_index_t heap[MAX_TIMERS];     /**< Running slots, min-heap order */
+  slot_index_t heap_pos[MAX_TIMERS]; /**< Heap position + 1 (0 = not in) */
+  slot_index_t heap_size;            /**< Number of running slots in heap */
+#endif
+  volatile uint8_t processing; /**< Recursion guard (Trap #19) */
+#if SAFETIMER_ENABLE_CORO
+  safetimer_handle_t executing_handle; /**< Running callback, 0 = none */
+#endif
+#if SAFETIMER_ENABLE_CATCHUP == SAFETIMER_CATCHUP_REPORT
+  uint32_t executing_missed; /**< Periods coalesced for running callback */
+#endif
+#if SAFETIMER_PRIORITY_LEVELS > 1
+  safetimer_bitmap_t prio_bitmap[SAFETIMER_PRIORITY_LEVELS - 1]
+                                [BITMAP_WORDS]; /**< Slots per level 1~ */
+#endif
+#if SAFETIMER_ENABLE_SLACK
+  uint8_t slack[MAX_TIMERS]; /**< Ticks a slot may fire early (coalescing) */
+  safetimer_bitmap_t slack_bitmap[BITMAP_WORDS]; /**< Slots with slack > 0 */
+#endif
+#if SAFETIMER_ENABLE_SEM_WAKE
+  const volatile void *sem_wait[MAX_TIMERS]; /**< Awaited semaphore */
+  safetimer_bitmap_t sem_bitmap[BITMAP_WORDS]; /**< Slots waiting on a sem */
+#endif
+#if SAFETIMER_ENABLE_FLAG_TIMERS
+  safetimer_bitmap_t expired_bitmap[BITMAP_WORDS]; /**< Unpolled flag fires */
+#endif
+#if SAFETIMER_ENABLE_PROCESS_BUDGET
+  slot_index_t resume_cursor; /**< First slot of the next process pass */
+#if SAFETIMER_ENGINE != SAFETIMER_ENGINE_BITMAP
+  safetimer_bitmap_t resume_due[BITMAP_WORDS]; /**< Due, not dispatched yet */
+  uint8_t resume_pending; /**< resume_due is non-empty */
+#endif
+#endif
+#if SAFETIMER_ENABLE_ISR_QUEUE
+  volatile safetimer_isr_cmd_t isr_queue[SAFETIMER_ISR_QUEUE_SIZE]; /**< Ring */
+  volatile uint8_t isr_head; /**< Next entry to write (ISR only) */
+  volatile uint8_t isr_tail; /**< Next entry to apply (process() only) */
+#endif
+#if SAFETIMER_ENABLE_ISR_DISPATCH
+  volatile uint8_t ready; /**< Set by safetimer_isr_detect(): pass needed */
+#endif
+#if SAFETIMER_ENABLE_HW_COMPARE
+  bsp_tick_t hw_compare; /**< Deadline last passed to bsp_set_compare() */
+  uint8_t hw_armed;      /**< hw_compare is programmed and still pending */
+#endif
+#if SAFETIMER_ENABLE_STATS
+  safetimer_stats_t stats[MAX_TIMERS];  /**< Per-slot statistics */
+  safetimer_pool_stats_t pool_stats;    /**< Pool-wide statistics */
+#if SAFETIMER_STATS_CYCLES
+  uint32_t critical_start; /**< bsp_get_cycles() at POOL_ENTER_CRITICAL */
+#endif
+#endif
+#if SAFETIMER_ENABLE_TRACE
+  safetimer_trace_record_t *trace_buf; /**< Event ring, NULL = not tracing */
+  uint16_t trace_mask; /**< Ring capacity - 1 */
+  uint16_t trace_head; /**< Records since attach, 2 * cap folds to cap */
+#endif
+#if SAFETIMER_ENABLE_POOL_LOCK
+  void (*enter_critical)(void); /**< Pool lock, NULL = bsp_enter_critical */
+  void (*exit_critical)(void);  /**< Pool unlock, NULL = bsp_exit_critical */
+#endif
+} safetimer_pool_t;
+
+#endif /* SAFETIMER_POOL_H */
@@ -11,17 +11,19 @@
  *
  * ## Key Features:
  * - Counting semaphores with timeout support
- * - Interrupt-safe signal/wait operations
+ * - Interrupt-safe signal (SAFETIMER_SEM_SIGNAL_FROM_ISR from ISRs)
  * - Zero RAM overhead (user allocates semaphore variables)
+ * - Optional event-driven waits (SAFETIMER_ENABLE_SEM_WAKE=1): a signal
+ *   wakes the waiting coroutine on the next pass instead of its next poll
  *
  * ## Usage Pattern:
  * @code
  * safetimer_sem_t data_ready_sem;
  * SAFETIMER_SEM_INIT(data_ready_sem);
  *
- * // Producer (interrupt or another coroutine)
+ * // Producer (interrupt; another coroutine uses SAFETIMER_SEM_SIGNAL)
  * void data_isr(void) {
- *     SAFETIMER_SEM_SIGNAL(data_ready_sem);
+ *     SAFETIMER_SEM_SIGNAL_FROM_ISR(data_ready_sem);
  * }
  *
  * // Consumer (coroutine)
@@ -35,6 +37,7 @@
 #ifndef SAFETIMER_SEM_H
 #define SAFETIMER_SEM_H
 
+#include "safetimer_config.h"
 #include <stdint.h>
 
 /* Forward declarations for BSP functions (user must include bsp.h or
@@ -42,6 +45,30 @@
 extern void bsp_enter_critical(void);
 extern void bsp_exit_critical(void);
 
+#if SAFETIMER_ENABLE_SEM_WAKE
+/* From safetimer.h, for signaling code that only includes this header */
+extern void safetimer_sem_wake(const volatile void *sem);
+#if SAFETIMER_ENABLE_ISR_QUEUE
+#include "safetimer.h" /* safetimer_sem_wake_from_isr(), timer_error_t */
+#endif
+#endif
+
+/* Critical section of the macros below (SAFETIMER_ENABLE_CRIT_PROFILE=1:
+ * profiled, one record per section at the line invoking the macro) */
+#if SAFETIMER_ENABLE_CRIT_PROFILE
+#include "safetimer.h" /* safetimer_crit_enter(), safetimer_crit_site_t */
+
+#define SAFETIMER_SEM_ENTER_CRITICAL()                                         \
+  do {                                                                         \
+    static safetimer_crit_site_t sem_crit_site = SAFETIMER_CRIT_SITE_INIT;     \
+    safetimer_crit_enter(&sem_crit_site);                                      \
+  } while (0)
+#define SAFETIMER_SEM_EXIT_CRITICAL() safetimer_crit_exit()
+#else
+#define SAFETIMER_SEM_ENTER_CRITICAL() bsp_enter_critical()
+#define SAFETIMER_SEM_EXIT_CRITICAL() bsp_exit_critical()
+#endif
+
 /* ========== Type Definitions ========== */
 
 /**
@@ -49,7 +76,7 @@ extern void bsp_exit_critical(void);
  *
  * Values:
  * - 0: Signaled (ready to proceed)
- * - > 0: Waiting (countdown in progress)
+ * - > 0: Waiting (countdown in progress, 1 with SAFETIMER_ENABLE_SEM_WAKE)
  * - SAFETIMER_SEM_TIMEOUT (-1): Timeout occurred
  *
  * @note Must be signed type for timeout detection
@@ -88,20 +115,32 @@ typedef int8_t safetimer_sem_t;
  *
  * @param sem Semaphore variable
  *
- * @note Can be called from interrupt context (single instruction)
  * @note If semaphore is in timeout state, this clears it
+ * @note SAFETIMER_ENABLE_SEM_WAKE=0: a single store, also safe from an ISR
+ * @note SAFETIMER_ENABLE_SEM_WAKE=1: also triggers the waiting coroutines
+ *       through safetimer_sem_wake(), which reads bsp_get_ticks() and takes
+ *       the pool lock once per bitmap word plus once per waiter. Task
+ *       context only: ISRs use SAFETIMER_SEM_SIGNAL_FROM_ISR()
  *
  * @par Example:
  * @code
- * void uart_rx_isr(void) {
- *     SAFETIMER_SEM_SIGNAL(uart_sem);  // Wake up coroutine
+ * void producer_callback(void *user_data) {
+ *     SAFETIMER_SEM_SIGNAL(data_sem);  // Wake up coroutine
  * }
  * @endcode
  */
+#if SAFETIMER_ENABLE_SEM_WAKE
 #define SAFETIMER_SEM_SIGNAL(sem)                                              \
   do {                                                                         \
     (sem) = 0;                                                                 \
+    safetimer_sem_wake(&(sem));                                                \
   } while (0)
+#else
+#define SAFETIMER_SEM_SIGNAL(sem)                                              \
+  do {                                                                         \
+    (sem) = 0;                                                                 \
+  } while (0)
+#endif
 
 /**
  * @brief Safe signal semaphore (skip if timed out)
@@ -112,6 +151,8 @@ typedef int8_t safetimer_sem_t;
  *
  * @note Use when signal may arrive after timeout
  * @note Prevents overwriting timeout indication
+ * @note Same context rule as SAFETIMER_SEM_SIGNAL() (ISRs use
+ *       SAFETIMER_SEM_SIGNAL_SAFE_FROM_ISR())
  *
  * @par Example:
  * @code
@@ -120,11 +161,73 @@ typedef int8_t safetimer_sem_t;
  * }
  * @endcode
  */
+#if SAFETIMER_ENABLE_SEM_WAKE
+#define SAFETIMER_SEM_SIGNAL_SAFE(sem)                                         \
+  do {                                                                         \
+    if ((sem) != SAFETIMER_SEM_TIMEOUT) {                                      \
+      (sem) = 0;                                                               \
+      safetimer_sem_wake(&(sem));                                              \
+    }                                                                          \
+  } while (0)
+#else
 #define SAFETIMER_SEM_SIGNAL_SAFE(sem)                                         \
   do {                                                                         \
     if ((sem) != SAFETIMER_SEM_TIMEOUT)                                        \
       (sem) = 0;                                                               \
   } while (0)
+#endif
+
+/**
+ * @brief Signal semaphore from interrupt context
+ *
+ * Same effect as SAFETIMER_SEM_SIGNAL() without masking interrupts.
+ *
+ * @param sem Semaphore variable
+ *
+ * @note SAFETIMER_ENABLE_SEM_WAKE=0: the plain single store
+ * @note SAFETIMER_ENABLE_SEM_WAKE=1: the store, then the wake is queued on
+ *       the ISR command ring (safetimer_sem_wake_from_isr()) and applied
+ *       by the next pass; requires SAFETIMER_ENABLE_ISR_QUEUE, and the
+ *       single-producer rule of the *_from_isr() APIs applies
+ *
+ * @par Example:
+ * @code
+ * void uart_rx_isr(void) {
+ *     SAFETIMER_SEM_SIGNAL_FROM_ISR(uart_sem);  // Wake up coroutine
+ * }
+ * @endcode
+ */
+#if !SAFETIMER_ENABLE_SEM_WAKE
+#define SAFETIMER_SEM_SIGNAL_FROM_ISR(sem) SAFETIMER_SEM_SIGNAL(sem)
+#elif SAFETIMER_ENABLE_ISR_QUEUE
+#define SAFETIMER_SEM_SIGNAL_FROM_ISR(sem)                                     \
+  do {                                                                         \
+    (sem) = 0;                                                                 \
+    (void)safetimer_sem_wake_from_isr(&(sem));                                 \
+  } while (0)
+#else
+#define SAFETIMER_SEM_SIGNAL_FROM_ISR(sem)                                     \
+  do {                                                                         \
+    _Static_assert(0, "SAFETIMER_SEM_SIGNAL_FROM_ISR with "                    \
+                      "SAFETIMER_ENABLE_SEM_WAKE requires "                    \
+                      "SAFETIMER_ENABLE_ISR_QUEUE");                           \
+    (void)(sem);                                                               \
+  } while (0)
+#endif
+
+/**
+ * @brief Safe signal semaphore from interrupt context (skip if timed out)
+ *
+ * SAFETIMER_SEM_SIGNAL_SAFE() counterpart of SAFETIMER_SEM_SIGNAL_FROM_ISR().
+ *
+ * @param sem Semaphore variable
+ */
+#define SAFETIMER_SEM_SIGNAL_SAFE_FROM_ISR(sem)                                \
+  do {                                                                         \
+    if ((sem) != SAFETIMER_SEM_TIMEOUT) {                                      \
+      SAFETIMER_SEM_SIGNAL_FROM_ISR(sem);                                      \
+    }                                                                          \
+  } while (0)
 
 /* ========== Coroutine Semaphore Wait ========== */
 
@@ -140,6 +243,9 @@ typedef int8_t safetimer_sem_t;
  *
  * @note Total timeout = poll_ms × timeout_count milliseconds
  * @note After timeout, sem == SAFETIMER_SEM_TIMEOUT
+ * @note SAFETIMER_ENABLE_SEM_WAKE=1: no polling, the coroutine timer gets
+ *       one deadline of poll_ms × timeout_count (must be a valid period)
+ *       and SAFETIMER_SEM_SIGNAL() triggers it
  * @note Requires SAFETIMER_CORO_BEGIN/END context
  * @note Thread-safe: uses BSP critical sections
  *
@@ -162,6 +268,37 @@ typedef int8_t safetimer_sem_t;
  * timeout!
  * @warning For long timeouts, increase poll_ms instead of timeout_count
  */
+#if SAFETIMER_ENABLE_SEM_WAKE
+#define SAFETIMER_CORO_WAIT_SEM(sem, poll_ms, timeout_count)                   \
+  do {                                                                         \
+    _Static_assert((timeout_count) <= 126,                                     \
+                   "SAFETIMER_CORO_WAIT_SEM: timeout_count must be <= 126 "    \
+                   "(int8_t limit). "                                          \
+                   "Use larger poll_ms for longer timeouts.");                 \
+    SAFETIMER_SEM_ENTER_CRITICAL();                                            \
+    if ((sem) == 0) {                                                          \
+      SAFETIMER_SEM_EXIT_CRITICAL();                                           \
+      break; /* Already signaled */                                            \
+    }                                                                          \
+    (sem) = 1;                                                                 \
+    SAFETIMER_SEM_EXIT_CRITICAL();                                             \
+    /* Deadline first: a signal from here on triggers the armed timer */       \
+    safetimer_set_period((ctx)->_coro_handle,                                  \
+                         (uint32_t)(poll_ms) * (timeout_count));               \
+    safetimer_sem_wait_on((ctx)->_coro_handle, &(sem));                        \
+    if ((sem) == 0) {                                                          \
+      safetimer_trigger((ctx)->_coro_handle); /* Signaled before wait_on */    \
+    }                                                                          \
+    (ctx)->_coro_lc = __LINE__;                                                \
+    return;                                                                    \
+  case __LINE__:                                                               \
+    safetimer_sem_wait_on((ctx)->_coro_handle, NULL);                          \
+    SAFETIMER_SEM_ENTER_CRITICAL();                                            \
+    if ((sem) != 0)                                                            \
+      (sem) = SAFETIMER_SEM_TIMEOUT; /* Woken by the deadline */               \
+    SAFETIMER_SEM_EXIT_CRITICAL();                                             \
+  } while (0)
+#else
 #define SAFETIMER_CORO_WAIT_SEM(sem, poll_ms, timeout_count)                   \
   do {                                                                         \
     /* Compile-time check for timeout_count overflow (fixes Trap #10) */       \
@@ -169,31 +306,32 @@ typedef int8_t safetimer_sem_t;
                    "SAFETIMER_CORO_WAIT_SEM: timeout_count must be <= 126 "    \
                    "(int8_t limit). "                                          \
                    "Use larger poll_ms for longer timeouts.");                 \
-    bsp_enter_critical();                                                      \
+    SAFETIMER_SEM_ENTER_CRITICAL();                                            \
     if ((sem) == 0) {                                                          \
-      bsp_exit_critical();                                                     \
+      SAFETIMER_SEM_EXIT_CRITICAL();                                           \
       break; /* Already signaled */                                            \
     }                                                                          \
     (sem) = (timeout_count) + 1;                                               \
-    bsp_exit_critical();                                                       \
+    SAFETIMER_SEM_EXIT_CRITICAL();                                             \
     safetimer_set_period((ctx)->_coro_handle, (poll_ms));                      \
     (ctx)->_coro_lc = __LINE__;                                                \
   case __LINE__:                                                               \
-    bsp_enter_critical();                                                      \
+    SAFETIMER_SEM_ENTER_CRITICAL();                                            \
     if ((sem) == 0) {                                                          \
-      bsp_exit_critical();                                                     \
+      SAFETIMER_SEM_EXIT_CRITICAL();                                           \
       break; /* Signaled during yield */                                       \
     }                                                                          \
     if ((sem) > 1) {                                                           \
       (sem)--;                                                                 \
-      bsp_exit_critical();                                                     \
+      SAFETIMER_SEM_EXIT_CRITICAL();                                           \
       return;                                                                  \
     } else {                                                                   \
       if ((sem) != 0)                                                          \
         (sem) = SAFETIMER_SEM_TIMEOUT;                                         \
-      bsp_exit_critical();                                                     \
+      SAFETIMER_SEM_EXIT_CRITICAL();                                           \
     }                                                                          \
   } while (0)
+#endif
 
 /**
  * @brief Wait for semaphore indefinitely (no timeout)
@@ -205,6 +343,8 @@ typedef int8_t safetimer_sem_t;
  *
  * @note Will wait forever unless semaphore is signaled
  * @note Use with caution - can cause deadlocks
+ * @note SAFETIMER_ENABLE_SEM_WAKE=1: SAFETIMER_SEM_SIGNAL() resumes the
+ *       coroutine on the next pass, poll_ms only bounds a missed wakeup
  *
  * @par Example:
  * @code
@@ -212,6 +352,19 @@ typedef int8_t safetimer_sem_t;
  * // Execution never proceeds unless semaphore is signaled
  * @endcode
  */
+#if SAFETIMER_ENABLE_SEM_WAKE
+#define SAFETIMER_CORO_WAIT_SEM_FOREVER(sem, poll_ms)                          \
+  do {                                                                         \
+    (sem) = 1;                                                                 \
+    safetimer_set_period((ctx)->_coro_handle, (poll_ms));                      \
+    safetimer_sem_wait_on((ctx)->_coro_handle, &(sem));                        \
+    (ctx)->_coro_lc = __LINE__;                                                \
+  case __LINE__:                                                               \
+    if ((sem) > 0)                                                             \
+      return;                                                                  \
+    safetimer_sem_wait_on((ctx)->_coro_handle, NULL);                          \
+  } while (0)
+#else
 #define SAFETIMER_CORO_WAIT_SEM_FOREVER(sem, poll_ms)                          \
   do {                                                                         \
     (sem) = 1;                                                                 \
@@ -221,15 +374,17 @@ typedef int8_t safetimer_sem_t;
     if ((sem) > 0)                                                             \
       return;                                                                  \
   } while (0)
+#endif
 
 /* ========== Usage Guidelines ========== */
 
 /**
  * @par Best Practices:
  * - Always check for SAFETIMER_SEM_TIMEOUT after wait
- * - Use SIGNAL_SAFE in delayed/interrupt contexts
+ * - Use SIGNAL_SAFE in delayed contexts, SIGNAL_SAFE_FROM_ISR in ISRs
  * - Keep semaphore variables global or static
- * - SAFETIMER_SEM_SIGNAL is interrupt-safe (single assignment)
+ * - Signal from ISRs with the *_FROM_ISR macros: SAFETIMER_SEM_SIGNAL is a
+ *   single assignment only with SAFETIMER_ENABLE_SEM_WAKE=0
  */
 
 #endif /* SAFETIMER_SEM_H */
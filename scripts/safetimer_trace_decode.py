@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+"""Decode a SafeTimer event trace dump (SAFETIMER_ENABLE_TRACE=1).
+
+The target stores safetimer_trace_record_t entries in a RAM ring attached
+with safetimer_trace_attach(). Dump the ring as raw memory (debugger
+"save memory", J-Link savebin, OpenOCD dump_image, ...) and read
+safetimer_trace_count() (or pool->trace_head), then:
+
+    scripts/safetimer_trace_decode.py trace.bin --count 123
+    scripts/safetimer_trace_decode.py trace.bin --tick-bits 16 --max-timers 8
+
+Record layout (no padding):
+    bsp_tick_t tick    4 bytes (2 with BSP_TICK_TYPE_16BIT=1)
+    uint16_t   handle
+    uint8_t    event   SAFETIMER_TRACE_* code
+    uint8_t    arg     lateness (LATE_FIRE) / coalesced periods (SKIP)
+"""
+
+import argparse
+import struct
+import sys
+
+# Must match SAFETIMER_TRACE_* in include/safetimer.h
+EVENTS = {
+    0: "CREATE",
+    1: "START",
+    2: "FIRE",
+    3: "LATE_FIRE",
+    4: "SKIP",
+    5: "STOP",
+    6: "DELETE",
+}
+
+
+def handle_index_bits(max_timers):
+    """HANDLE_INDEX_BITS of src/safetimer.c for a MAX_TIMERS value."""
+    bits = 1
+    while (1 << bits) < max_timers and bits < 9:
+        bits += 1
+    return bits
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+        description="Decode a SafeTimer binary event trace dump")
+    parser.add_argument("dump", help="raw ring dump (binary file, - = stdin)")
+    parser.add_argument("--tick-bits", type=int, choices=(16, 32), default=16,
+                        help="bsp_tick_t width on the target (default: 16, "
+                             "the BSP_TICK_TYPE_16BIT=1 default)")
+    parser.add_argument("--endian", choices=("little", "big"),
+                        default="little", help="target byte order")
+    parser.add_argument("--count", type=int, default=None,
+                        help="safetimer_trace_count() at dump time; orders "
+                             "a wrapped ring oldest first (default: records "
+                             "in ring order, all of them)")
+    parser.add_argument("--max-timers", type=int, default=None,
+                        help="MAX_TIMERS of the target, splits handles into "
+                             "slot index and generation")
+    return parser.parse_args()
+
+
+def read_records(data, tick_bits, endian):
+    fmt = ("<" if endian == "little" else ">") + \
+        ("H" if tick_bits == 16 else "I") + "HBB"
+    size = struct.calcsize(fmt)
+    if len(data) % size != 0:
+        sys.exit("error: dump size %d is not a multiple of the %d-byte "
+                 "record (check --tick-bits)" % (len(data), size))
+    return [struct.unpack_from(fmt, data, off)
+            for off in range(0, len(data), size)]
+
+
+def order_records(records, count):
+    """Oldest-first list of the valid records."""
+    capacity = len(records)
+    if count is None:
+        return records
+    if capacity == 0 or capacity & (capacity - 1):
+        sys.exit("error: ring capacity %d is not a power of two" % capacity)
+    if count <= capacity:
+        return records[:count]
+    # Wrapped: the oldest surviving record sits at the next write index.
+    # The target folds count from 2 * capacity back to capacity, so it
+    # never drops below capacity again once the ring wrapped.
+    start = count % capacity
+    return records[start:] + records[:start]
+
+
+def format_handle(handle, index_bits):
+    if index_bits is None:
+        return "0x%04X" % handle
+    index = handle & ((1 << index_bits) - 1)
+    gen = handle >> index_bits
+    return "0x%04X (slot %d, gen %d)" % (handle, index, gen)
+
+
+def main():
+    args = parse_args()
+    if args.dump == "-":
+        data = sys.stdin.buffer.read()
+    else:
+        with open(args.dump, "rb") as f:
+            data = f.read()
+
+    records = order_records(read_records(data, args.tick_bits, args.endian),
+                            args.count)
+    index_bits = (handle_index_bits(args.max_timers)
+                  if args.max_timers else None)
+    tick_mask = (1 << args.tick_bits) - 1
+
+    prev_tick = None
+    for tick, handle, event, arg in records:
+        name = EVENTS.get(event, "EVENT_%d" % event)
+        if event == 3:
+            detail = "late by %d%s" % (arg, "+" if arg == 255 else "")
+        elif event == 4:
+            detail = "%d period(s) coalesced%s" % (arg,
+                                                   "+" if arg == 255 else "")
+        else:
+            detail = ""
+        delta = "" if prev_tick is None else \
+            "+%d" % ((tick - prev_tick) & tick_mask)
+        line = "%10d %8s  %-9s %s %s" % (tick, delta, name,
+                                         format_handle(handle, index_bits),
+                                         detail)
+        print(line.rstrip())
+        prev_tick = tick
+
+    if args.count is not None and args.count > len(records):
+        # Exact below 2 * capacity, a lower bound once the count folded
+        print("# ring wrapped: at least %d oldest record(s) overwritten"
+              % (args.count - len(records)), file=sys.stderr)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -10,6 +10,9 @@
 
 #include "bsp.h"
 #include "safetimer_config.h"
+#if SAFETIMER_ENABLE_ISR_DISPATCH
+#include "safetimer.h" /* safetimer_isr_detect() */
+#endif
 
 #if (SAFETIMER_BSP_IMPLEMENTATION > 0)
 
@@ -61,11 +64,36 @@ static volatile bsp_tick_t s_default_ticks = 0;
  * @note This function is ISR-safe (single increment operation)
  * @note No critical section needed (atomic on 8/16/32-bit architectures)
  * @note Execution time: <1us on typical 8MHz 8-bit MCU
+ * @note With SAFETIMER_ENABLE_ISR_DISPATCH=1 also runs the O(1) expiry
+ *       detection for the default pool (see safetimer_dispatch_ready())
  */
 void safetimer_tick_isr(void) {
     s_default_ticks++;
+#if SAFETIMER_ENABLE_ISR_DISPATCH
+    safetimer_isr_detect();
+#endif
 }
 
+#if SAFETIMER_BSP_TICKLESS
+/**
+ * @brief Credit ticks slept in tickless mode
+ *
+ * Call from the compare-match (wakeup) ISR, or after the sleep returns,
+ * with the ticks elapsed since the periodic tick was stopped.
+ *
+ * @param ticks Slept ticks (credited in one step)
+ *
+ * @note Not a single-instruction update: call with interrupts disabled
+ *       (ISR context, or before re-enabling the tick interrupt)
+ */
+void safetimer_tick_advance(bsp_tick_t ticks) {
+    s_default_ticks += ticks;
+#if SAFETIMER_ENABLE_ISR_DISPATCH
+    safetimer_isr_detect();
+#endif
+}
+#endif
+
 /* ========================================================================== */
 /*                         BSP FUNCTION IMPLEMENTATIONS                       */
 /* ========================================================================== */
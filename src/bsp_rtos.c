@@ -0,0 +1,233 @@
+/**
+ * @file    bsp_rtos.c
+ * @brief   RTOS BSP Implementation for SafeTimer (FreeRTOS / Zephyr)
+ * @version 1.0.0
+ * @date    2026-10-14
+ *
+ * @note Only compiled when SAFETIMER_BSP_RTOS != SAFETIMER_BSP_RTOS_NONE
+ * @note The wake hook is the SAFETIMER_ENABLE_HW_COMPARE callback: the
+ *       "compare register" is the daemon's blocking timeout
+ */
+
+#include "bsp_rtos.h"
+
+#if (SAFETIMER_BSP_RTOS != SAFETIMER_BSP_RTOS_NONE)
+
+#include "safetimer.h" /* safetimer_process(), safetimer_get_next_expiry() */
+
+#if (SAFETIMER_BSP_RTOS == SAFETIMER_BSP_RTOS_FREERTOS)
+#include "FreeRTOS.h"
+#include "task.h"
+
+#if defined(configTICK_TYPE_WIDTH_IN_BITS)
+#define BSP_RTOS_TICK_16BIT                                                    \
+    (configTICK_TYPE_WIDTH_IN_BITS == TICK_TYPE_WIDTH_16_BITS)
+#elif defined(configUSE_16_BIT_TICKS)
+#define BSP_RTOS_TICK_16BIT configUSE_16_BIT_TICKS
+#else
+#define BSP_RTOS_TICK_16BIT 0
+#endif
+
+#if BSP_RTOS_TICK_16BIT && !BSP_TICK_TYPE_16BIT
+#error "16-bit FreeRTOS ticks wrap early: set BSP_TICK_TYPE_16BIT=1"
+#endif
+
+/* SAFETIMER_SEM_SIGNAL() from an ISR reaches the BSP with SEM_WAKE=1:
+ * switch to the *_FROM_ISR kernel calls there (taskENTER_CRITICAL()
+ * asserts in interrupt context) */
+#if SAFETIMER_ENABLE_SEM_WAKE
+#define BSP_RTOS_IN_ISR() (xPortIsInsideInterrupt() == pdTRUE)
+#else
+#define BSP_RTOS_IN_ISR() 0
+#endif
+
+#else /* SAFETIMER_BSP_RTOS_ZEPHYR */
+#include <zephyr/kernel.h>
+
+#if (1000000 / CONFIG_SYS_CLOCK_TICKS_PER_SEC) != SAFETIMER_TICK_US
+#error "CONFIG_SYS_CLOCK_TICKS_PER_SEC must match SAFETIMER_TICK_US"
+#endif
+#endif
+
+/* ========================================================================== */
+/*                         INTERNAL STATE                                     */
+/* ========================================================================== */
+
+/**
+ * @brief Earliest deadline moved forward (set by bsp_set_compare())
+ *
+ * Written inside the SafeTimer critical section and consumed by
+ * bsp_exit_critical(), which signals the daemon once the lock is
+ * released (no kernel calls while it is held).
+ */
+static volatile uint8_t s_wake_pending = 0;
+
+#if (SAFETIMER_BSP_RTOS == SAFETIMER_BSP_RTOS_FREERTOS)
+static TaskHandle_t volatile s_daemon = NULL;
+static UBaseType_t s_isr_mask; /* SafeTimer never nests its lock */
+#else
+static k_tid_t volatile s_daemon = NULL;
+static K_SEM_DEFINE(s_wake, 0, 1);
+static struct k_spinlock s_lock;
+static k_spinlock_key_t s_lock_key; /* SafeTimer never nests its lock */
+#endif
+
+/* ========================================================================== */
+/*                         INTERNAL HELPERS                                   */
+/* ========================================================================== */
+
+/**
+ * @brief Signal the daemon after the lock is released
+ *
+ * The daemon itself is never signalled: it recomputes its timeout after
+ * every pass, so callbacks re-arming timers cost no extra wakeup.
+ */
+static void bsp_rtos_wake(void) {
+#if (SAFETIMER_BSP_RTOS == SAFETIMER_BSP_RTOS_FREERTOS)
+    TaskHandle_t daemon = s_daemon;
+
+    if (BSP_RTOS_IN_ISR()) {
+        safetimer_rtos_notify_from_isr();
+    } else if (daemon != NULL && daemon != xTaskGetCurrentTaskHandle()) {
+        xTaskNotifyGive(daemon);
+    }
+#else
+    k_tid_t daemon = s_daemon;
+
+    if (daemon != NULL && daemon != k_current_get()) {
+        k_sem_give(&s_wake);
+    }
+#endif
+}
+
+/* ========================================================================== */
+/*                         BSP FUNCTION IMPLEMENTATIONS                       */
+/* ========================================================================== */
+
+/**
+ * @brief Get current system tick count (kernel tick)
+ *
+ * @note FreeRTOS with SAFETIMER_ENABLE_ISR_QUEUE or SAFETIMER_ENABLE_SEM_WAKE
+ *       uses the ISR-safe variant: the *_from_isr() calls (and an ISR
+ *       SAFETIMER_SEM_SIGNAL()) read the tick in interrupt context
+ */
+bsp_tick_t bsp_get_ticks(void) {
+#if (SAFETIMER_BSP_RTOS == SAFETIMER_BSP_RTOS_FREERTOS)
+#if SAFETIMER_ENABLE_ISR_QUEUE || SAFETIMER_ENABLE_SEM_WAKE
+    return (bsp_tick_t)xTaskGetTickCountFromISR();
+#else
+    return (bsp_tick_t)xTaskGetTickCount();
+#endif
+#else
+    return (bsp_tick_t)k_uptime_ticks();
+#endif
+}
+
+/**
+ * @brief Enter critical section
+ *
+ * FreeRTOS: taskENTER_CRITICAL() (masks kernel-aware interrupts, no
+ * context switch), taskENTER_CRITICAL_FROM_ISR() in an ISR with
+ * SAFETIMER_ENABLE_SEM_WAKE. Zephyr: k_spin_lock() (also correct on SMP).
+ */
+void bsp_enter_critical(void) {
+#if (SAFETIMER_BSP_RTOS == SAFETIMER_BSP_RTOS_FREERTOS)
+    if (BSP_RTOS_IN_ISR()) {
+        s_isr_mask = taskENTER_CRITICAL_FROM_ISR();
+    } else {
+        taskENTER_CRITICAL();
+    }
+#else
+    s_lock_key = k_spin_lock(&s_lock);
+#endif
+}
+
+/**
+ * @brief Exit critical section, then wake the daemon if needed
+ */
+void bsp_exit_critical(void) {
+    uint8_t wake = s_wake_pending; /* C89: declare before statements */
+
+    s_wake_pending = 0;
+#if (SAFETIMER_BSP_RTOS == SAFETIMER_BSP_RTOS_FREERTOS)
+    if (BSP_RTOS_IN_ISR()) {
+        taskEXIT_CRITICAL_FROM_ISR(s_isr_mask);
+    } else {
+        taskEXIT_CRITICAL();
+    }
+#else
+    k_spin_unlock(&s_lock, s_lock_key);
+#endif
+    if (wake) {
+        bsp_rtos_wake();
+    }
+}
+
+/**
+ * @brief Earliest deadline changed (SAFETIMER_ENABLE_HW_COMPARE hook)
+ *
+ * Only latches the wake request: called inside the critical section, and
+ * the daemon reads the new deadline from safetimer_get_next_expiry().
+ */
+void bsp_set_compare(bsp_tick_t deadline) {
+    (void)deadline;
+    s_wake_pending = 1;
+}
+
+/* ========================================================================== */
+/*                         DAEMON                                             */
+/* ========================================================================== */
+
+#if (SAFETIMER_BSP_RTOS == SAFETIMER_BSP_RTOS_FREERTOS)
+void safetimer_rtos_daemon(void *arg) {
+    uint32_t idle;
+    TickType_t timeout;
+
+    (void)arg;
+    configASSERT((1000000UL / configTICK_RATE_HZ) == SAFETIMER_TICK_US);
+    s_daemon = xTaskGetCurrentTaskHandle();
+
+    for (;;) {
+        safetimer_process();
+        idle = safetimer_get_next_expiry();
+        timeout = (idle >= (uint32_t)portMAX_DELAY) ? portMAX_DELAY
+                                                    : (TickType_t)idle;
+        /* A wake given after the expiry query is latched, never lost */
+        (void)ulTaskNotifyTake(pdTRUE, timeout);
+    }
+}
+
+void safetimer_rtos_notify_from_isr(void) {
+    BaseType_t woken = pdFALSE;
+    TaskHandle_t daemon = s_daemon;
+
+    if (daemon != NULL) {
+        vTaskNotifyGiveFromISR(daemon, &woken);
+        portYIELD_FROM_ISR(woken);
+    }
+}
+#else
+void safetimer_rtos_daemon(void *p1, void *p2, void *p3) {
+    uint32_t idle;
+
+    (void)p1;
+    (void)p2;
+    (void)p3;
+    s_daemon = k_current_get();
+
+    for (;;) {
+        safetimer_process();
+        idle = safetimer_get_next_expiry();
+        /* A wake given after the expiry query is latched, never lost */
+        (void)k_sem_take(&s_wake, (idle == SAFETIMER_NO_EXPIRY)
+                                      ? K_FOREVER
+                                      : K_TICKS(idle));
+    }
+}
+
+void safetimer_rtos_notify_from_isr(void) {
+    k_sem_give(&s_wake);
+}
+#endif
+
+#endif /* SAFETIMER_BSP_RTOS != SAFETIMER_BSP_RTOS_NONE */
@@ -34,28 +34,14 @@
  * - MAX_TIMERS=16: [gen:4bit (1~15)][idx:4bit (0~15)] ← 2x better ABA
  * protection
  * - MAX_TIMERS=32: [gen:3bit (1~7)][idx:5bit (0~31)]  ← Original behavior
+ * - MAX_TIMERS>32: [gen:6bit (1~63)][idx:6~9bit]      ← Wheel engine only
  *
  * Generation: 1 ~ HANDLE_GEN_MAX (0 reserved for INVALID_HANDLE = -1)
+ * Static slots (SAFETIMER_STATIC_TIMERS) always report HANDLE_GEN_MAX
  */
 
-/* Compile-time calculation of required index bits */
-#if MAX_TIMERS <= 2
-#define HANDLE_INDEX_BITS 1
-#elif MAX_TIMERS <= 4
-#define HANDLE_INDEX_BITS 2
-#elif MAX_TIMERS <= 8
-#define HANDLE_INDEX_BITS 3
-#elif MAX_TIMERS <= 16
-#define HANDLE_INDEX_BITS 4
-#else
-#define HANDLE_INDEX_BITS 5
-#endif
-
-/* Derive generation bits and masks */
-/* CRITICAL: Must cap GEN_BITS at 6 to fit in uint8_t meta with mode+active */
-#define RAW_GEN_BITS (8 - HANDLE_INDEX_BITS)
-#define HANDLE_GEN_BITS (RAW_GEN_BITS > 6 ? 6 : RAW_GEN_BITS)
-#define HANDLE_GEN_MAX ((1 << HANDLE_GEN_BITS) - 1)
+/* Index and generation bits: HANDLE_INDEX_BITS, HANDLE_GEN_MAX
+ * (safetimer_pool.h) */
 
 #define HANDLE_INDEX_MASK ((1 << HANDLE_INDEX_BITS) - 1)
 #define HANDLE_GEN_MASK (((1 << HANDLE_GEN_BITS) - 1) << HANDLE_INDEX_BITS)
@@ -63,161 +49,527 @@
 
 #define ENCODE_HANDLE(gen, idx)                                                \
   ((safetimer_handle_t)(((gen) << HANDLE_GEN_SHIFT) | (idx)))
-#define DECODE_INDEX(handle) ((uint8_t)((handle) & HANDLE_INDEX_MASK))
+#define DECODE_INDEX(handle) ((slot_index_t)((handle) & HANDLE_INDEX_MASK))
 #define DECODE_GEN(handle)                                                     \
   ((uint8_t)(((handle) & HANDLE_GEN_MASK) >> HANDLE_GEN_SHIFT))
 
 /* Compression Macros */
 #if USE_BITFIELD_META
 /* C Bitfields: Cleaner syntax, but compiler-dependent order */
-typedef struct {
-  uint8_t active : 1;
-  uint8_t mode : 1;
-  uint8_t generation : 6;
-} timer_meta_t;
-
-#define META_INIT(act, mod, gen) {(act), (mod), (gen)}
-#define SLOT_SET_ACTIVE(slot, val) (slot).meta.active = (val)
-#define SLOT_GET_ACTIVE(slot) ((slot).meta.active)
-#define SLOT_SET_MODE(slot, val) (slot).meta.mode = (val)
-#define SLOT_GET_MODE(slot) ((slot).meta.mode)
-#define SLOT_SET_GEN(slot, val) (slot).meta.generation = (val)
-#define SLOT_GET_GEN(slot) ((slot).meta.generation)
+#define META_INIT(mod, gen) {0, (mod), (gen)}
+#define SLOT_SET_MODE(idx, val) SLOT_META(idx).mode = (val)
+#define META_GET_MODE(idx) (SLOT_META(idx).mode)
+#define SLOT_SET_GEN(idx, val) SLOT_META(idx).generation = (val)
+#define META_GET_GEN(idx) (SLOT_META(idx).generation)
+#define SLOT_SET_FLAG(idx, val) SLOT_META(idx).flag = (val)
+#define SLOT_GET_FLAG(idx) (SLOT_META(idx).flag)
 
 #else
 /* Manual Masking: Portable, explicit control */
-typedef uint8_t timer_meta_t;
-
-/* Layout: [gen:6][mode:1][active:1] */
-#define META_MASK_ACTIVE 0x01U
+/* Layout: [gen:6][mode:1][flag:1] */
+#define META_MASK_FLAG 0x01U
 #define META_MASK_MODE 0x02U
 #define META_MASK_GEN 0xFCU
 #define META_SHIFT_MODE 1
 #define META_SHIFT_GEN 2
 
-#define META_INIT(act, mod, gen)                                               \
-  ((uint8_t)(((act) & 1) | (((mod) & 1) << META_SHIFT_MODE) |                  \
+#define META_INIT(mod, gen)                                                    \
+  ((uint8_t)((((mod) & 1) << META_SHIFT_MODE) |                                \
              (((gen) & 0x3F) << META_SHIFT_GEN)))
 
-#define SLOT_SET_ACTIVE(slot, val)                                             \
+#define SLOT_SET_MODE(idx, val)                                                \
   do {                                                                         \
     if (val)                                                                   \
-      (slot).meta |= META_MASK_ACTIVE;                                         \
+      SLOT_META(idx) |= META_MASK_MODE;                                        \
     else                                                                       \
-      (slot).meta &= (uint8_t)~META_MASK_ACTIVE;                               \
+      SLOT_META(idx) &= (uint8_t)~META_MASK_MODE;                              \
+  } while (0)
+#define META_GET_MODE(idx)                                                     \
+  (((SLOT_META(idx) & META_MASK_MODE) >> META_SHIFT_MODE))
+
+#define SLOT_SET_GEN(idx, val)                                                 \
+  do {                                                                         \
+    SLOT_META(idx) = (SLOT_META(idx) & ~META_MASK_GEN) |                       \
+                     (((val) & 0x3F) << META_SHIFT_GEN);                       \
   } while (0)
-#define SLOT_GET_ACTIVE(slot) (((slot).meta & META_MASK_ACTIVE) != 0)
+#define META_GET_GEN(idx) ((SLOT_META(idx) & META_MASK_GEN) >> META_SHIFT_GEN)
 
-#define SLOT_SET_MODE(slot, val)                                               \
+#define SLOT_SET_FLAG(idx, val)                                                \
   do {                                                                         \
     if (val)                                                                   \
-      (slot).meta |= META_MASK_MODE;                                           \
+      SLOT_META(idx) |= META_MASK_FLAG;                                        \
     else                                                                       \
-      (slot).meta &= (uint8_t)~META_MASK_MODE;                                 \
+      SLOT_META(idx) &= (uint8_t)~META_MASK_FLAG;                              \
   } while (0)
-#define SLOT_GET_MODE(slot)                                                    \
-  ((((slot).meta & META_MASK_MODE) >> META_SHIFT_MODE))
+#define SLOT_GET_FLAG(idx) (SLOT_META(idx) & META_MASK_FLAG)
+
+#endif
+
+#if SAFETIMER_STATIC_TIMERS > 0
+/* Static slots 0 ~ SAFETIMER_STATIC_TIMERS-1: mode from the ROM table,
+ * fixed generation, always allocated (never in used_bitmap) */
+#define SLOT_IS_STATIC(idx) ((idx) < SAFETIMER_STATIC_TIMERS)
+#define SLOT_ROM(idx) (safetimer_static_table[idx])
+#define SLOT_RAM(idx) ((idx) - SAFETIMER_STATIC_TIMERS) /* Runtime fields */
+#define STATIC_SLOT_GEN HANDLE_GEN_MAX /* SAFETIMER_STATIC_HANDLE() */
+#define HANDLE_IS_STATIC(handle) SLOT_IS_STATIC(DECODE_INDEX(handle))
+#define SLOT_GET_MODE(idx)                                                     \
+  (SLOT_IS_STATIC(idx) ? SLOT_ROM(idx).mode : META_GET_MODE(idx))
+#define SLOT_GET_GEN(idx)                                                      \
+  (SLOT_IS_STATIC(idx) ? STATIC_SLOT_GEN : META_GET_GEN(idx))
+#else
+#define HANDLE_IS_STATIC(handle) 0
+#define SLOT_GET_MODE(idx) META_GET_MODE(idx)
+#define SLOT_GET_GEN(idx) META_GET_GEN(idx)
+#endif
+
+#if SAFETIMER_COMPACT_SLOTS
+/* Compact slots: period in SAFETIMER_COMPACT_PERIOD_UNIT ticks, 16-bit
+ * deadline. With 32-bit ticks the stored low half is sign-extended against
+ * pool->epoch (the last deadline written, see SLOT_SET_EXPIRE). */
+#define SLOT_PERIOD(idx)                                                       \
+  ((bsp_tick_t)((bsp_tick_t)pool->slots[idx].period *                         \
+                SAFETIMER_COMPACT_PERIOD_UNIT))
+#if BSP_TICK_TYPE_16BIT
+#define SLOT_EXPIRE(idx) (pool->slots[idx].expire_time)
+#else
+#define SLOT_EXPIRE(idx)                                                       \
+  ((bsp_tick_t)(pool->epoch +                                                  \
+                (bsp_tick_t)(int32_t)(int16_t)(uint16_t)(                      \
+                    pool->slots[idx].expire_time - (uint16_t)pool->epoch)))
+#endif
+#define SLOT_CALLBACK(idx) (pool->slots[idx].callback)
+#if SAFETIMER_COMPACT_SLOTS == 1
+#define SLOT_USER_DATA(idx) (pool->slots[idx].user_data)
+#else
+#define SLOT_USER_DATA(idx) ((void *)0) /* Not stored: callbacks get NULL */
+#endif
+#define SLOT_META(idx) (pool->slots[idx].meta)
+#elif !SAFETIMER_POOL_SOA
+/* Per-slot field access (array-of-structs layout) */
+#define SLOT_PERIOD(idx) (pool->slots[idx].period)
+#define SLOT_EXPIRE(idx) (pool->slots[idx].expire_time)
+#define SLOT_CALLBACK(idx) (pool->slots[idx].callback)
+#define SLOT_USER_DATA(idx) (pool->slots[idx].user_data)
+#define SLOT_META(idx) (pool->slots[idx].meta)
+#elif SAFETIMER_STATIC_TIMERS == 0
+/* Per-slot field access (struct-of-arrays layout, see safetimer_pool_t) */
+#define SLOT_PERIOD(idx) (pool->period[idx])
+#define SLOT_EXPIRE(idx) (pool->expire_time[idx])
+#define SLOT_CALLBACK(idx) (pool->callback[idx])
+#define SLOT_USER_DATA(idx) (pool->user_data[idx])
+#define SLOT_META(idx) (pool->meta[idx])
+#else
+/* Struct-of-arrays with static slots: read-only fields from the ROM table,
+ * runtime slots shifted down by SAFETIMER_STATIC_TIMERS */
+#define SLOT_PERIOD(idx)                                                       \
+  (SLOT_IS_STATIC(idx) ? SLOT_ROM(idx).period : pool->period[SLOT_RAM(idx)])
+#define SLOT_EXPIRE(idx) (pool->expire_time[idx])
+#define SLOT_CALLBACK(idx)                                                     \
+  (SLOT_IS_STATIC(idx) ? SLOT_ROM(idx).callback                                \
+                       : pool->callback[SLOT_RAM(idx)])
+#define SLOT_USER_DATA(idx)                                                    \
+  (SLOT_IS_STATIC(idx) ? SLOT_ROM(idx).user_data                               \
+                       : pool->user_data[SLOT_RAM(idx)])
+#define SLOT_META(idx) (pool->meta[idx])
+#define SLOT_SET_PERIOD(idx, val) (pool->period[SLOT_RAM(idx)] = (val))
+#define SLOT_SET_CALLBACK(idx, val) (pool->callback[SLOT_RAM(idx)] = (val))
+#define SLOT_SET_USER_DATA(idx, val) (pool->user_data[SLOT_RAM(idx)] = (val))
+#endif /* SAFETIMER_POOL_SOA */
+
+#if SAFETIMER_STATIC_TIMERS == 0
+/* Writes to the runtime fields (never on a static slot) */
+#if SAFETIMER_COMPACT_SLOTS
+#define SLOT_SET_PERIOD(idx, val)                                              \
+  (pool->slots[idx].period =                                                   \
+       (uint8_t)((val) / SAFETIMER_COMPACT_PERIOD_UNIT))
+#else
+#define SLOT_SET_PERIOD(idx, val) (SLOT_PERIOD(idx) = (val))
+#endif
+#define SLOT_SET_CALLBACK(idx, val) (SLOT_CALLBACK(idx) = (val))
+#if SAFETIMER_COMPACT_SLOTS == 2
+#define SLOT_SET_USER_DATA(idx, val) ((void)(val)) /* Not stored */
+#else
+#define SLOT_SET_USER_DATA(idx, val) (SLOT_USER_DATA(idx) = (val))
+#endif
+#endif
+
+/* Deadline writes (compact 32-bit: val becomes the epoch, low half kept) */
+#if SAFETIMER_COMPACT_SLOTS && !BSP_TICK_TYPE_16BIT
+#define SLOT_SET_EXPIRE(idx, val)                                              \
+  (pool->epoch = (val),                                                        \
+   pool->slots[idx].expire_time = (uint16_t)pool->epoch)
+#else
+#define SLOT_SET_EXPIRE(idx, val) (SLOT_EXPIRE(idx) = (val))
+#endif
+
+/* Period accepted by the slot layout (compact: whole units only) */
+#if SAFETIMER_COMPACT_SLOTS
+#define PERIOD_OFF_UNIT(p) (((p) % SAFETIMER_COMPACT_PERIOD_UNIT) != 0)
+#else
+#define PERIOD_OFF_UNIT(p) 0
+#endif
+
+/* Bitmap geometry (safetimer_bitmap_t, BITMAP_WORDS: safetimer_pool.h) */
+#define BITMAP_LAST_BITS (MAX_TIMERS - (BITMAP_WORDS - 1) * BITMAP_WORD_BITS)
+
+/* Bits of word w that map to real slots (shifts split to stay defined) */
+#define BITMAP_ALL_MASK                                                        \
+  ((safetimer_bitmap_t)(((BITMAP_ONE << (BITMAP_WORD_BITS - 1)) << 1) - 1U))
+#define BITMAP_LAST_MASK                                                       \
+  ((safetimer_bitmap_t)(((BITMAP_ONE << (BITMAP_LAST_BITS - 1)) << 1) - 1U))
+#define BITMAP_POOL_MASK(w)                                                    \
+  ((w) == BITMAP_WORDS - 1 ? BITMAP_LAST_MASK : BITMAP_ALL_MASK)
+
+/* Bits of word w that map to static slots (always allocated) */
+#if SAFETIMER_STATIC_TIMERS > 0
+#define BITMAP_STATIC_BITS(w)                                                  \
+  (SAFETIMER_STATIC_TIMERS - (w) * BITMAP_WORD_BITS)
+#define BITMAP_STATIC_MASK(w)                                                  \
+  ((w) * BITMAP_WORD_BITS >= SAFETIMER_STATIC_TIMERS                           \
+       ? (safetimer_bitmap_t)0                                                 \
+   : BITMAP_STATIC_BITS(w) >= BITMAP_WORD_BITS                                 \
+       ? BITMAP_ALL_MASK                                                       \
+       : (safetimer_bitmap_t)((BITMAP_ONE << BITMAP_STATIC_BITS(w)) - 1U))
+#else
+#define BITMAP_STATIC_MASK(w) ((safetimer_bitmap_t)0)
+#endif
+
+/* Free runtime slots of word w (not used, not static) */
+#define BITMAP_FREE_WORD(pool, w)                                              \
+  ((safetimer_bitmap_t)(~((pool)->used_bitmap[w] | BITMAP_STATIC_MASK(w)) &    \
+                        BITMAP_POOL_MASK(w)))
+
+/* Single-bit access on a bitmap array */
+#define BITMAP_BIT(idx)                                                        \
+  ((safetimer_bitmap_t)(BITMAP_ONE << ((idx) % BITMAP_WORD_BITS)))
+#define BITMAP_TEST(map, idx)                                                  \
+  ((uint8_t)(((map)[(idx) / BITMAP_WORD_BITS] & BITMAP_BIT(idx)) != 0))
+#define BITMAP_SET(map, idx)                                                   \
+  ((map)[(idx) / BITMAP_WORD_BITS] |= BITMAP_BIT(idx))
+#define BITMAP_CLEAR(map, idx)                                                 \
+  ((map)[(idx) / BITMAP_WORD_BITS] &= (safetimer_bitmap_t)~BITMAP_BIT(idx))
+
+/**
+ * @brief Bit scan helpers for bitmap iteration
+ *
+ * BITMAP_CTZ(map): index of lowest set bit (map must be non-zero)
+ * BITMAP_POPCOUNT(map): number of set bits
+ *
+ * GCC/Clang map these to single instructions where the core has them
+ * (CLZ/RBIT on Cortex-M3+, BSF/POPCNT on x86). Other compilers (SDCC,
+ * Keil C51) use the portable loops in bitmap_ctz()/bitmap_popcount(),
+ * which only iterate up to the lowest set bit / over set bits.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#if MAX_TIMERS <= 8
+#define BITMAP_CTZ(map) ((uint8_t)__builtin_ctz((unsigned int)(map)))
+#define BITMAP_POPCOUNT(map) ((uint8_t)__builtin_popcount((unsigned int)(map)))
+#else
+#define BITMAP_CTZ(map) ((uint8_t)__builtin_ctzl((unsigned long)(map)))
+#define BITMAP_POPCOUNT(map)                                                   \
+  ((uint8_t)__builtin_popcountl((unsigned long)(map)))
+#endif
+#else
+#define BITMAP_CTZ(map) bitmap_ctz(map)
+#define BITMAP_POPCOUNT(map) bitmap_popcount(map)
+#define BITMAP_PORTABLE_BITOPS
+#endif
 
-#define SLOT_SET_GEN(slot, val)                                                \
+/* Active state lives in active_bitmap (not in meta) so the dispatch loop
+ * can visit only running timers. */
+#define SLOT_GET_ACTIVE(idx) BITMAP_TEST(pool->active_bitmap, idx)
+#define SLOT_SET_ACTIVE(idx, val)                                              \
   do {                                                                         \
-    (slot).meta =                                                              \
-        ((slot).meta & ~META_MASK_GEN) | (((val) & 0x3F) << META_SHIFT_GEN);   \
+    if (val)                                                                   \
+      BITMAP_SET(pool->active_bitmap, idx);                                    \
+    else                                                                       \
+      BITMAP_CLEAR(pool->active_bitmap, idx);                                  \
   } while (0)
-#define SLOT_GET_GEN(slot) (((slot).meta & META_MASK_GEN) >> META_SHIFT_GEN)
 
+/* Allocation state (used_bitmap) */
+#if SAFETIMER_STATIC_TIMERS > 0
+#define SLOT_IS_USED(idx)                                                      \
+  (SLOT_IS_STATIC(idx) || BITMAP_TEST(pool->used_bitmap, idx))
+#else
+#define SLOT_IS_USED(idx) BITMAP_TEST(pool->used_bitmap, idx)
+#endif
+
+/* Split one priority level off a due bitmap (single level: due itself) */
+#if SAFETIMER_PRIORITY_LEVELS > 1
+#define PRIO_TAKE_LEVEL(level, due, level_due)                                 \
+  prio_take_level(pool, level, due, level_due)
+#else
+#define PRIO_TAKE_LEVEL(level, due, level_due) ((void)0)
 #endif
 
 /**
- * @brief Timer slot structure (13 bytes per timer with meta compression)
+ * @brief Pool critical section
  *
- * Memory layout (8-bit MCU, 2-byte pointers):
- *   period:          4 bytes (uint32_t)
- *   expire_time:     4 bytes (uint32_t / bsp_tick_t)
- *   callback:        2 bytes (function pointer)
- *   user_data:       2 bytes (void pointer)
- *   meta:            1 byte  (active:1 + mode:1 + generation:6)
- *   TOTAL:          13 bytes/timer (11 bytes w/ 16-bit ticks)
+ * Defaults to the BSP critical section; with SAFETIMER_ENABLE_POOL_LOCK a
+ * pool may install its own lock (safetimer_pool_set_lock()) so pools owned
+ * by different cores or subsystems do not contend on one global lock.
  */
-typedef struct {
-  bsp_tick_t period;      /**< Timer period in milliseconds */
-  bsp_tick_t expire_time; /**< Expiration timestamp (for overflow algorithm) */
-  timer_callback_t callback; /**< User callback function (can be NULL) */
-#if SAFETIMER_ENABLE_USER_DATA
-  void *user_data; /**< User data passed to callback */
+#if SAFETIMER_ENABLE_POOL_LOCK
+#define POOL_LOCK(pool)                                                        \
+  ((pool)->enter_critical != NULL ? (pool)->enter_critical()                   \
+                                  : bsp_enter_critical())
+#define POOL_UNLOCK(pool)                                                      \
+  ((pool)->exit_critical != NULL ? (pool)->exit_critical()                     \
+                                 : bsp_exit_critical())
+#else
+#define POOL_LOCK(pool) bsp_enter_critical()
+#define POOL_UNLOCK(pool) bsp_exit_critical()
+#endif
+
+#if SAFETIMER_ENABLE_CRIT_PROFILE
+/* Timed critical section, also profiled per call site (statement only) */
+#define POOL_ENTER_CRITICAL(pool)                                              \
+  do {                                                                         \
+    static safetimer_crit_site_t crit_site = SAFETIMER_CRIT_SITE_INIT;         \
+    POOL_LOCK(pool);                                                           \
+    crit_site_enter(&crit_site);                                               \
+    (pool)->critical_start = bsp_get_cycles();                                 \
+  } while (0)
+#define POOL_EXIT_CRITICAL(pool)                                               \
+  (stats_critical_done(pool), POOL_UNLOCK(pool))
+#elif SAFETIMER_STATS_CYCLES
+/* Timed critical section (pool_stats.max_critical) */
+#define POOL_ENTER_CRITICAL(pool)                                              \
+  (POOL_LOCK(pool), (void)((pool)->critical_start = bsp_get_cycles()))
+#define POOL_EXIT_CRITICAL(pool)                                               \
+  (stats_critical_done(pool), POOL_UNLOCK(pool))
+#else
+#define POOL_ENTER_CRITICAL(pool) POOL_LOCK(pool)
+#define POOL_EXIT_CRITICAL(pool) POOL_UNLOCK(pool)
+#endif
+
+/* Attribute the following critical sections to a public API group */
+#if SAFETIMER_ENABLE_CRIT_PROFILE
+#define CRIT_API(group) ((void)(g_crit_profile.api = (uint8_t)(group)))
+#else
+#define CRIT_API(group) ((void)0)
+#endif
+
+/* One process pass, timed into pool_stats.max_pass with statistics */
+#if SAFETIMER_ENABLE_STATS
+#define PROCESS_PASS(pool, max_callbacks, max_ticks)                           \
+  process_pass_timed(pool, max_callbacks, max_ticks)
+#else
+#define PROCESS_PASS(pool, max_callbacks, max_ticks)                           \
+  process_pass(pool, max_callbacks, max_ticks)
 #endif
-  timer_meta_t meta; /**< Compressed state: active(1)+mode(1)+gen(6) */
-} timer_slot_t;
 
+#if SAFETIMER_ENABLE_STATS
 /**
- * @brief Bitmap type selection based on MAX_TIMERS
+ * @brief Statistics timebase
  *
- * Automatically selects the smallest type that can hold MAX_TIMERS bits:
- * - MAX_TIMERS <= 8:  uint8_t  (saves 3 bytes RAM)
- * - MAX_TIMERS <= 32: uint32_t (supports more timers)
+ * STATS_NOW() samples the timebase, STATS_ELAPSED(start) returns the time
+ * since a sample (wrap-safe in the timebase width).
  */
-#if MAX_TIMERS <= 8
-typedef uint8_t safetimer_bitmap_t;
-#define BITMAP_ONE 1U
+#if SAFETIMER_STATS_CYCLES
+#define STATS_NOW() bsp_get_cycles()
+#define STATS_ELAPSED(start) ((uint32_t)(bsp_get_cycles() - (start)))
+#else
+#define STATS_NOW() ((uint32_t)bsp_get_ticks())
+#define STATS_ELAPSED(start)                                                   \
+  ((uint32_t)(bsp_tick_t)(bsp_get_ticks() - (bsp_tick_t)(start)))
+#endif
+#endif /* SAFETIMER_ENABLE_STATS */
+
+#if SAFETIMER_ENGINE == SAFETIMER_ENGINE_WHEEL
+#define WHEEL_NONE 0U
+#define WHEEL_MASK ((bsp_tick_t)(SAFETIMER_WHEEL_SIZE - 1))
+#define WHEEL_HEAD_TAG(bucket) ((wheel_link_t)(MAX_TIMERS + 1 + (bucket)))
+#endif /* SAFETIMER_ENGINE_WHEEL */
+
+#if SAFETIMER_ENGINE == SAFETIMER_ENGINE_HEAP
+/* Heap order: slot a expires before slot b (wrap-safe) */
+#define HEAP_BEFORE(a, b)                                                      \
+  (safetimer_tick_diff(SLOT_EXPIRE(a), SLOT_EXPIRE(b)) < 0)
+
+/* Earliest running timer is due (evaluate inside critical section) */
+#define HEAP_ROOT_DUE(now)                                                     \
+  (pool->heap_size != 0 &&                                                     \
+   safetimer_tick_diff((now), SLOT_EXPIRE(pool->heap[0])) >= 0)
+#endif
+
+#if SAFETIMER_ENABLE_ISR_QUEUE
+/* ISR command ring (safetimer_isr_cmd_t.op values) */
+#define ISR_CMD_START 0U
+#define ISR_CMD_STOP 1U
+#define ISR_CMD_SET_PERIOD 2U
+#define ISR_CMD_DELETE 3U
+#define ISR_CMD_TRIGGER 4U
+#define ISR_CMD_SEM_WAKE 5U /* Target is isr_queue[].sem, not a handle */
+
+#define ISR_QUEUE_MASK (SAFETIMER_ISR_QUEUE_SIZE - 1U)
+#endif
+
+#if SAFETIMER_ENABLE_CORO_SCHED
+/* Scheduler timer period once every task exited (half the tick range) */
+#if BSP_TICK_TYPE_16BIT
+#define SCHED_IDLE_PERIOD 0x7FFFUL
+#else
+#define SCHED_IDLE_PERIOD 0x7FFFFFFFUL
+#endif
+#endif
+
+/* Due timers carried over by a budget-stopped pass (wheel/heap engines) */
+#if SAFETIMER_ENABLE_PROCESS_BUDGET &&                                         \
+    SAFETIMER_ENGINE != SAFETIMER_ENGINE_BITMAP
+#define RESUME_PENDING() (pool->resume_pending != 0)
 #else
-typedef uint32_t safetimer_bitmap_t;
-#define BITMAP_ONE 1UL
+#define RESUME_PENDING() 0
 #endif
 
 /**
- * @brief Timer pool structure (global state)
+ * @brief Earliest-deadline cache states (pool->expiry_state)
+ *
+ * Lets safetimer_process() skip the slot scan with a single tick compare
+ * while nothing is due:
+ * - STALE:    next_expiry unknown, next pass must scan (zero-init default)
+ * - VALID:    next_expiry is the exact earliest deadline of all active timers
+ * - IDLE:     no timer is active, nothing can expire
+ * - SCANNING: safetimer_process() is rebuilding the cache; any concurrent
+ *             modification downgrades it to STALE so the result is discarded
+ *
+ * Deadlines moving earlier are folded in directly (expiry_cache_lower());
+ * removing or postponing the current earliest deadline marks the cache STALE
+ * (expiry_cache_raise()) rather than rescanning inside the critical section.
+ */
+#define EXPIRY_CACHE_STALE 0U
+#define EXPIRY_CACHE_VALID 1U
+#define EXPIRY_CACHE_IDLE 2U
+#define EXPIRY_CACHE_SCANNING 3U
+
+/* Nothing can be due yet (evaluate inside critical section) */
+#define EXPIRY_CACHE_NOTHING_DUE(now)                                          \
+  (pool->expiry_state == EXPIRY_CACHE_IDLE ||                                  \
+   (pool->expiry_state == EXPIRY_CACHE_VALID &&                                \
+    safetimer_tick_diff((now), pool->next_expiry) < 0))
+
+/**
+ * @brief Engine hooks (called inside critical section)
  *
- * Memory layout:
- *   slots:           MAX_TIMERS * 13 bytes (timer_slot_t array)
- *   used_bitmap:     1 or 4 bytes (depends on MAX_TIMERS)
- *   next_generation: 1 byte (uint8_t, global generation counter)
+ * SCHED_ARM(idx):    timer became active or its expire_time changed
+ * SCHED_DISARM(idx): timer stopped (deleted, stopped, ONE_SHOT fired)
+ *
+ * The bitmap engine reads active_bitmap directly, so both are no-ops.
+ */
+#if SAFETIMER_ENGINE == SAFETIMER_ENGINE_WHEEL
+#define SCHED_ARM(idx)                                                         \
+  do {                                                                         \
+    wheel_unlink(pool, idx);                                                   \
+    wheel_link(pool, idx);                                                     \
+  } while (0)
+#define SCHED_DISARM(idx) wheel_unlink(pool, idx)
+#elif SAFETIMER_ENGINE == SAFETIMER_ENGINE_HEAP && SAFETIMER_ENABLE_HW_COMPARE
+/* The hardware compare follows the heap root */
+#define SCHED_ARM(idx)                                                         \
+  do {                                                                         \
+    heap_update(pool, idx);                                                    \
+    hw_compare_sync(pool);                                                     \
+  } while (0)
+#define SCHED_DISARM(idx)                                                      \
+  do {                                                                         \
+    heap_remove(pool, idx);                                                    \
+    hw_compare_sync(pool);                                                     \
+  } while (0)
+#elif SAFETIMER_ENGINE == SAFETIMER_ENGINE_HEAP
+#define SCHED_ARM(idx) heap_update(pool, idx)
+#define SCHED_DISARM(idx) heap_remove(pool, idx)
+#else
+#define SCHED_ARM(idx) ((void)0)
+#define SCHED_DISARM(idx) ((void)0)
+#endif
+
+#if SAFETIMER_ENABLE_HW_COMPARE
+/* Compare match at 'tick' even if already programmed there (work left) */
+#define HW_COMPARE_NOW(pool, tick)                                             \
+  do {                                                                         \
+    (pool)->hw_armed = 0;                                                      \
+    hw_compare_arm(pool, tick);                                                \
+  } while (0)
+/* End of a bitmap pass: follow the published cache, or rescan at once */
+#define HW_COMPARE_PASS_END(pool, tick)                                        \
+  do {                                                                         \
+    if ((pool)->expiry_state == EXPIRY_CACHE_STALE) {                          \
+      HW_COMPARE_NOW(pool, tick);                                              \
+    } else {                                                                   \
+      hw_compare_sync(pool);                                                   \
+    }                                                                          \
+  } while (0)
+#else
+#define HW_COMPARE_NOW(pool, tick) ((void)0)
+#define HW_COMPARE_PASS_END(pool, tick) ((void)0)
+#endif
+
+#if SAFETIMER_PROCESS_SNAPSHOT
+/**
+ * @brief Expired timer captured by a snapshot dispatch pass
  *
- * For MAX_TIMERS=4:  4*13 + 1 + 1 = 54 bytes (was 62)
- * For MAX_TIMERS=8:  8*13 + 1 + 1 = 106 bytes (was 122)
- * For MAX_TIMERS=16: 16*13 + 4 + 1 = 213 bytes (was 245)
+ * Holds everything needed to finish the timer outside the collection
+ * critical section; callback is cleared when commit-time validation fails.
  */
 typedef struct {
-  timer_slot_t slots[MAX_TIMERS]; /**< Timer slot array */
-  safetimer_bitmap_t used_bitmap; /**< Bitmap of used slots */
-  uint8_t next_generation; /**< Next generation ID (1~7, wraps, 0 reserved) */
-} safetimer_pool_t;
+  bsp_tick_t old_expire;     /**< Deadline that expired */
+  bsp_tick_t new_expire;     /**< Next deadline, then deadline at commit */
+  bsp_tick_t period;         /**< Period at collection time */
+  timer_callback_t callback; /**< Callback, NULL if nothing to invoke */
+#if SAFETIMER_ENABLE_USER_DATA
+  void *user_data; /**< User data at collection time */
+#endif
+  slot_index_t index; /**< Slot index */
+  uint8_t generation; /**< Generation at collection time (ABA check) */
+  uint8_t armed;      /**< Active bit at commit time */
+#if !SAFETIMER_REPEAT_ONLY
+  uint8_t mode; /**< Mode at collection time */
+#endif
+#if (SAFETIMER_ENABLE_STATS || SAFETIMER_ENABLE_TRACE ||                      \
+     SAFETIMER_ENABLE_CATCHUP == SAFETIMER_CATCHUP_REPORT) &&                  \
+    SAFETIMER_ENABLE_CATCHUP != SAFETIMER_CATCHUP_BURST
+  uint32_t missed; /**< Periods coalesced by new_expire */
+#endif
+} dispatch_entry_t;
+#endif /* SAFETIMER_PROCESS_SNAPSHOT */
 
-/* Compile-time validation: MAX_TIMERS must not exceed bitmap width */
-#if MAX_TIMERS > 32
-#error "SafeTimer bitmap only supports MAX_TIMERS <= 32"
+/* Compile-time validation: bitmap engine scans a single bitmap word */
+#if SAFETIMER_ENGINE == SAFETIMER_ENGINE_BITMAP && MAX_TIMERS > 32
+#error "SafeTimer bitmap engine only supports MAX_TIMERS <= 32"
 #endif
 
 /* ========== Global Variables ========== */
 
 /**
- * @brief Global timer pool
+ * @brief Default timer pool (used by the pool-less API)
  *
  * Initialized to zero by C standard (all timers inactive at startup).
  * next_generation starts at 0 and will be incremented to 1 on first use.
  * Protected by BSP critical sections during modifications.
- */
-static safetimer_pool_t g_timer_pool = {0};
-
-/**
- * @brief Recursion guard flag (prevents Trap #19: Recursive Stack Overflow)
  *
- * Set to 1 when safetimer_process() is executing.
- * If callback erroneously calls safetimer_process() again, the guard
- * prevents recursion and returns immediately.
- *
- * RAM cost: +1 byte
+ * The recursion guard (processing) and the executing handle for coroutine
+ * auto-binding live in the pool, so every pool dispatches independently.
  */
-static volatile uint8_t s_processing = 0;
+static safetimer_pool_t g_timer_pool = {0};
 
+#if SAFETIMER_ENABLE_CRIT_PROFILE
 /**
- * @brief Currently executing timer handle (for auto-binding coroutines)
+ * @brief Critical section profile
  *
- * Set to the active handle during callback execution in safetimer_process().
- * Allows coroutines to discover their own handle via
- * safetimer_get_current_handle().
- *
- * RAM cost: +1 byte
+ * Global, not per pool: profiling requires the one BSP lock
+ * (SAFETIMER_ENABLE_POOL_LOCK=0), so at most one section runs at a time and
+ * current/start belong to it. api is the group of the public API running,
+ * set at API entry (ISR entry points restore the interrupted one).
  */
-static safetimer_handle_t g_executing_handle = SAFETIMER_INVALID_HANDLE;
+static struct {
+  safetimer_crit_site_t *sites;   /* Registered sites, newest first */
+  safetimer_crit_site_t *current; /* Site of the running section */
+  uint32_t start;                 /* Cycles at safetimer_crit_enter() */
+  uint32_t api_max[SAFETIMER_API_COUNT];
+  uint8_t api; /* safetimer_api_t of the running API */
+} g_crit_profile;
+#endif
 
 /* ========== Handle Encoding/Decoding (ABA Prevention) ========== */
 /* Moved to top of file to support struct definition */
@@ -225,11 +577,129 @@ static safetimer_handle_t g_executing_handle = SAFETIMER_INVALID_HANDLE;
 /* ========== Static Function Prototypes ========== */
 
 STATIC int32_t safetimer_tick_diff(bsp_tick_t lhs, bsp_tick_t rhs);
-STATIC int validate_handle(safetimer_handle_t handle);
-STATIC int find_free_slot(void);
-STATIC void update_expire_time(uint8_t slot_index, bsp_tick_t current_tick);
-STATIC void trigger_timer(uint8_t slot_index, bsp_tick_t current_tick,
-                          timer_callback_t *callback_out, void **user_data_out);
+STATIC int validate_handle(safetimer_pool_t *pool, safetimer_handle_t handle);
+STATIC int find_free_slot(safetimer_pool_t *pool);
+STATIC safetimer_handle_t alloc_slot(safetimer_pool_t *pool,
+                                     slot_index_t slot_index,
+                                     bsp_tick_t period, timer_mode_t mode,
+                                     timer_callback_t callback,
+                                     void *user_data);
+STATIC void update_expire_time(safetimer_pool_t *pool, slot_index_t slot_index,
+                               bsp_tick_t current_tick);
+STATIC void trigger_timer(safetimer_pool_t *pool, slot_index_t slot_index,
+                          bsp_tick_t current_tick,
+                          timer_callback_t *callback_out,
+                          void **user_data_out);
+STATIC void start_slot(safetimer_pool_t *pool, slot_index_t slot_index,
+                       bsp_tick_t start_tick);
+STATIC void arm_slot(safetimer_pool_t *pool, slot_index_t slot_index,
+                     bsp_tick_t start_tick);
+STATIC void stop_slot(safetimer_pool_t *pool, slot_index_t slot_index,
+                      uint8_t release);
+STATIC void wake_slot(safetimer_pool_t *pool, slot_index_t slot_index,
+                      bsp_tick_t current_tick);
+STATIC void set_period_slot(safetimer_pool_t *pool, slot_index_t slot_index,
+                            bsp_tick_t period, bsp_tick_t current_tick);
+#if SAFETIMER_ENABLE_ISR_QUEUE
+STATIC timer_error_t isr_queue_push(safetimer_pool_t *pool,
+                                    safetimer_handle_t handle, uint8_t op,
+                                    bsp_tick_t period);
+STATIC void isr_queue_drain(safetimer_pool_t *pool);
+#endif
+#if SAFETIMER_ENABLE_SEM_WAKE
+STATIC void sem_wake_waiters(safetimer_pool_t *pool, const volatile void *sem,
+                             bsp_tick_t current_tick);
+#endif
+STATIC uint32_t calc_missed_periods(uint32_t lag, uint32_t period);
+#if SAFETIMER_ENABLE_CORO_SCHED
+STATIC void sched_timer_callback(void *user_data);
+#endif
+#if SAFETIMER_ENABLE_CATCHUP != SAFETIMER_CATCHUP_BURST
+STATIC bsp_tick_t calc_skip_expire(bsp_tick_t old_expire, bsp_tick_t period,
+                                   bsp_tick_t current_tick,
+                                   uint32_t *missed_out);
+#endif
+#if SAFETIMER_ENABLE_STATS
+STATIC void stats_clear_slot(safetimer_pool_t *pool, slot_index_t slot_index);
+STATIC void stats_record_expiry(safetimer_pool_t *pool,
+                                slot_index_t slot_index,
+                                bsp_tick_t current_tick);
+STATIC void stats_record_duration(safetimer_pool_t *pool,
+                                  slot_index_t slot_index, uint32_t start);
+#endif
+#if SAFETIMER_STATS_CYCLES
+STATIC void stats_critical_done(safetimer_pool_t *pool);
+#endif
+#if SAFETIMER_ENABLE_CRIT_PROFILE
+STATIC void crit_site_enter(safetimer_crit_site_t *site);
+STATIC void crit_profile_record(uint8_t api, uint32_t elapsed);
+#endif
+#if SAFETIMER_ENABLE_TRACE
+STATIC void trace_record(safetimer_pool_t *pool, slot_index_t slot_index,
+                         uint8_t event, bsp_tick_t tick, uint32_t arg);
+STATIC void trace_expiry(safetimer_pool_t *pool, slot_index_t slot_index,
+                         bsp_tick_t current_tick);
+#endif
+#if SAFETIMER_ENABLE_SLACK && !SAFETIMER_PROCESS_SNAPSHOT
+STATIC uint8_t slack_wakeup(safetimer_pool_t *pool, bsp_tick_t current_tick,
+                            const safetimer_bitmap_t *running);
+#endif
+#if SAFETIMER_PRIORITY_LEVELS > 1
+STATIC void prio_assign(safetimer_pool_t *pool, slot_index_t slot_index,
+                        uint8_t priority);
+STATIC void prio_take_level(safetimer_pool_t *pool, uint8_t level,
+                            safetimer_bitmap_t *due,
+                            safetimer_bitmap_t *level_due);
+#endif
+#ifdef BITMAP_PORTABLE_BITOPS
+STATIC uint8_t bitmap_ctz(safetimer_bitmap_t map);
+STATIC uint8_t bitmap_popcount(safetimer_bitmap_t map);
+#endif
+#if SAFETIMER_PROCESS_SNAPSHOT
+STATIC uint8_t snapshot_entry_alive(safetimer_pool_t *pool,
+                                    const dispatch_entry_t *entry);
+STATIC void process_snapshot_pass(safetimer_pool_t *pool,
+                                  bsp_tick_t current_tick);
+#endif
+STATIC uint8_t process_pass(safetimer_pool_t *pool, uint16_t max_callbacks,
+                            uint32_t max_ticks);
+#if SAFETIMER_ENABLE_STATS
+STATIC uint8_t process_pass_timed(safetimer_pool_t *pool,
+                                  uint16_t max_callbacks, uint32_t max_ticks);
+#endif
+STATIC uint8_t dispatch_slot(safetimer_pool_t *pool, slot_index_t i,
+                             bsp_tick_t current_tick, uint8_t coalesce,
+                             bsp_tick_t *scan_next_expiry,
+                             uint8_t *scan_has_next);
+#if SAFETIMER_ENABLE_PROCESS_BUDGET && !SAFETIMER_PROCESS_SNAPSHOT &&          \
+    SAFETIMER_ENGINE == SAFETIMER_ENGINE_BITMAP
+STATIC uint8_t budget_slot_due(safetimer_pool_t *pool, slot_index_t i,
+                               bsp_tick_t current_tick, uint8_t coalesce,
+                               bsp_tick_t *scan_next_expiry,
+                               uint8_t *scan_has_next);
+#endif
+#if SAFETIMER_ENGINE == SAFETIMER_ENGINE_WHEEL
+STATIC void wheel_link(safetimer_pool_t *pool, slot_index_t slot_index);
+STATIC void wheel_unlink(safetimer_pool_t *pool, slot_index_t slot_index);
+STATIC void wheel_collect_due(safetimer_pool_t *pool, bsp_tick_t from_tick,
+                              bsp_tick_t current_tick,
+                              safetimer_bitmap_t *due);
+#endif
+#if SAFETIMER_ENGINE == SAFETIMER_ENGINE_HEAP
+STATIC void heap_place(safetimer_pool_t *pool, uint16_t pos,
+                       slot_index_t slot_index);
+STATIC void heap_sift_up(safetimer_pool_t *pool, uint16_t pos);
+STATIC void heap_sift_down(safetimer_pool_t *pool, uint16_t pos);
+STATIC void heap_update(safetimer_pool_t *pool, slot_index_t slot_index);
+STATIC void heap_remove(safetimer_pool_t *pool, slot_index_t slot_index);
+#endif
+STATIC void expiry_cache_lower(safetimer_pool_t *pool, bsp_tick_t expire_time);
+STATIC void expiry_cache_raise(safetimer_pool_t *pool,
+                               bsp_tick_t old_expire_time);
+#if SAFETIMER_ENABLE_HW_COMPARE
+STATIC void hw_compare_arm(safetimer_pool_t *pool, bsp_tick_t deadline);
+STATIC void hw_compare_sync(safetimer_pool_t *pool);
+#endif
 
 /* ========== Internal Helper Functions ========== */
 
@@ -270,6 +740,171 @@ STATIC int32_t safetimer_tick_diff(bsp_tick_t lhs, bsp_tick_t rhs) {
 
 /* ========== Public API Implementation ========== */
 
+/**
+ * @brief Initialize (or reset) a timer pool
+ *
+ * Implementation details:
+ * - Leaves the pool in the same state as zero-initialized static storage
+ * - Not synchronized: no other context may use the pool meanwhile
+ */
+void safetimer_pool_init(safetimer_pool_t *pool) {
+  slot_index_t i;
+  uint8_t w;
+#if SAFETIMER_ENGINE == SAFETIMER_ENGINE_WHEEL
+  uint16_t bucket;
+#endif
+#if SAFETIMER_PRIORITY_LEVELS > 1
+  uint8_t level;
+#endif
+
+#if ENABLE_PARAM_CHECK
+  if (pool == NULL) {
+    return;
+  }
+#endif
+
+  for (i = SAFETIMER_STATIC_TIMERS; i < MAX_TIMERS; i++) {
+    SLOT_SET_PERIOD(i, 0);
+    SLOT_SET_CALLBACK(i, NULL);
+#if SAFETIMER_ENABLE_USER_DATA
+    SLOT_SET_USER_DATA(i, NULL);
+#endif
+  }
+  for (i = 0; i < MAX_TIMERS; i++) {
+    SLOT_SET_EXPIRE(i, 0);
+#if USE_BITFIELD_META
+    SLOT_META(i).flag = 0;
+    SLOT_META(i).mode = 0;
+    SLOT_META(i).generation = 0;
+#else
+    SLOT_META(i) = 0;
+#endif
+  }
+  for (w = 0; w < BITMAP_WORDS; w++) {
+    pool->used_bitmap[w] = 0;
+    pool->active_bitmap[w] = 0;
+  }
+  pool->next_generation = 0;
+#if SAFETIMER_ENABLE_STATS
+  for (i = 0; i < MAX_TIMERS; i++) {
+    stats_clear_slot(pool, i);
+  }
+  pool->pool_stats.max_pass = 0;
+  pool->pool_stats.max_critical = 0;
+#if SAFETIMER_STATS_CYCLES
+  pool->critical_start = 0;
+#endif
+#endif
+#if SAFETIMER_ENABLE_TRACE
+  pool->trace_buf = NULL;
+  pool->trace_mask = 0;
+  pool->trace_head = 0;
+#endif
+#if SAFETIMER_PRIORITY_LEVELS > 1
+  for (level = 0; level < SAFETIMER_PRIORITY_LEVELS - 1; level++) {
+    for (w = 0; w < BITMAP_WORDS; w++) {
+      pool->prio_bitmap[level][w] = 0;
+    }
+  }
+#endif
+#if SAFETIMER_ENABLE_SLACK
+  for (i = 0; i < MAX_TIMERS; i++) {
+    pool->slack[i] = 0;
+  }
+  for (w = 0; w < BITMAP_WORDS; w++) {
+    pool->slack_bitmap[w] = 0;
+  }
+#endif
+#if SAFETIMER_ENABLE_SEM_WAKE
+  for (i = 0; i < MAX_TIMERS; i++) {
+    pool->sem_wait[i] = NULL;
+  }
+  for (w = 0; w < BITMAP_WORDS; w++) {
+    pool->sem_bitmap[w] = 0;
+  }
+#endif
+#if SAFETIMER_ENABLE_FLAG_TIMERS
+  for (w = 0; w < BITMAP_WORDS; w++) {
+    pool->expired_bitmap[w] = 0;
+  }
+#endif
+#if SAFETIMER_ENGINE == SAFETIMER_ENGINE_HEAP
+  for (i = 0; i < MAX_TIMERS; i++) {
+    pool->heap[i] = 0;
+    pool->heap_pos[i] = 0;
+  }
+  pool->heap_size = 0;
+#else
+  pool->next_expiry = 0;
+  pool->expiry_state = EXPIRY_CACHE_STALE;
+#endif
+#if SAFETIMER_ENGINE == SAFETIMER_ENGINE_WHEEL
+  for (i = 0; i < MAX_TIMERS; i++) {
+    pool->wheel_next[i] = WHEEL_NONE;
+    pool->wheel_prev[i] = WHEEL_NONE;
+  }
+  for (bucket = 0; bucket < SAFETIMER_WHEEL_SIZE; bucket++) {
+    pool->wheel_head[bucket] = WHEEL_NONE;
+  }
+  pool->wheel_cursor = 0;
+#endif
+#if SAFETIMER_ENABLE_ISR_QUEUE
+  pool->isr_head = 0;
+  pool->isr_tail = 0;
+#endif
+#if SAFETIMER_ENABLE_ISR_DISPATCH
+  pool->ready = 0;
+#endif
+#if SAFETIMER_ENABLE_HW_COMPARE
+  pool->hw_compare = 0;
+  pool->hw_armed = 0;
+#endif
+#if SAFETIMER_ENABLE_PROCESS_BUDGET
+  pool->resume_cursor = 0;
+#if SAFETIMER_ENGINE != SAFETIMER_ENGINE_BITMAP
+  for (w = 0; w < BITMAP_WORDS; w++) {
+    pool->resume_due[w] = 0;
+  }
+  pool->resume_pending = 0;
+#endif
+#endif
+  pool->processing = 0;
+#if SAFETIMER_ENABLE_CORO
+  pool->executing_handle = 0;
+#endif
+#if SAFETIMER_ENABLE_CATCHUP == SAFETIMER_CATCHUP_REPORT
+  pool->executing_missed = 0;
+#endif
+#if SAFETIMER_ENABLE_POOL_LOCK
+  pool->enter_critical = NULL;
+  pool->exit_critical = NULL;
+#endif
+}
+
+#if SAFETIMER_ENABLE_POOL_LOCK
+/**
+ * @brief Install a per-pool critical section
+ *
+ * Implementation details:
+ * - Both hooks NULL restores bsp_enter_critical()/bsp_exit_critical()
+ * - Must be called before the pool is shared with other contexts
+ */
+timer_error_t safetimer_pool_set_lock(safetimer_pool_t *pool,
+                                      void (*enter_critical)(void),
+                                      void (*exit_critical)(void)) {
+#if ENABLE_PARAM_CHECK
+  if (pool == NULL || (enter_critical == NULL) != (exit_critical == NULL)) {
+    return TIMER_ERR_INVALID; /* Hooks must be installed as a pair */
+  }
+#endif
+
+  pool->enter_critical = enter_critical;
+  pool->exit_critical = exit_critical;
+
+  return TIMER_OK;
+}
+#endif /* SAFETIMER_ENABLE_POOL_LOCK */
+
 /**
  * @brief Create a new timer
  *
@@ -280,17 +915,23 @@ STATIC int32_t safetimer_tick_diff(bsp_tick_t lhs, bsp_tick_t rhs) {
  * - Assigns generation counter to prevent ABA handle reuse (fixes Trap #1)
  */
 #if SAFETIMER_ENABLE_USER_DATA
-safetimer_handle_t safetimer_create(uint32_t period_ms, timer_mode_t mode,
-                                    timer_callback_t callback,
-                                    void *user_data) {
+safetimer_handle_t safetimer_create_in(safetimer_pool_t *pool,
+                                       uint32_t period_ms, timer_mode_t mode,
+                                       timer_callback_t callback,
+                                       void *user_data) {
 #else
-safetimer_handle_t safetimer_create(uint32_t period_ms, timer_mode_t mode,
-                                    timer_callback_t callback) {
+safetimer_handle_t safetimer_create_in(safetimer_pool_t *pool,
+                                       uint32_t period_ms, timer_mode_t mode,
+                                       timer_callback_t callback) {
 #endif
   safetimer_handle_t handle;
-  uint8_t slot_index;
+  slot_index_t slot_index;
   int free_slot;
-  uint8_t generation;
+#if SAFETIMER_ENABLE_TRACE
+  bsp_tick_t trace_tick;
+#endif
+
+  CRIT_API(SAFETIMER_API_CREATE);
 
 #if SAFETIMER_REPEAT_ONLY
   /* Force mode to REPEAT if compiled in Repeat-Only mode */
@@ -299,16 +940,14 @@ safetimer_handle_t safetimer_create(uint32_t period_ms, timer_mode_t mode,
 
 #if ENABLE_PARAM_CHECK
   /* Validate parameters */
-  if (period_ms == 0 || period_ms > 0x7FFFFFFFUL) {
-    return SAFETIMER_INVALID_HANDLE; /* Period must be 1 ~ 2^31-1 */
+  if (pool == NULL) {
+    return SAFETIMER_INVALID_HANDLE;
   }
 
-#if BSP_TICK_TYPE_16BIT
-  /* 16-bit mode: max period is 65535ms (fixes Trap #13) */
-  if (period_ms > 65535UL) {
-    return SAFETIMER_INVALID_HANDLE; /* Period exceeds 16-bit limit */
+  if (period_ms == 0 || period_ms > SAFETIMER_MAX_PERIOD ||
+      PERIOD_OFF_UNIT(period_ms)) {
+    return SAFETIMER_INVALID_HANDLE; /* Period: 1 ~ SAFETIMER_MAX_PERIOD */
   }
-#endif
 
 #if !SAFETIMER_REPEAT_ONLY
   if (mode != TIMER_MODE_ONE_SHOT && mode != TIMER_MODE_REPEAT) {
@@ -318,96 +957,252 @@ safetimer_handle_t safetimer_create(uint32_t period_ms, timer_mode_t mode,
   /* In REPEAT_ONLY mode, mode parameter is ignored and forced to REPEAT */
   (void)mode; /* Suppress unused parameter warning */
 #endif
+#if SAFETIMER_ENABLE_USER_DATA && SAFETIMER_COMPACT_SLOTS == 2
+  if (user_data != NULL) {
+    return SAFETIMER_INVALID_HANDLE; /* Compact slots store no user_data */
+  }
+#endif
+#endif
+
+#if SAFETIMER_ENABLE_TRACE
+  trace_tick = bsp_get_ticks(); /* Outside the critical section */
 #endif
 
   /* Find free slot */
-  bsp_enter_critical();
-  free_slot = find_free_slot();
+  POOL_ENTER_CRITICAL(pool);
+  free_slot = find_free_slot(pool);
 
   if (free_slot < 0) {
-    bsp_exit_critical();
+    POOL_EXIT_CRITICAL(pool);
     return SAFETIMER_INVALID_HANDLE; /* Pool full */
   }
 
-  slot_index = (uint8_t)free_slot;
-
-  /* Allocate next generation ID (1~HANDLE_GEN_MAX, wraps, 0 reserved) */
-  g_timer_pool.next_generation++;
-  if (g_timer_pool.next_generation == 0 ||
-      g_timer_pool.next_generation > HANDLE_GEN_MAX) {
-    g_timer_pool.next_generation = 1;
-  }
-  generation = g_timer_pool.next_generation;
-
-  /* Initialize timer slot (cast period_ms to bsp_tick_t for 16-bit mode) */
-  g_timer_pool.slots[slot_index].period = (bsp_tick_t)period_ms;
-  SLOT_SET_MODE(g_timer_pool.slots[slot_index], (uint8_t)mode);
-  g_timer_pool.slots[slot_index].callback = callback;
+  slot_index = (slot_index_t)free_slot;
 #if SAFETIMER_ENABLE_USER_DATA
-  g_timer_pool.slots[slot_index].user_data = user_data;
+  handle = alloc_slot(pool, slot_index, (bsp_tick_t)period_ms, mode, callback,
+                      user_data);
+#else
+  handle = alloc_slot(pool, slot_index, (bsp_tick_t)period_ms, mode, callback,
+                      NULL);
 #endif
-  SLOT_SET_ACTIVE(g_timer_pool.slots[slot_index], 0); /* Not started yet */
-  SLOT_SET_GEN(g_timer_pool.slots[slot_index], generation);
-  g_timer_pool.used_bitmap |= (BITMAP_ONE << slot_index);
-
-  /* Encode handle: [generation:3bit][index:5bit] */
-  handle = ENCODE_HANDLE(generation, slot_index);
 
-  /* Prevent handle collision with SAFETIMER_INVALID_HANDLE (-1)
-   * Edge case: When handle type is int8_t or when generation/index combination
-   * produces -1, we must skip to next generation to ensure valid handle.
-   * Loop guarantees we find a valid handle (max iterations = HANDLE_GEN_MAX).
-   */
-  while (handle == SAFETIMER_INVALID_HANDLE) {
-    g_timer_pool.next_generation++;
-    if (g_timer_pool.next_generation == 0 ||
-        g_timer_pool.next_generation > HANDLE_GEN_MAX) {
-      g_timer_pool.next_generation = 1;
-    }
-    generation = g_timer_pool.next_generation;
-    SLOT_SET_GEN(g_timer_pool.slots[slot_index], generation);
-    handle = ENCODE_HANDLE(generation, slot_index);
-  }
+#if SAFETIMER_ENABLE_TRACE
+  trace_record(pool, slot_index, SAFETIMER_TRACE_CREATE, trace_tick, 0);
+#endif
 
-  bsp_exit_critical();
+  POOL_EXIT_CRITICAL(pool);
 
   return handle;
 }
 
+#if ENABLE_HELPER_API
 /**
- * @brief Start a timer
+ * @brief Create and start a group of timers atomically
  *
  * Implementation details:
- * - Sets expire_time = current_tick + period
- * - Activates timer (sets active=1)
- * - Critical section protects state modification
+ * - One bsp_get_ticks() read and one critical section for the whole
+ *   group: every timer counts from the same base tick (phase-locked)
+ * - Free slots are counted before the first allocation, so an exhausted
+ *   pool leaves nothing allocated (all-or-nothing, nothing to roll back)
+ * - Timer i first expires at base + offsets[i] + period; REPEAT re-arms
+ *   keep that phase
  */
-timer_error_t safetimer_start(safetimer_handle_t handle) {
-  uint8_t slot_index;
-  bsp_tick_t start_tick; /* C89: declare before statements */
-
-#if ENABLE_PARAM_CHECK
-  if (!validate_handle(handle)) {
-    return TIMER_ERR_INVALID;
-  }
+#if SAFETIMER_ENABLE_USER_DATA
+timer_error_t safetimer_create_batch_in(safetimer_pool_t *pool, uint8_t count,
+                                        uint32_t period_ms, timer_mode_t mode,
+                                        timer_callback_t *callbacks,
+                                        void **user_data,
+                                        const uint32_t *offsets,
+                                        safetimer_handle_t *handles) {
+#else
+timer_error_t safetimer_create_batch_in(safetimer_pool_t *pool, uint8_t count,
+                                        uint32_t period_ms, timer_mode_t mode,
+                                        timer_callback_t *callbacks,
+                                        const uint32_t *offsets,
+                                        safetimer_handle_t *handles) {
 #endif
+  bsp_tick_t start_tick;
+  slot_index_t slot_index;
+  uint16_t free_count;
+  uint8_t w;
+  uint8_t i;
 
-  /* Decode handle to get slot index */
-  slot_index = DECODE_INDEX(handle);
+  CRIT_API(SAFETIMER_API_CREATE);
 
-  /* Read BSP tick before entering the SafeTimer critical section to avoid
-   * nested interrupt masking inside bsp_get_ticks(). */
+#if SAFETIMER_REPEAT_ONLY
+  mode = TIMER_MODE_REPEAT;
+#endif
+
+  /* Output and per-timer arrays are required even without PARAM_CHECK */
+  if (pool == NULL || callbacks == NULL || handles == NULL) {
+    return TIMER_ERR_INVALID;
+  }
+#if SAFETIMER_ENABLE_USER_DATA
+  if (user_data == NULL) {
+    return TIMER_ERR_INVALID;
+  }
+#endif
+  for (i = 0; i < count; i++) {
+    handles[i] = SAFETIMER_INVALID_HANDLE;
+  }
+
+#if ENABLE_PARAM_CHECK
+  if (period_ms == 0 || period_ms > SAFETIMER_MAX_PERIOD ||
+      PERIOD_OFF_UNIT(period_ms)) {
+    return TIMER_ERR_INVALID;
+  }
+#if !SAFETIMER_REPEAT_ONLY
+  if (mode != TIMER_MODE_ONE_SHOT && mode != TIMER_MODE_REPEAT) {
+    return TIMER_ERR_INVALID;
+  }
+#endif
+  if (offsets != NULL) {
+    for (i = 0; i < count; i++) {
+      /* Stagger within one period, first interval still a valid period */
+      if (offsets[i] >= period_ms ||
+          offsets[i] > SAFETIMER_MAX_PERIOD - period_ms) {
+        return TIMER_ERR_INVALID;
+      }
+    }
+  }
+#if SAFETIMER_ENABLE_USER_DATA && SAFETIMER_COMPACT_SLOTS == 2
+  for (i = 0; i < count; i++) {
+    if (user_data[i] != NULL) {
+      return TIMER_ERR_INVALID; /* Compact slots store no user_data */
+    }
+  }
+#endif
+#endif
+
+  /* Read BSP tick before entering the SafeTimer critical section */
   start_tick = bsp_get_ticks();
 
-  bsp_enter_critical();
+  POOL_ENTER_CRITICAL(pool);
 
-  /* Update expiration time */
-  update_expire_time(slot_index, start_tick);
+  free_count = 0;
+  for (w = 0; w < BITMAP_WORDS; w++) {
+    free_count += BITMAP_POPCOUNT(BITMAP_FREE_WORD(pool, w));
+  }
+  if (free_count < count) {
+    POOL_EXIT_CRITICAL(pool);
+    return TIMER_ERR_FULL; /* Nothing allocated */
+  }
 
-  /* Mark as active */
-  SLOT_SET_ACTIVE(g_timer_pool.slots[slot_index], 1);
+  for (i = 0; i < count; i++) {
+    slot_index = (slot_index_t)find_free_slot(pool);
+#if SAFETIMER_ENABLE_USER_DATA
+    handles[i] = alloc_slot(pool, slot_index, (bsp_tick_t)period_ms, mode,
+                            callbacks[i], user_data[i]);
+#else
+    handles[i] = alloc_slot(pool, slot_index, (bsp_tick_t)period_ms, mode,
+                            callbacks[i], NULL);
+#endif
+#if SAFETIMER_ENABLE_TRACE
+    trace_record(pool, slot_index, SAFETIMER_TRACE_CREATE, start_tick, 0);
+#endif
+    arm_slot(pool, slot_index,
+             offsets != NULL ? (bsp_tick_t)(start_tick + offsets[i])
+                             : start_tick);
+  }
 
-  bsp_exit_critical();
+  POOL_EXIT_CRITICAL(pool);
+
+  return TIMER_OK;
+}
+#endif /* ENABLE_HELPER_API */
+
+#if SAFETIMER_ENABLE_FLAG_TIMERS
+/**
+ * @brief Create a flag timer
+ *
+ * Implementation details:
+ * - safetimer_create_in() without callback/user_data, then the meta flag
+ *   bit is set (the slot is not started yet, so no expiry can run between)
+ */
+safetimer_handle_t safetimer_create_flag_in(safetimer_pool_t *pool,
+                                            uint32_t period_ms,
+                                            timer_mode_t mode) {
+  safetimer_handle_t handle;
+
+  CRIT_API(SAFETIMER_API_CREATE);
+
+#if SAFETIMER_ENABLE_USER_DATA
+  handle = safetimer_create_in(pool, period_ms, mode, NULL, NULL);
+#else
+  handle = safetimer_create_in(pool, period_ms, mode, NULL);
+#endif
+  if (handle == SAFETIMER_INVALID_HANDLE) {
+    return SAFETIMER_INVALID_HANDLE;
+  }
+
+  POOL_ENTER_CRITICAL(pool);
+  SLOT_SET_FLAG(DECODE_INDEX(handle), 1);
+  POOL_EXIT_CRITICAL(pool);
+
+  return handle;
+}
+
+/**
+ * @brief Fetch and clear the expired bitmap of the flag timers
+ *
+ * Implementation details:
+ * - One critical section copies and clears every bitmap word
+ */
+timer_error_t safetimer_poll_expired_in(safetimer_pool_t *pool,
+                                        safetimer_bitmap_t *expired) {
+  uint8_t w;
+  uint8_t any;
+
+  CRIT_API(SAFETIMER_API_QUERY);
+
+#if ENABLE_PARAM_CHECK
+  if (pool == NULL || expired == NULL) {
+    return TIMER_ERR_INVALID;
+  }
+#endif
+
+  any = 0;
+  POOL_ENTER_CRITICAL(pool);
+  for (w = 0; w < BITMAP_WORDS; w++) {
+    expired[w] = pool->expired_bitmap[w];
+    pool->expired_bitmap[w] = 0;
+    any |= (uint8_t)(expired[w] != 0);
+  }
+  POOL_EXIT_CRITICAL(pool);
+
+  return any ? TIMER_OK : TIMER_ERR_NOT_FOUND;
+}
+#endif /* SAFETIMER_ENABLE_FLAG_TIMERS */
+
+/**
+ * @brief Start a timer
+ *
+ * Implementation details:
+ * - Sets expire_time = current_tick + period
+ * - Activates timer (sets active=1)
+ * - Critical section protects state modification
+ */
+timer_error_t safetimer_start_in(safetimer_pool_t *pool,
+                                 safetimer_handle_t handle) {
+  slot_index_t slot_index;
+  bsp_tick_t start_tick; /* C89: declare before statements */
+
+  CRIT_API(SAFETIMER_API_START);
+
+#if ENABLE_PARAM_CHECK
+  if (!validate_handle(pool, handle)) {
+    return TIMER_ERR_INVALID;
+  }
+#endif
+
+  /* Decode handle to get slot index */
+  slot_index = DECODE_INDEX(handle);
+
+  /* Read BSP tick before entering the SafeTimer critical section to avoid
+   * nested interrupt masking inside bsp_get_ticks(). */
+  start_tick = bsp_get_ticks();
+
+  start_slot(pool, slot_index, start_tick);
 
   return TIMER_OK;
 }
@@ -423,20 +1218,20 @@ timer_error_t safetimer_start(safetimer_handle_t handle) {
  * - Does NOT delete timer (slot remains allocated)
  * - Critical section protects state modification
  */
-timer_error_t safetimer_stop(safetimer_handle_t handle) {
-  uint8_t slot_index;
+timer_error_t safetimer_stop_in(safetimer_pool_t *pool,
+                                safetimer_handle_t handle) {
+  slot_index_t slot_index;
+
+  CRIT_API(SAFETIMER_API_STOP);
 
 #if ENABLE_PARAM_CHECK
-  if (!validate_handle(handle)) {
+  if (!validate_handle(pool, handle)) {
     return TIMER_ERR_INVALID;
   }
 #endif
 
   slot_index = DECODE_INDEX(handle);
-
-  bsp_enter_critical();
-  SLOT_SET_ACTIVE(g_timer_pool.slots[slot_index], 0);
-  bsp_exit_critical();
+  stop_slot(pool, slot_index, 0);
 
   return TIMER_OK;
 }
@@ -452,26 +1247,24 @@ timer_error_t safetimer_stop(safetimer_handle_t handle) {
  * - Critical section protects bitmap modification
  * - Generation counter prevents deleted handle reuse (ABA protection)
  */
-timer_error_t safetimer_delete(safetimer_handle_t handle) {
-  uint8_t slot_index;
+timer_error_t safetimer_delete_in(safetimer_pool_t *pool,
+                                  safetimer_handle_t handle) {
+  slot_index_t slot_index;
+
+  CRIT_API(SAFETIMER_API_DELETE);
 
 #if ENABLE_PARAM_CHECK
-  if (!validate_handle(handle)) {
+  if (!validate_handle(pool, handle)) {
     return TIMER_ERR_INVALID;
   }
 #endif
+  /* Not a parameter check: a static slot has no RAM meta to release */
+  if (HANDLE_IS_STATIC(handle)) {
+    return TIMER_ERR_INVALID; /* Static timers are never released */
+  }
 
   slot_index = DECODE_INDEX(handle);
-
-  bsp_enter_critical();
-
-  /* Stop timer */
-  SLOT_SET_ACTIVE(g_timer_pool.slots[slot_index], 0);
-
-  /* Release slot (generation remains, preventing handle reuse) */
-  g_timer_pool.used_bitmap &= ~(BITMAP_ONE << slot_index);
-
-  bsp_exit_critical();
+  stop_slot(pool, slot_index, 1);
 
   return TIMER_OK;
 }
@@ -495,29 +1288,30 @@ timer_error_t safetimer_delete(safetimer_handle_t handle) {
  * @note This function is thread-safe and can be called from any context
  *       except timer callbacks (ADR-003 restriction applies)
  */
-timer_error_t safetimer_set_period(safetimer_handle_t handle,
-                                   uint32_t new_period_ms) {
-  uint8_t slot_index;
+timer_error_t safetimer_set_period_in(safetimer_pool_t *pool,
+                                      safetimer_handle_t handle,
+                                      uint32_t new_period_ms) {
+  slot_index_t slot_index;
   bsp_tick_t current_tick; /* C89: declare before statements */
 
+  CRIT_API(SAFETIMER_API_SET_PERIOD);
+
 #if ENABLE_PARAM_CHECK
   /* Validate period range */
-  if (new_period_ms == 0 || new_period_ms > 0x7FFFFFFFUL) {
-    return TIMER_ERR_INVALID; /* Period must be 1 ~ 2^31-1 */
-  }
-
-#if BSP_TICK_TYPE_16BIT
-  /* 16-bit mode: max period is 65535ms (fixes Trap #13) */
-  if (new_period_ms > 65535UL) {
-    return TIMER_ERR_INVALID; /* Period exceeds 16-bit limit */
+  if (new_period_ms == 0 || new_period_ms > SAFETIMER_MAX_PERIOD ||
+      PERIOD_OFF_UNIT(new_period_ms)) {
+    return TIMER_ERR_INVALID; /* Period must be 1 ~ SAFETIMER_MAX_PERIOD */
   }
-#endif
 
   /* Validate handle and check if slot is allocated */
-  if (!validate_handle(handle)) {
+  if (!validate_handle(pool, handle)) {
     return TIMER_ERR_INVALID; /* Invalid handle or timer deleted */
   }
 #endif
+  /* Not a parameter check: a static slot has no RAM period to write */
+  if (HANDLE_IS_STATIC(handle)) {
+    return TIMER_ERR_INVALID; /* Period is in the ROM table */
+  }
 
   slot_index = DECODE_INDEX(handle);
 
@@ -525,24 +1319,228 @@ timer_error_t safetimer_set_period(safetimer_handle_t handle,
    * nested interrupt masking inside bsp_get_ticks(). */
   current_tick = bsp_get_ticks();
 
-  bsp_enter_critical();
+  set_period_slot(pool, slot_index, (bsp_tick_t)new_period_ms, current_tick);
 
-  /* Update period field (explicit cast for C89 warning suppression) */
-  g_timer_pool.slots[slot_index].period = (bsp_tick_t)new_period_ms;
+  return TIMER_OK;
+}
 
-  /* If timer is currently running, restart countdown with new period.
-   * This is equivalent to "delete + create + start" but preserves handle.
-   * Breaks phase-locking intentionally - documented trade-off. */
-  if (SLOT_GET_ACTIVE(g_timer_pool.slots[slot_index])) {
-    g_timer_pool.slots[slot_index].expire_time =
-        current_tick + (bsp_tick_t)new_period_ms;
+/**
+ * @brief Make a timer due now
+ *
+ * Implementation details:
+ * - Sets expire_time = current_tick and activates the timer
+ * - Period unchanged: the next REPEAT deadline follows the triggered fire
+ * - Critical section protects state modification
+ */
+timer_error_t safetimer_trigger_in(safetimer_pool_t *pool,
+                                   safetimer_handle_t handle) {
+  bsp_tick_t current_tick; /* C89: declare before statements */
+
+  CRIT_API(SAFETIMER_API_TRIGGER);
+
+#if ENABLE_PARAM_CHECK
+  if (!validate_handle(pool, handle)) {
+    return TIMER_ERR_INVALID;
   }
-  /* If timer is stopped, new period takes effect on next safetimer_start() */
+#endif
 
-  bsp_exit_critical();
+  /* Read BSP tick before entering the SafeTimer critical section to avoid
+   * nested interrupt masking inside bsp_get_ticks(). */
+  current_tick = bsp_get_ticks();
+
+  POOL_ENTER_CRITICAL(pool);
+  wake_slot(pool, DECODE_INDEX(handle), current_tick);
+  POOL_EXIT_CRITICAL(pool);
+
+  return TIMER_OK;
+}
+
+#if SAFETIMER_PRIORITY_LEVELS > 1
+/**
+ * @brief Set the dispatch priority of a timer
+ *
+ * Implementation details:
+ * - Moves the slot between the per-level bitmaps (critical section)
+ * - Takes effect from the next level a running pass collects
+ */
+timer_error_t safetimer_set_priority_in(safetimer_pool_t *pool,
+                                        safetimer_handle_t handle,
+                                        uint8_t priority) {
+  CRIT_API(SAFETIMER_API_CONFIG);
+
+#if ENABLE_PARAM_CHECK
+  if (priority >= SAFETIMER_PRIORITY_LEVELS) {
+    return TIMER_ERR_INVALID;
+  }
+
+  if (!validate_handle(pool, handle)) {
+    return TIMER_ERR_INVALID;
+  }
+#endif
+
+  POOL_ENTER_CRITICAL(pool);
+  prio_assign(pool, DECODE_INDEX(handle), priority);
+  POOL_EXIT_CRITICAL(pool);
+
+  return TIMER_OK;
+}
+#endif
+
+#if SAFETIMER_ENABLE_SLACK
+/**
+ * @brief Set how many ticks early a timer may fire on another's wakeup
+ *
+ * Implementation details:
+ * - No cache update: the earliest-deadline cache tracks deadlines only,
+ *   the slack is applied by the pass that wakes for one of them
+ * - Slack below the period keeps a REPEAT timer at one fire per period
+ */
+timer_error_t safetimer_set_slack_in(safetimer_pool_t *pool,
+                                     safetimer_handle_t handle,
+                                     uint8_t slack_ms) {
+  slot_index_t slot_index; /* C89: declare before statements */
+
+  CRIT_API(SAFETIMER_API_CONFIG);
+
+#if ENABLE_PARAM_CHECK
+  if (!validate_handle(pool, handle)) {
+    return TIMER_ERR_INVALID;
+  }
+#endif
+
+  slot_index = DECODE_INDEX(handle);
+
+  POOL_ENTER_CRITICAL(pool);
+#if ENABLE_PARAM_CHECK
+  if ((bsp_tick_t)slack_ms >= SLOT_PERIOD(slot_index)) {
+    POOL_EXIT_CRITICAL(pool);
+    return TIMER_ERR_INVALID;
+  }
+#endif
+  pool->slack[slot_index] = slack_ms;
+  if (slack_ms != 0) {
+    BITMAP_SET(pool->slack_bitmap, slot_index);
+  } else {
+    BITMAP_CLEAR(pool->slack_bitmap, slot_index);
+  }
+  POOL_EXIT_CRITICAL(pool);
 
   return TIMER_OK;
 }
+#endif
+
+#if SAFETIMER_ENABLE_ISR_QUEUE
+/**
+ * @brief Queue a start from interrupt context
+ *
+ * Implementation details:
+ * - Wait-free ring push (no critical section, no pool state touched)
+ * - Countdown base is the tick read here, applied by the next process pass
+ */
+timer_error_t safetimer_start_from_isr_in(safetimer_pool_t *pool,
+                                          safetimer_handle_t handle) {
+#if ENABLE_PARAM_CHECK
+  if (pool == NULL || handle == SAFETIMER_INVALID_HANDLE) {
+    return TIMER_ERR_INVALID;
+  }
+#endif
+  return isr_queue_push(pool, handle, ISR_CMD_START, 0);
+}
+
+/**
+ * @brief Queue a stop from interrupt context
+ */
+timer_error_t safetimer_stop_from_isr_in(safetimer_pool_t *pool,
+                                         safetimer_handle_t handle) {
+#if ENABLE_PARAM_CHECK
+  if (pool == NULL || handle == SAFETIMER_INVALID_HANDLE) {
+    return TIMER_ERR_INVALID;
+  }
+#endif
+  return isr_queue_push(pool, handle, ISR_CMD_STOP, 0);
+}
+
+/**
+ * @brief Queue a period change from interrupt context
+ *
+ * Implementation details:
+ * - Same period range checks as safetimer_set_period()
+ * - A running timer restarts from the tick read here
+ */
+timer_error_t safetimer_set_period_from_isr_in(safetimer_pool_t *pool,
+                                               safetimer_handle_t handle,
+                                               uint32_t new_period_ms) {
+#if ENABLE_PARAM_CHECK
+  if (pool == NULL || handle == SAFETIMER_INVALID_HANDLE) {
+    return TIMER_ERR_INVALID;
+  }
+  if (new_period_ms == 0 || new_period_ms > SAFETIMER_MAX_PERIOD ||
+      PERIOD_OFF_UNIT(new_period_ms)) {
+    return TIMER_ERR_INVALID; /* Period must be 1 ~ SAFETIMER_MAX_PERIOD */
+  }
+#endif
+  if (HANDLE_IS_STATIC(handle)) {
+    return TIMER_ERR_INVALID; /* Period is in the ROM table */
+  }
+  return isr_queue_push(pool, handle, ISR_CMD_SET_PERIOD,
+                        (bsp_tick_t)new_period_ms);
+}
+
+/**
+ * @brief Queue a delete from interrupt context
+ *
+ * @note The slot is released when the command is applied, not here
+ */
+timer_error_t safetimer_delete_from_isr_in(safetimer_pool_t *pool,
+                                           safetimer_handle_t handle) {
+#if ENABLE_PARAM_CHECK
+  if (pool == NULL || handle == SAFETIMER_INVALID_HANDLE) {
+    return TIMER_ERR_INVALID;
+  }
+#endif
+  if (HANDLE_IS_STATIC(handle)) {
+    return TIMER_ERR_INVALID; /* Static timers are never released */
+  }
+  return isr_queue_push(pool, handle, ISR_CMD_DELETE, 0);
+}
+
+/**
+ * @brief Queue a trigger from interrupt context
+ *
+ * @note The timer becomes due at the tick read here, the pass applying
+ *       the command fires it
+ */
+timer_error_t safetimer_trigger_from_isr_in(safetimer_pool_t *pool,
+                                            safetimer_handle_t handle) {
+#if ENABLE_PARAM_CHECK
+  if (pool == NULL || handle == SAFETIMER_INVALID_HANDLE) {
+    return TIMER_ERR_INVALID;
+  }
+#endif
+  return isr_queue_push(pool, handle, ISR_CMD_TRIGGER, 0);
+}
+
+#if SAFETIMER_ENABLE_SEM_WAKE
+/**
+ * @brief Queue a semaphore wake from interrupt context
+ *
+ * Implementation details:
+ * - The entry at isr_head is not published yet and only this producer
+ *   writes it, so its sem field is filled before the regular push
+ * - The next pass wakes the waiters with the tick read here
+ */
+timer_error_t safetimer_sem_wake_from_isr_in(safetimer_pool_t *pool,
+                                             const volatile void *sem) {
+#if ENABLE_PARAM_CHECK
+  if (pool == NULL || sem == NULL) {
+    return TIMER_ERR_INVALID;
+  }
+#endif
+  pool->isr_queue[pool->isr_head].sem = sem;
+  return isr_queue_push(pool, SAFETIMER_INVALID_HANDLE, ISR_CMD_SEM_WAKE, 0);
+}
+#endif
+#endif /* SAFETIMER_ENABLE_ISR_QUEUE */
 
 #if SAFETIMER_ENABLE_CORO
 /**
@@ -554,9 +1552,10 @@ timer_error_t safetimer_set_period(safetimer_handle_t handle,
  * @param handle Timer handle
  * @return TIMER_OK on success, or error code
  */
-timer_error_t safetimer_advance_period(safetimer_handle_t handle,
-                                       uint32_t new_period_ms) {
-  uint8_t slot_index;
+timer_error_t safetimer_advance_period_in(safetimer_pool_t *pool,
+                                          safetimer_handle_t handle,
+                                          uint32_t new_period_ms) {
+  slot_index_t slot_index;
   bsp_tick_t current_tick;        /* C89: declare before statements */
   bsp_tick_t prev_period;         /* C89: declare before statements */
   bsp_tick_t old_expire_snapshot; /* C89: declare before statements */
@@ -566,48 +1565,47 @@ timer_error_t safetimer_advance_period(safetimer_handle_t handle,
   int32_t lag;                    /* C89: declare before statements */
   uint32_t missed_periods;        /* C89: declare before statements */
 
+  CRIT_API(SAFETIMER_API_SET_PERIOD);
+
 #if ENABLE_PARAM_CHECK
   /* Validate period range */
-  if (new_period_ms == 0 || new_period_ms > 0x7FFFFFFFUL) {
-    return TIMER_ERR_INVALID; /* Period must be 1 ~ 2^31-1 */
-  }
-
-#if BSP_TICK_TYPE_16BIT
-  /* 16-bit mode: max period is 65535ms (fixes Trap #13) */
-  if (new_period_ms > 65535UL) {
-    return TIMER_ERR_INVALID; /* Period exceeds 16-bit limit */
+  if (new_period_ms == 0 || new_period_ms > SAFETIMER_MAX_PERIOD ||
+      PERIOD_OFF_UNIT(new_period_ms)) {
+    return TIMER_ERR_INVALID; /* Period must be 1 ~ SAFETIMER_MAX_PERIOD */
   }
-#endif
 
   /* Validate handle and check if slot is allocated */
-  if (!validate_handle(handle)) {
+  if (!validate_handle(pool, handle)) {
     return TIMER_ERR_INVALID; /* Invalid handle or timer deleted */
   }
 #else
   /* Minimal validation */
-  if (!validate_handle(handle)) {
+  if (!validate_handle(pool, handle)) {
     return TIMER_ERR_INVALID;
   }
 #endif
+  if (HANDLE_IS_STATIC(handle)) {
+    return TIMER_ERR_INVALID; /* Period is in the ROM table */
+  }
 
   slot_index = DECODE_INDEX(handle);
 
   /* Read BSP tick before entering the SafeTimer critical section */
   current_tick = bsp_get_ticks();
 
-  bsp_enter_critical();
+  POOL_ENTER_CRITICAL(pool);
 
   /* Store old period, expire_time, and active state snapshot before updating */
-  prev_period = g_timer_pool.slots[slot_index].period;
-  old_expire_snapshot = g_timer_pool.slots[slot_index].expire_time;
-  old_active_snapshot = SLOT_GET_ACTIVE(g_timer_pool.slots[slot_index]);
+  prev_period = SLOT_PERIOD(slot_index);
+  old_expire_snapshot = SLOT_EXPIRE(slot_index);
+  old_active_snapshot = SLOT_GET_ACTIVE(slot_index);
 
   /* Update period field (explicit cast for C89 warning suppression) */
-  g_timer_pool.slots[slot_index].period = (bsp_tick_t)new_period_ms;
+  SLOT_SET_PERIOD(slot_index, (bsp_tick_t)new_period_ms);
 
   /* Phase-locked advance: maintain timing relationship to previous expire_time
    */
-  if (SLOT_GET_ACTIVE(g_timer_pool.slots[slot_index])) {
+  if (SLOT_GET_ACTIVE(slot_index)) {
     /* Calculate when the timer SHOULD have expired based on old period.
      * This is overflow-safe because both values are bsp_tick_t. */
     last_expire = old_expire_snapshot - prev_period;
@@ -624,48 +1622,52 @@ timer_error_t safetimer_advance_period(safetimer_handle_t handle,
     lag = safetimer_tick_diff(current_tick, new_expire);
     if (lag >= 0) {
       /* Release critical section before expensive division */
-      bsp_exit_critical();
+      POOL_EXIT_CRITICAL(pool);
 
 #if ENABLE_DEBUG_ASSERT
       /* Defensive: period should never be 0 (validated in API entry) */
       if (new_period_ms == 0) {
-        bsp_enter_critical(); /* Restore critical section state */
-        bsp_exit_critical();
+        POOL_ENTER_CRITICAL(pool); /* Restore critical section state */
+        POOL_EXIT_CRITICAL(pool);
         return TIMER_ERR_INVALID; /* Fail safe */
       }
 #endif
 
       /* Behind schedule - advance by N periods to catch up (OUTSIDE critical
        * section) */
-      missed_periods = ((uint32_t)lag / new_period_ms) + 1U;
+      missed_periods = calc_missed_periods((uint32_t)lag, new_period_ms) + 1U;
       new_expire = new_expire + (bsp_tick_t)(missed_periods * new_period_ms);
 
       /* Re-enter critical section to update expire_time */
-      bsp_enter_critical();
+      POOL_ENTER_CRITICAL(pool);
 
       /* Verify expire_time AND active state weren't modified by ISR during
        * calculation (fixes Stop-Start Overwrite Race + ABA variant). Double
        * verification prevents extreme coincidence where ISR results in same
        * expire_time value. */
-      if (g_timer_pool.slots[slot_index].expire_time == old_expire_snapshot &&
-          SLOT_GET_ACTIVE(g_timer_pool.slots[slot_index]) ==
-              old_active_snapshot) {
+      if (SLOT_EXPIRE(slot_index) == old_expire_snapshot &&
+          SLOT_GET_ACTIVE(slot_index) == old_active_snapshot) {
         /* ISR didn't interfere, safe to update with catch-up value */
-        g_timer_pool.slots[slot_index].expire_time = new_expire;
+        expiry_cache_raise(pool, old_expire_snapshot);
+        SLOT_SET_EXPIRE(slot_index, new_expire);
+        SCHED_ARM(slot_index);
+        expiry_cache_lower(pool, new_expire);
       }
       /* else: ISR modified timer state, keep ISR's value */
     } else {
       /* No catch-up needed, update directly */
-      g_timer_pool.slots[slot_index].expire_time = new_expire;
+      expiry_cache_raise(pool, old_expire_snapshot);
+      SLOT_SET_EXPIRE(slot_index, new_expire);
+      SCHED_ARM(slot_index);
+      expiry_cache_lower(pool, new_expire);
     }
   } else {
     /* Timer not active: no previous phase to preserve, behave like set_period()
      */
-    g_timer_pool.slots[slot_index].expire_time =
-        current_tick + (bsp_tick_t)new_period_ms;
+    SLOT_SET_EXPIRE(slot_index, current_tick + (bsp_tick_t)new_period_ms);
   }
 
-  bsp_exit_critical();
+  POOL_EXIT_CRITICAL(pool);
 
   return TIMER_OK;
 }
@@ -681,142 +1683,469 @@ timer_error_t safetimer_advance_period(safetimer_handle_t handle,
  * @return Valid handle if called from within a timer callback
  * @retval SAFETIMER_INVALID_HANDLE if called outside callback context
  */
-safetimer_handle_t safetimer_get_current_handle(void) {
-  return g_executing_handle;
+safetimer_handle_t safetimer_get_current_handle_in(safetimer_pool_t *pool) {
+#if ENABLE_PARAM_CHECK
+  if (pool == NULL) {
+    return SAFETIMER_INVALID_HANDLE;
+  }
+#endif
+  if (pool->executing_handle == 0) {
+    return SAFETIMER_INVALID_HANDLE; /* 0 is never a valid handle */
+  }
+  return pool->executing_handle;
 }
 #endif /* SAFETIMER_ENABLE_CORO */
 
+#if SAFETIMER_ENABLE_CATCHUP == SAFETIMER_CATCHUP_REPORT
 /**
- * @brief Process all active timers (call periodically from main loop)
+ * @brief Get periods coalesced into the currently executing callback
  *
- * O(n) algorithm with recursion guard to prevent stack overflow.
+ * Set by trigger_timer() / snapshot commit when skip mode advanced a
+ * REPEAT deadline by more than one period, cleared after the callback.
+ *
+ * @return Missed periods (elapsed periods - 1), 0 outside callbacks
  */
-void safetimer_process(void) {
-  uint8_t i;
-  bsp_tick_t current_tick;
+uint32_t safetimer_get_missed_count_in(safetimer_pool_t *pool) {
+#if ENABLE_PARAM_CHECK
+  if (pool == NULL) {
+    return 0;
+  }
+#endif
+  return pool->executing_missed;
+}
+#endif /* SAFETIMER_ENABLE_CATCHUP == SAFETIMER_CATCHUP_REPORT */
 
-  /* Recursion guard: prevent callback from calling safetimer_process() again
-   * (fixes Trap #19: Recursive Stack Overflow). On 8-bit MCUs with ~176B RAM,
-   * even 2-3 recursions can exhaust stack and cause system reset. */
-  if (s_processing) {
-    return; /* Already processing, silently return to prevent recursion */
+#if SAFETIMER_ENABLE_SEM_WAKE
+/**
+ * @brief Register (or clear) the semaphore a timer waits on
+ *
+ * Implementation details:
+ * - Only the address is stored, the semaphore value stays with the macros
+ * - Critical section protects the slot's entry and sem_bitmap
+ */
+timer_error_t safetimer_sem_wait_on_in(safetimer_pool_t *pool,
+                                       safetimer_handle_t handle,
+                                       const volatile void *sem) {
+  slot_index_t slot_index; /* C89: declare before statements */
+
+  CRIT_API(SAFETIMER_API_SEM);
+
+#if ENABLE_PARAM_CHECK
+  if (!validate_handle(pool, handle)) {
+    return TIMER_ERR_INVALID;
   }
+#endif
 
-  s_processing = 1; /* Mark as processing */
+  slot_index = DECODE_INDEX(handle);
 
-  current_tick = bsp_get_ticks();
+  POOL_ENTER_CRITICAL(pool);
+  pool->sem_wait[slot_index] = sem;
+  if (sem != NULL) {
+    BITMAP_SET(pool->sem_bitmap, slot_index);
+  } else {
+    BITMAP_CLEAR(pool->sem_bitmap, slot_index);
+  }
+  POOL_EXIT_CRITICAL(pool);
 
-  for (i = 0; i < MAX_TIMERS; i++) {
-    timer_callback_t callback; /* C89: declare before statements */
-#if SAFETIMER_ENABLE_USER_DATA
-    void *user_data; /* C89: declare before statements */
+  return TIMER_OK;
+}
+
+/**
+ * @brief Trigger and release every timer waiting on sem
+ *
+ * Implementation details:
+ * - Only slots in sem_bitmap are visited (no waiter: one short lock)
+ * - One critical section per waiting slot, the entry is re-checked under
+ *   it (the waiter may have timed out or been deleted meanwhile)
+ */
+STATIC void sem_wake_waiters(safetimer_pool_t *pool, const volatile void *sem,
+                             bsp_tick_t current_tick) {
+  safetimer_bitmap_t pending; /* C89: declare before statements */
+  slot_index_t i;             /* C89: declare before statements */
+  uint8_t w;                  /* C89: declare before statements */
+
+  for (w = 0; w < BITMAP_WORDS; w++) {
+    POOL_ENTER_CRITICAL(pool);
+    pending = pool->sem_bitmap[w];
+    POOL_EXIT_CRITICAL(pool);
+
+    while (pending != 0) {
+      i = (slot_index_t)(w * BITMAP_WORD_BITS + BITMAP_CTZ(pending));
+      pending &= (safetimer_bitmap_t)(pending - 1U);
+
+      POOL_ENTER_CRITICAL(pool);
+      if (BITMAP_TEST(pool->sem_bitmap, i) && pool->sem_wait[i] == sem) {
+        BITMAP_CLEAR(pool->sem_bitmap, i);
+        wake_slot(pool, i, current_tick);
+      }
+      POOL_EXIT_CRITICAL(pool);
+    }
+  }
+}
+
+/**
+ * @brief Wake the waiters of sem from task context
+ *
+ * Implementation details:
+ * - Reads the tick, then sem_wake_waiters() (one lock per bitmap word
+ *   plus one per waiter); not for ISRs, see safetimer_sem_wake_from_isr()
+ */
+void safetimer_sem_wake_in(safetimer_pool_t *pool, const volatile void *sem) {
+  bsp_tick_t current_tick; /* C89: declare before statements */
+#if SAFETIMER_ENABLE_CRIT_PROFILE
+  uint8_t crit_api = g_crit_profile.api; /* Signaled from a callback maybe */
 #endif
-    int should_invoke;    /* C89: declare before statements */
-    uint8_t captured_gen; /* C89: declare before statements */
-#if !SAFETIMER_REPEAT_ONLY
-    uint8_t captured_mode; /* C89: declare before statements */
+
+#if ENABLE_PARAM_CHECK
+  if (pool == NULL || sem == NULL) {
+    return;
+  }
 #endif
-    int valid; /* C89: declare before statements */
 
-    callback = NULL;
-#if SAFETIMER_ENABLE_USER_DATA
-    user_data = NULL;
+  /* Outside the critical section (nested masking in bsp_get_ticks()) */
+  current_tick = bsp_get_ticks();
+
+  CRIT_API(SAFETIMER_API_SEM);
+  sem_wake_waiters(pool, sem, current_tick);
+  CRIT_API(crit_api);
+}
+#endif /* SAFETIMER_ENABLE_SEM_WAKE */
+
+#if SAFETIMER_ENABLE_CORO_SCHED
+/**
+ * @brief Start a coroutine task table on one timer slot
+ *
+ * Implementation details:
+ * - Every wake tick starts at the current tick (all tasks due)
+ * - One REPEAT timer, triggered so the next pass runs the tasks; its
+ *   callback re-arms it for the earliest wake tick
+ * - Resume points are left alone (a {0} context starts at the top)
+ */
+timer_error_t safetimer_sched_start_in(safetimer_pool_t *pool,
+                                       safetimer_sched_t *sched,
+                                       const safetimer_task_t *tasks,
+                                       uint8_t count) {
+  bsp_tick_t current_tick; /* C89: declare before statements */
+  uint8_t i;               /* C89: declare before statements */
+
+  CRIT_API(SAFETIMER_API_START);
+
+#if ENABLE_PARAM_CHECK
+  if (pool == NULL || sched == NULL || tasks == NULL || count == 0) {
+    return TIMER_ERR_INVALID;
+  }
+  for (i = 0; i < count; i++) {
+    if (tasks[i].fn == NULL || tasks[i].ctx == NULL) {
+      return TIMER_ERR_INVALID;
+    }
+  }
 #endif
-    should_invoke = 0;
-    captured_gen = 0;
-#if !SAFETIMER_REPEAT_ONLY
-    captured_mode = 0;
+
+  current_tick = bsp_get_ticks();
+  for (i = 0; i < count; i++) {
+    ((safetimer_task_ctx_t *)tasks[i].ctx)->_task_wake = current_tick;
+  }
+
+  sched->tasks = tasks;
+  sched->pool = pool;
+  sched->count = count;
+  sched->timer = safetimer_create_in(pool, 1, TIMER_MODE_REPEAT,
+                                     sched_timer_callback, sched);
+  if (sched->timer == SAFETIMER_INVALID_HANDLE) {
+    return TIMER_ERR_FULL;
+  }
+
+  return safetimer_trigger_in(pool, sched->timer);
+}
+
+/**
+ * @brief Advance a task's wake tick by one period
+ *
+ * Implementation details:
+ * - wake += ms (phase-locked, no drift)
+ * - Behind schedule: skips the missed periods, same rule as
+ *   safetimer_advance_period()
+ */
+timer_error_t safetimer_task_advance(void *ctx, uint32_t ms) {
+  safetimer_task_ctx_t *task; /* C89: declare before statements */
+  bsp_tick_t current_tick;    /* C89: declare before statements */
+  int32_t lag;                /* C89: declare before statements */
+
+#if ENABLE_PARAM_CHECK
+  if (ctx == NULL || ms == 0 || ms > SAFETIMER_MAX_PERIOD) {
+    return TIMER_ERR_INVALID; /* Period must be 1 ~ SAFETIMER_MAX_PERIOD */
+  }
 #endif
 
-    /*
-     * Copy slot state under the BSP critical section (prevents races with
-     * start/stop/delete) and only call user code after releasing the lock.
-     */
-    bsp_enter_critical();
+  task = (safetimer_task_ctx_t *)ctx;
+  current_tick = bsp_get_ticks();
 
-    /* Skip inactive timers */
-    if (!SLOT_GET_ACTIVE(g_timer_pool.slots[i])) {
-      bsp_exit_critical();
-      continue;
-    }
+  task->_task_wake = (bsp_tick_t)(task->_task_wake + ms);
+  lag = safetimer_tick_diff(current_tick, task->_task_wake);
+  if (lag >= 0) {
+    task->_task_wake = (bsp_tick_t)(
+        task->_task_wake +
+        (bsp_tick_t)((calc_missed_periods((uint32_t)lag, ms) + 1U) * ms));
+  }
 
-    /*
-     * ADR-005: Signed Difference Comparison Algorithm (updated for
-     * 16-bit/32-bit)
-     */
-    if (safetimer_tick_diff(current_tick, g_timer_pool.slots[i].expire_time) >=
-        0) {
-      /* Timer expired - capture state and trigger it */
-      captured_gen = SLOT_GET_GEN(g_timer_pool.slots[i]);
-#if !SAFETIMER_REPEAT_ONLY
-      captured_mode = SLOT_GET_MODE(g_timer_pool.slots[i]);
+  return TIMER_OK;
+}
+#endif /* SAFETIMER_ENABLE_CORO_SCHED */
+
+/**
+ * @brief Process all active timers (call periodically from main loop)
+ *
+ * O(n) algorithm with recursion guard to prevent stack overflow.
+ * Returns after a single tick compare while the cached earliest deadline
+ * (pool->next_expiry) has not been reached; otherwise every slot is
+ * scanned and the cache is rebuilt from the resulting expire times.
+ * With SAFETIMER_PROCESS_SNAPSHOT=1 the pass is delegated to
+ * process_snapshot_pass() (two critical sections per pass).
+ * With the wheel engine only the slots found due in the wheel buckets of the
+ * elapsed ticks are dispatched, and the cache is left STALE (or IDLE).
+ * With the heap engine the fast path compares against the heap root and due
+ * roots are popped one per critical section (no cache to publish).
+ */
+void safetimer_process_pool(safetimer_pool_t *pool) {
+  (void)PROCESS_PASS(pool, 0, 0);
+}
+
+#if SAFETIMER_ENABLE_PROCESS_BUDGET
+/**
+ * @brief Process timers with a bounded amount of callback work
+ *
+ * Same pass as safetimer_process_pool(), but stops before the next due slot
+ * once max_callbacks callbacks ran or max_ticks ticks elapsed since the call
+ * started. The slot it stopped at becomes the first slot of the next pass.
+ */
+int safetimer_process_budget_in(safetimer_pool_t *pool,
+                                uint16_t max_callbacks, uint32_t max_ticks) {
+  return (int)PROCESS_PASS(pool, max_callbacks, max_ticks);
+}
 #endif
-      trigger_timer(i, current_tick, &callback, &user_data);
-      should_invoke = 1;
-    }
 
-    bsp_exit_critical();
+#if SAFETIMER_ENABLE_ISR_DISPATCH
+/**
+ * @brief Detect due timers from the tick ISR
+ *
+ * Implementation details:
+ * - O(1): one compare against the earliest-deadline cache (heap root with
+ *   the heap engine, this tick's bucket with the wheel engine) under one
+ *   short critical section
+ * - STALE/SCANNING cache counts as due: the next pass rebuilds it
+ * - Returns at once while the ready flag is still set
+ */
+void safetimer_isr_detect_in(safetimer_pool_t *pool) {
+  bsp_tick_t current_tick;
+#if SAFETIMER_ENABLE_CRIT_PROFILE
+  uint8_t crit_api = g_crit_profile.api; /* API this interrupt preempted */
+#endif
 
-    /* Execute callback OUTSIDE critical section */
-    if (should_invoke && callback != NULL) {
-      /* Double-check validity to prevent TOCTOU race (fixes Trap #6)
-       * Use generation counter to detect if timer was deleted/reused.
-       * For REPEAT timers: must still be active (user didn't stop it).
-       * For ONE_SHOT timers: trigger_timer() set active=0, so only check gen.
-       */
-      bsp_enter_critical();
+#if ENABLE_PARAM_CHECK
+  if (pool == NULL) {
+    return;
+  }
+#endif
 
-      valid = (SLOT_GET_GEN(g_timer_pool.slots[i]) == captured_gen);
+  if (pool->ready) {
+    return; /* Pass already requested */
+  }
 
-      if (valid) {
-#if !SAFETIMER_REPEAT_ONLY
-        if (captured_mode == TIMER_MODE_REPEAT) {
-          if (!SLOT_GET_ACTIVE(g_timer_pool.slots[i])) {
-            valid = 0; /* User stopped it */
-          }
-        }
-        /* Else: ONE_SHOT, active is 0 (by us) or 1 (user restart), both valid
-         */
+  current_tick = bsp_get_ticks();
+
+  CRIT_API(SAFETIMER_API_ISR_DETECT);
+  POOL_ENTER_CRITICAL(pool);
+#if SAFETIMER_ENGINE == SAFETIMER_ENGINE_HEAP
+  if (HEAP_ROOT_DUE(current_tick) || RESUME_PENDING()) {
+    pool->ready = 1;
+  }
+#elif SAFETIMER_ENGINE == SAFETIMER_ENGINE_WHEEL
+  /* Cache is rarely valid here: walk this tick's bucket in place of the
+   * pass when it is empty and the cursor is current (a timer linked at or
+   * before the cursor goes to the next bucket, checked next tick) */
+  if (EXPIRY_CACHE_NOTHING_DUE(current_tick) ||
+      (!RESUME_PENDING() &&
+       (bsp_tick_t)(pool->wheel_cursor + 1U) == current_tick &&
+       pool->wheel_head[current_tick & WHEEL_MASK] == WHEEL_NONE)) {
+    pool->wheel_cursor = current_tick;
+  } else {
+    pool->ready = 1;
+  }
 #else
-        /* REPEAT ONLY: Must be active */
-        if (!SLOT_GET_ACTIVE(g_timer_pool.slots[i])) {
-          valid = 0;
-        }
+  if (!EXPIRY_CACHE_NOTHING_DUE(current_tick)) {
+    pool->ready = 1;
+  }
 #endif
-      }
-      bsp_exit_critical();
+  POOL_EXIT_CRITICAL(pool);
+  CRIT_API(crit_api);
+}
 
-      if (valid) {
-#if SAFETIMER_ENABLE_CORO
-        /* Set executing handle for coroutine auto-binding */
-        g_executing_handle = ENCODE_HANDLE(captured_gen, i);
+/**
+ * @brief Run a process pass only if the tick ISR flagged one
+ *
+ * Implementation details:
+ * - One flag read (no tick read, no lock) while nothing is due
+ * - Flag cleared before the pass, so a detection during the pass (callback
+ *   work spanning a tick) requests the next one
+ */
+void safetimer_dispatch_ready_in(safetimer_pool_t *pool) {
+#if ENABLE_PARAM_CHECK
+  if (pool == NULL) {
+    return;
+  }
 #endif
-#if SAFETIMER_ENABLE_USER_DATA
-        callback(user_data);
-#else
-        callback();
+
+  if (!pool->ready) {
+    return;
+  }
+  pool->ready = 0;
+  (void)PROCESS_PASS(pool, 0, 0);
+}
+#endif /* SAFETIMER_ENABLE_ISR_DISPATCH */
+
+/**
+ * @brief Get ticks until the earliest active deadline
+ *
+ * Implementation details:
+ * - O(1) when the earliest-deadline cache is valid (typical right after
+ *   safetimer_process()); always O(1) with the heap engine (heap root)
+ * - Otherwise rescans active slots (one short critical section per slot,
+ *   same as safetimer_process()) and republishes the cache
+ * - Uses safetimer_tick_diff() so wraparound matches safetimer_process()
+ */
+uint32_t safetimer_get_next_expiry_in(safetimer_pool_t *pool) {
+  bsp_tick_t current_tick;
+  bsp_tick_t next_expiry;
+  uint8_t has_next;
+  int32_t diff;
+#if SAFETIMER_ENGINE != SAFETIMER_ENGINE_HEAP
+  slot_index_t i;
+  uint8_t w;
+  safetimer_bitmap_t pending;
 #endif
-#if SAFETIMER_ENABLE_CORO
-        g_executing_handle = SAFETIMER_INVALID_HANDLE;
+
+  CRIT_API(SAFETIMER_API_QUERY);
+
+#if ENABLE_PARAM_CHECK
+  if (pool == NULL) {
+    return SAFETIMER_NO_EXPIRY;
+  }
 #endif
+
+  /* Read BSP tick before entering the SafeTimer critical section */
+  current_tick = bsp_get_ticks();
+
+  POOL_ENTER_CRITICAL(pool);
+
+#if SAFETIMER_ENGINE == SAFETIMER_ENGINE_HEAP
+  if (RESUME_PENDING()) {
+    POOL_EXIT_CRITICAL(pool);
+    return 0U; /* Popped by a budget-stopped pass, not yet dispatched */
+  }
+  has_next = (uint8_t)(pool->heap_size != 0);
+  next_expiry = has_next ? SLOT_EXPIRE(pool->heap[0]) : 0;
+  POOL_EXIT_CRITICAL(pool);
+#else
+  if (pool->expiry_state == EXPIRY_CACHE_IDLE) {
+    POOL_EXIT_CRITICAL(pool);
+    return SAFETIMER_NO_EXPIRY;
+  }
+
+  if (pool->expiry_state == EXPIRY_CACHE_VALID) {
+    next_expiry = pool->next_expiry;
+    POOL_EXIT_CRITICAL(pool);
+    has_next = 1;
+  } else {
+    /* Stale cache: rebuild it, unless safetimer_process() (which owns the
+     * SCANNING state) is running and will publish its own result. */
+    if (!pool->processing) {
+      pool->expiry_state = EXPIRY_CACHE_SCANNING;
+    }
+    POOL_EXIT_CRITICAL(pool);
+
+    next_expiry = 0;
+    has_next = 0;
+
+    for (w = 0; w < BITMAP_WORDS; w++) {
+      POOL_ENTER_CRITICAL(pool);
+      pending = pool->active_bitmap[w];
+      POOL_EXIT_CRITICAL(pool);
+
+      while (pending != 0) {
+        i = (slot_index_t)(w * BITMAP_WORD_BITS + BITMAP_CTZ(pending));
+        pending &= (safetimer_bitmap_t)(pending - 1U);
+
+        POOL_ENTER_CRITICAL(pool);
+        if (SLOT_GET_ACTIVE(i) &&
+            (!has_next ||
+             safetimer_tick_diff(SLOT_EXPIRE(i), next_expiry) < 0)) {
+          next_expiry = SLOT_EXPIRE(i);
+          has_next = 1;
+        }
+        POOL_EXIT_CRITICAL(pool);
       }
     }
+
+    POOL_ENTER_CRITICAL(pool);
+    if (!pool->processing && pool->expiry_state == EXPIRY_CACHE_SCANNING) {
+      pool->next_expiry = next_expiry;
+      pool->expiry_state =
+          has_next ? EXPIRY_CACHE_VALID : EXPIRY_CACHE_IDLE;
+#if SAFETIMER_ENABLE_HW_COMPARE
+      hw_compare_sync(pool);
+#endif
+    }
+    POOL_EXIT_CRITICAL(pool);
+  }
+#endif /* SAFETIMER_ENGINE_HEAP */
+
+  if (!has_next) {
+    return SAFETIMER_NO_EXPIRY;
+  }
+
+  diff = safetimer_tick_diff(next_expiry, current_tick);
+  if (diff < 0) {
+    return 0U; /* Already due, not yet processed */
   }
 
-  s_processing = 0; /* Clear processing flag */
+  return (uint32_t)diff;
 }
 
+#if SAFETIMER_BSP_TICKLESS
+/**
+ * @brief Program the wakeup for the earliest deadline (tickless mode)
+ *
+ * Implementation details:
+ * - One safetimer_get_next_expiry_in() query (O(1) right after a pass)
+ * - Nothing is programmed when a timer is already due: the caller must
+ *   not sleep, the next pass runs it
+ */
+uint32_t safetimer_tickless_arm_in(safetimer_pool_t *pool) {
+  uint32_t next;
+
+  next = safetimer_get_next_expiry_in(pool);
+  if (next != 0U) {
+    bsp_set_wakeup(next);
+  }
+  return next;
+}
+#endif
+
 /* ========== Optional Query/Diagnostic APIs ========== */
 #if ENABLE_QUERY_API
 
 /**
  * @brief Get timer running status
  */
-timer_error_t safetimer_get_status(safetimer_handle_t handle, int *is_running) {
-  uint8_t slot_index;
+timer_error_t safetimer_get_status_in(safetimer_pool_t *pool,
+                                      safetimer_handle_t handle,
+                                      int *is_running) {
+  slot_index_t slot_index;
+
+  CRIT_API(SAFETIMER_API_QUERY);
 
 #if ENABLE_PARAM_CHECK
-  if (!validate_handle(handle)) {
+  if (!validate_handle(pool, handle)) {
     return TIMER_ERR_INVALID;
   }
 
@@ -827,9 +2156,9 @@ timer_error_t safetimer_get_status(safetimer_handle_t handle, int *is_running) {
 
   slot_index = DECODE_INDEX(handle);
 
-  bsp_enter_critical();
-  *is_running = (int)SLOT_GET_ACTIVE(g_timer_pool.slots[slot_index]);
-  bsp_exit_critical();
+  POOL_ENTER_CRITICAL(pool);
+  *is_running = (int)SLOT_GET_ACTIVE(slot_index);
+  POOL_EXIT_CRITICAL(pool);
 
   return TIMER_OK;
 }
@@ -837,14 +2166,17 @@ timer_error_t safetimer_get_status(safetimer_handle_t handle, int *is_running) {
 /**
  * @brief Get remaining time until expiration
  */
-timer_error_t safetimer_get_remaining(safetimer_handle_t handle,
-                                      uint32_t *remaining_ms) {
+timer_error_t safetimer_get_remaining_in(safetimer_pool_t *pool,
+                                         safetimer_handle_t handle,
+                                         uint32_t *remaining_ms) {
   bsp_tick_t current_tick;
   int32_t diff; /* Use int32_t for correct wraparound handling (ADR-005) */
-  uint8_t slot_index;
+  slot_index_t slot_index;
+
+  CRIT_API(SAFETIMER_API_QUERY);
 
 #if ENABLE_PARAM_CHECK
-  if (!validate_handle(handle)) {
+  if (!validate_handle(pool, handle)) {
     return TIMER_ERR_INVALID;
   }
 
@@ -855,18 +2187,17 @@ timer_error_t safetimer_get_remaining(safetimer_handle_t handle,
 
   slot_index = DECODE_INDEX(handle);
 
-  bsp_enter_critical();
+  POOL_ENTER_CRITICAL(pool);
 
-  if (!SLOT_GET_ACTIVE(g_timer_pool.slots[slot_index])) {
+  if (!SLOT_GET_ACTIVE(slot_index)) {
     /* Stopped timer */
     *remaining_ms = 0;
-    bsp_exit_critical();
+    POOL_EXIT_CRITICAL(pool);
     return TIMER_OK;
   }
 
   current_tick = bsp_get_ticks();
-  diff = safetimer_tick_diff(g_timer_pool.slots[slot_index].expire_time,
-                             current_tick);
+  diff = safetimer_tick_diff(SLOT_EXPIRE(slot_index), current_tick);
 
   if (diff < 0) {
     /* Already expired but not yet processed */
@@ -875,7 +2206,7 @@ timer_error_t safetimer_get_remaining(safetimer_handle_t handle,
     *remaining_ms = (uint32_t)diff;
   }
 
-  bsp_exit_critical();
+  POOL_EXIT_CRITICAL(pool);
 
   return TIMER_OK;
 }
@@ -883,22 +2214,29 @@ timer_error_t safetimer_get_remaining(safetimer_handle_t handle,
 /**
  * @brief Get timer pool usage statistics
  */
-timer_error_t safetimer_get_pool_usage(int *used_count, int *total_count) {
-  uint8_t i;
+timer_error_t safetimer_get_pool_usage_in(safetimer_pool_t *pool,
+                                         int *used_count, int *total_count) {
+  safetimer_bitmap_t used;
+  uint8_t w;
   int count;
 
-  count = 0;
-
-  bsp_enter_critical();
+  CRIT_API(SAFETIMER_API_QUERY);
 
-  /* Count set bits in bitmap */
-  for (i = 0; i < MAX_TIMERS; i++) {
-    if (g_timer_pool.used_bitmap & (BITMAP_ONE << i)) {
-      count++;
-    }
+#if ENABLE_PARAM_CHECK
+  if (pool == NULL) {
+    return TIMER_ERR_INVALID;
   }
+#endif
 
-  bsp_exit_critical();
+  count = 0;
+  for (w = 0; w < BITMAP_WORDS; w++) {
+    POOL_ENTER_CRITICAL(pool);
+    used = pool->used_bitmap[w];
+    POOL_EXIT_CRITICAL(pool);
+
+    /* Count set bits outside the critical section (static slots included) */
+    count += (int)BITMAP_POPCOUNT(used | BITMAP_STATIC_MASK(w));
+  }
 
   if (used_count != NULL) {
     *used_count = count;
@@ -913,220 +2251,2622 @@ timer_error_t safetimer_get_pool_usage(int *used_count, int *total_count) {
 
 #endif /* ENABLE_QUERY_API */
 
-/* ========== Static Function Implementation ========== */
-
-#ifdef UNIT_TEST
-/**
- * @brief Reset timer pool (FOR TESTING ONLY)
- *
- * @warning This function is ONLY for unit testing
- * @warning DO NOT use in production code
- */
-void safetimer_test_reset_pool(void) {
-  uint8_t i;
-  for (i = 0; i < MAX_TIMERS; i++) {
-    g_timer_pool.slots[i].period = 0;
-    g_timer_pool.slots[i].expire_time = 0;
-    g_timer_pool.slots[i].callback = NULL;
-#if SAFETIMER_ENABLE_USER_DATA
-    g_timer_pool.slots[i].user_data = NULL;
-#endif
-    /* Use explicit memset or set meta to 0? Just set individual flag macros or
-     * simpler: */
-#if USE_BITFIELD_META
-    g_timer_pool.slots[i].meta.mode = 0;
-    g_timer_pool.slots[i].meta.active = 0;
-    g_timer_pool.slots[i].meta.generation = 0;
-#else
-    g_timer_pool.slots[i].meta = 0;
-#endif
-  }
-  g_timer_pool.used_bitmap = 0;
-  g_timer_pool.next_generation = 1;
-}
-#endif
-
+#if SAFETIMER_ENABLE_STATS
 /**
- * @brief Validate timer handle (with generation check for ABA prevention)
+ * @brief Copy the statistics of one timer
  *
- * @param handle Timer handle to validate
- *
- * @return 1 if valid and allocated, 0 otherwise
- *
- * @note Internal helper - assumes ENABLE_PARAM_CHECK=1
- * @note Validates both slot index and generation counter (fixes Trap #1)
+ * Implementation details:
+ * - Copied in one critical section (consistent with the last expiry)
  */
-STATIC int validate_handle(safetimer_handle_t handle) {
-  uint8_t slot_index;
-  uint8_t handle_gen;
+timer_error_t safetimer_get_stats_in(safetimer_pool_t *pool,
+                                     safetimer_handle_t handle,
+                                     safetimer_stats_t *stats) {
+  slot_index_t slot_index;
 
-  /* Decode handle */
-  slot_index = DECODE_INDEX(handle);
-  handle_gen = DECODE_GEN(handle);
+  CRIT_API(SAFETIMER_API_QUERY);
 
-  /* Range check (slot_index is uint8_t, so only check upper bound) */
-  if (slot_index >= MAX_TIMERS) {
-    return 0;
+  if (stats == NULL) {
+    return TIMER_ERR_INVALID;
   }
 
-  /* Allocation check */
-  if ((g_timer_pool.used_bitmap & (BITMAP_ONE << slot_index)) == 0) {
-    return 0;
+  if (!validate_handle(pool, handle)) {
+    return TIMER_ERR_INVALID;
   }
 
-  /* Check generation */
-  if (handle_gen != SLOT_GET_GEN(g_timer_pool.slots[slot_index])) {
-    return 0; /* Generation mismatch (timer deleted/reused) */
-  }
+  slot_index = DECODE_INDEX(handle);
 
-  return 1;
+  POOL_ENTER_CRITICAL(pool);
+  *stats = pool->stats[slot_index];
+  POOL_EXIT_CRITICAL(pool);
+
+  return TIMER_OK;
+}
+
+/**
+ * @brief Reset the statistics of one timer
+ */
+timer_error_t safetimer_reset_stats_in(safetimer_pool_t *pool,
+                                       safetimer_handle_t handle) {
+  CRIT_API(SAFETIMER_API_QUERY);
+
+  if (!validate_handle(pool, handle)) {
+    return TIMER_ERR_INVALID;
+  }
+
+  POOL_ENTER_CRITICAL(pool);
+  stats_clear_slot(pool, DECODE_INDEX(handle));
+  POOL_EXIT_CRITICAL(pool);
+
+  return TIMER_OK;
+}
+
+/**
+ * @brief Copy the pool-wide statistics
+ */
+timer_error_t safetimer_get_pool_stats_in(safetimer_pool_t *pool,
+                                          safetimer_pool_stats_t *stats) {
+  CRIT_API(SAFETIMER_API_QUERY);
+
+  if (pool == NULL || stats == NULL) {
+    return TIMER_ERR_INVALID;
+  }
+
+  POOL_ENTER_CRITICAL(pool);
+  *stats = pool->pool_stats;
+  POOL_EXIT_CRITICAL(pool);
+
+  return TIMER_OK;
+}
+
+/**
+ * @brief Reset the pool-wide statistics (per-timer statistics are kept)
+ */
+void safetimer_reset_pool_stats_in(safetimer_pool_t *pool) {
+  CRIT_API(SAFETIMER_API_QUERY);
+
+  if (pool == NULL) {
+    return;
+  }
+
+  POOL_ENTER_CRITICAL(pool);
+  pool->pool_stats.max_pass = 0;
+  pool->pool_stats.max_critical = 0;
+  POOL_EXIT_CRITICAL(pool);
+}
+#endif /* SAFETIMER_ENABLE_STATS */
+
+#if SAFETIMER_ENABLE_TRACE
+/**
+ * @brief Attach (or detach with NULL) the event trace ring
+ *
+ * Implementation details:
+ * - Power-of-two capacity: the write index is trace_head & trace_mask
+ * - trace_head counts every record, the host derives the oldest one
+ * - trace_head folds from 2 * capacity back to capacity (not 0 at 65536):
+ *   head & mask stays the write index, and a count above capacity always
+ *   means the ring wrapped
+ */
+timer_error_t safetimer_trace_attach_in(safetimer_pool_t *pool,
+                                        safetimer_trace_record_t *buffer,
+                                        uint16_t capacity) {
+  CRIT_API(SAFETIMER_API_CONFIG);
+
+  if (pool == NULL) {
+    return TIMER_ERR_INVALID;
+  }
+  if (buffer != NULL &&
+      (capacity < 2 || capacity > 32768U ||
+       (capacity & (uint16_t)(capacity - 1U)) != 0)) {
+    return TIMER_ERR_INVALID;
+  }
+
+  POOL_ENTER_CRITICAL(pool);
+  pool->trace_buf = buffer;
+  pool->trace_mask = (buffer != NULL) ? (uint16_t)(capacity - 1U) : 0;
+  pool->trace_head = 0;
+  POOL_EXIT_CRITICAL(pool);
+
+  return TIMER_OK;
+}
+
+/**
+ * @brief Number of trace records written since the last attach
+ */
+uint16_t safetimer_trace_count_in(safetimer_pool_t *pool) {
+  uint16_t count; /* C89: declare before statements */
+
+  CRIT_API(SAFETIMER_API_QUERY);
+
+  if (pool == NULL) {
+    return 0;
+  }
+
+  POOL_ENTER_CRITICAL(pool);
+  count = pool->trace_head;
+  POOL_EXIT_CRITICAL(pool);
+
+  return count;
+}
+#endif /* SAFETIMER_ENABLE_TRACE */
+
+#if SAFETIMER_ENABLE_CRIT_PROFILE
+/**
+ * @brief Head of the call site list (newest registered first)
+ */
+const safetimer_crit_site_t *safetimer_crit_first_site(void) {
+  const safetimer_crit_site_t *site; /* C89: declare before statements */
+
+  bsp_enter_critical(); /* Profiler bookkeeping: not profiled itself */
+  site = g_crit_profile.sites;
+  bsp_exit_critical();
+
+  return site;
+}
+
+/**
+ * @brief Longest critical section of one public API group
+ */
+uint32_t safetimer_get_crit_api_max(safetimer_api_t api) {
+  uint32_t max_cycles; /* C89: declare before statements */
+
+  if ((unsigned int)api >= (unsigned int)SAFETIMER_API_COUNT) {
+    return 0;
+  }
+
+  bsp_enter_critical();
+  max_cycles = g_crit_profile.api_max[api];
+  bsp_exit_critical();
+
+  return max_cycles;
+}
+
+/**
+ * @brief Clear every site and group maximum (sites stay linked)
+ */
+void safetimer_reset_crit_profile(void) {
+  safetimer_crit_site_t *site; /* C89: declare before statements */
+  uint8_t i;
+
+  bsp_enter_critical();
+  for (i = 0; i < (uint8_t)SAFETIMER_API_COUNT; i++) {
+    g_crit_profile.api_max[i] = 0;
+  }
+  site = g_crit_profile.sites;
+  bsp_exit_critical();
+
+  /* One short section per site: the list only grows at its head */
+  while (site != NULL) {
+    bsp_enter_critical();
+    site->max_cycles = 0;
+    site = site->next;
+    bsp_exit_critical();
+  }
+}
+
+/**
+ * @brief Profiled BSP critical section for the semaphore macros
+ *
+ * Implementation details:
+ * - Same bookkeeping as POOL_ENTER_CRITICAL(), but the section counts
+ *   towards SAFETIMER_API_SEM whatever API is running
+ */
+void safetimer_crit_enter(safetimer_crit_site_t *site) {
+  bsp_enter_critical();
+  crit_site_enter(site);
+  g_crit_profile.start = bsp_get_cycles();
+}
+
+/**
+ * @brief Leave a section entered with safetimer_crit_enter()
+ */
+void safetimer_crit_exit(void) {
+  crit_profile_record(SAFETIMER_API_SEM,
+                      (uint32_t)(bsp_get_cycles() - g_crit_profile.start));
+  bsp_exit_critical();
+}
+#endif /* SAFETIMER_ENABLE_CRIT_PROFILE */
+
+/* ========== Default Pool API ========== */
+
+/*
+ * Pool-less API: thin wrappers over the *_in() functions on g_timer_pool.
+ */
+
+#if SAFETIMER_ENABLE_USER_DATA
+safetimer_handle_t safetimer_create(uint32_t period_ms, timer_mode_t mode,
+                                    timer_callback_t callback,
+                                    void *user_data) {
+  return safetimer_create_in(&g_timer_pool, period_ms, mode, callback,
+                             user_data);
+}
+#else
+safetimer_handle_t safetimer_create(uint32_t period_ms, timer_mode_t mode,
+                                    timer_callback_t callback) {
+  return safetimer_create_in(&g_timer_pool, period_ms, mode, callback);
+}
+#endif
+
+#if ENABLE_HELPER_API
+#if SAFETIMER_ENABLE_USER_DATA
+timer_error_t safetimer_create_batch(uint8_t count, uint32_t period_ms,
+                                     timer_mode_t mode,
+                                     timer_callback_t *callbacks,
+                                     void **user_data, const uint32_t *offsets,
+                                     safetimer_handle_t *handles) {
+  return safetimer_create_batch_in(&g_timer_pool, count, period_ms, mode,
+                                   callbacks, user_data, offsets, handles);
+}
+#else
+timer_error_t safetimer_create_batch(uint8_t count, uint32_t period_ms,
+                                     timer_mode_t mode,
+                                     timer_callback_t *callbacks,
+                                     const uint32_t *offsets,
+                                     safetimer_handle_t *handles) {
+  return safetimer_create_batch_in(&g_timer_pool, count, period_ms, mode,
+                                   callbacks, offsets, handles);
+}
+#endif
+#endif
+
+#if SAFETIMER_ENABLE_FLAG_TIMERS
+safetimer_handle_t safetimer_create_flag(uint32_t period_ms,
+                                         timer_mode_t mode) {
+  return safetimer_create_flag_in(&g_timer_pool, period_ms, mode);
+}
+
+timer_error_t safetimer_poll_expired(safetimer_bitmap_t *expired) {
+  return safetimer_poll_expired_in(&g_timer_pool, expired);
+}
+#endif
+
+timer_error_t safetimer_start(safetimer_handle_t handle) {
+  return safetimer_start_in(&g_timer_pool, handle);
+}
+
+timer_error_t safetimer_delete(safetimer_handle_t handle) {
+  return safetimer_delete_in(&g_timer_pool, handle);
+}
+
+timer_error_t safetimer_set_period(safetimer_handle_t handle,
+                                   uint32_t new_period_ms) {
+  return safetimer_set_period_in(&g_timer_pool, handle, new_period_ms);
+}
+
+timer_error_t safetimer_trigger(safetimer_handle_t handle) {
+  return safetimer_trigger_in(&g_timer_pool, handle);
+}
+
+#if SAFETIMER_PRIORITY_LEVELS > 1
+timer_error_t safetimer_set_priority(safetimer_handle_t handle,
+                                     uint8_t priority) {
+  return safetimer_set_priority_in(&g_timer_pool, handle, priority);
+}
+#endif
+
+#if SAFETIMER_ENABLE_SLACK
+timer_error_t safetimer_set_slack(safetimer_handle_t handle,
+                                  uint8_t slack_ms) {
+  return safetimer_set_slack_in(&g_timer_pool, handle, slack_ms);
+}
+#endif
+
+#if SAFETIMER_ENABLE_CORO
+timer_error_t safetimer_advance_period(safetimer_handle_t handle,
+                                       uint32_t new_period_ms) {
+  return safetimer_advance_period_in(&g_timer_pool, handle, new_period_ms);
+}
+
+safetimer_handle_t safetimer_get_current_handle(void) {
+  return safetimer_get_current_handle_in(&g_timer_pool);
+}
+#endif /* SAFETIMER_ENABLE_CORO */
+
+#if SAFETIMER_ENABLE_CATCHUP == SAFETIMER_CATCHUP_REPORT
+uint32_t safetimer_get_missed_count(void) {
+  return safetimer_get_missed_count_in(&g_timer_pool);
+}
+#endif
+
+#if SAFETIMER_ENABLE_SEM_WAKE
+timer_error_t safetimer_sem_wait_on(safetimer_handle_t handle,
+                                    const volatile void *sem) {
+  return safetimer_sem_wait_on_in(&g_timer_pool, handle, sem);
+}
+
+void safetimer_sem_wake(const volatile void *sem) {
+  safetimer_sem_wake_in(&g_timer_pool, sem);
+}
+#endif
+
+#if SAFETIMER_ENABLE_SEM_WAKE && SAFETIMER_ENABLE_ISR_QUEUE
+timer_error_t safetimer_sem_wake_from_isr(const volatile void *sem) {
+  return safetimer_sem_wake_from_isr_in(&g_timer_pool, sem);
+}
+#endif
+
+#if SAFETIMER_ENABLE_CORO_SCHED
+timer_error_t safetimer_sched_start(safetimer_sched_t *sched,
+                                    const safetimer_task_t *tasks,
+                                    uint8_t count) {
+  return safetimer_sched_start_in(&g_timer_pool, sched, tasks, count);
+}
+#endif
+
+void safetimer_process(void) { safetimer_process_pool(&g_timer_pool); }
+
+#if SAFETIMER_ENABLE_ISR_QUEUE
+timer_error_t safetimer_start_from_isr(safetimer_handle_t handle) {
+  return safetimer_start_from_isr_in(&g_timer_pool, handle);
+}
+
+timer_error_t safetimer_stop_from_isr(safetimer_handle_t handle) {
+  return safetimer_stop_from_isr_in(&g_timer_pool, handle);
+}
+
+timer_error_t safetimer_set_period_from_isr(safetimer_handle_t handle,
+                                            uint32_t new_period_ms) {
+  return safetimer_set_period_from_isr_in(&g_timer_pool, handle,
+                                          new_period_ms);
+}
+
+timer_error_t safetimer_delete_from_isr(safetimer_handle_t handle) {
+  return safetimer_delete_from_isr_in(&g_timer_pool, handle);
+}
+
+timer_error_t safetimer_trigger_from_isr(safetimer_handle_t handle) {
+  return safetimer_trigger_from_isr_in(&g_timer_pool, handle);
+}
+#endif
+
+#if SAFETIMER_ENABLE_ISR_DISPATCH
+void safetimer_isr_detect(void) { safetimer_isr_detect_in(&g_timer_pool); }
+
+void safetimer_dispatch_ready(void) {
+  safetimer_dispatch_ready_in(&g_timer_pool);
+}
+#endif
+
+#if SAFETIMER_ENABLE_PROCESS_BUDGET
+int safetimer_process_budget(uint16_t max_callbacks, uint32_t max_ticks) {
+  return safetimer_process_budget_in(&g_timer_pool, max_callbacks, max_ticks);
+}
+#endif
+
+uint32_t safetimer_get_next_expiry(void) {
+  return safetimer_get_next_expiry_in(&g_timer_pool);
+}
+
+#if SAFETIMER_BSP_TICKLESS
+uint32_t safetimer_tickless_arm(void) {
+  return safetimer_tickless_arm_in(&g_timer_pool);
+}
+#endif
+
+#if ENABLE_QUERY_API
+timer_error_t safetimer_stop(safetimer_handle_t handle) {
+  return safetimer_stop_in(&g_timer_pool, handle);
+}
+
+timer_error_t safetimer_get_status(safetimer_handle_t handle, int *is_running) {
+  return safetimer_get_status_in(&g_timer_pool, handle, is_running);
+}
+
+timer_error_t safetimer_get_remaining(safetimer_handle_t handle,
+                                      uint32_t *remaining_ms) {
+  return safetimer_get_remaining_in(&g_timer_pool, handle, remaining_ms);
+}
+
+timer_error_t safetimer_get_pool_usage(int *used_count, int *total_count) {
+  return safetimer_get_pool_usage_in(&g_timer_pool, used_count, total_count);
+}
+#endif /* ENABLE_QUERY_API */
+
+#if SAFETIMER_ENABLE_STATS
+timer_error_t safetimer_get_stats(safetimer_handle_t handle,
+                                  safetimer_stats_t *stats) {
+  return safetimer_get_stats_in(&g_timer_pool, handle, stats);
+}
+
+timer_error_t safetimer_reset_stats(safetimer_handle_t handle) {
+  return safetimer_reset_stats_in(&g_timer_pool, handle);
+}
+
+timer_error_t safetimer_get_pool_stats(safetimer_pool_stats_t *stats) {
+  return safetimer_get_pool_stats_in(&g_timer_pool, stats);
+}
+
+void safetimer_reset_pool_stats(void) {
+  safetimer_reset_pool_stats_in(&g_timer_pool);
+}
+#endif /* SAFETIMER_ENABLE_STATS */
+
+#if SAFETIMER_ENABLE_TRACE
+timer_error_t safetimer_trace_attach(safetimer_trace_record_t *buffer,
+                                     uint16_t capacity) {
+  return safetimer_trace_attach_in(&g_timer_pool, buffer, capacity);
+}
+
+uint16_t safetimer_trace_count(void) {
+  return safetimer_trace_count_in(&g_timer_pool);
+}
+#endif /* SAFETIMER_ENABLE_TRACE */
+
+/* ========== Static Function Implementation ========== */
+
+#ifdef UNIT_TEST
+/**
+ * @brief Reset timer pool (FOR TESTING ONLY)
+ *
+ * @warning This function is ONLY for unit testing
+ * @warning DO NOT use in production code
+ */
+void safetimer_test_reset_pool(void) {
+  safetimer_pool_init(&g_timer_pool);
+  g_timer_pool.next_generation = 1;
+}
+#endif
+
+/**
+ * @brief Validate timer handle (with generation check for ABA prevention)
+ *
+ * @param handle Timer handle to validate
+ *
+ * @return 1 if valid and allocated, 0 otherwise
+ *
+ * @note Internal helper - assumes ENABLE_PARAM_CHECK=1
+ * @note Validates both slot index and generation counter (fixes Trap #1)
+ */
+STATIC int validate_handle(safetimer_pool_t *pool, safetimer_handle_t handle) {
+  slot_index_t slot_index;
+  uint8_t handle_gen;
+
+  if (pool == NULL) {
+    return 0;
+  }
+
+  /* Decode handle */
+  slot_index = DECODE_INDEX(handle);
+  handle_gen = DECODE_GEN(handle);
+
+  /* Range check (slot_index is unsigned, so only check upper bound) */
+  if (slot_index >= MAX_TIMERS) {
+    return 0;
+  }
+
+  /* Allocation check */
+  if (!SLOT_IS_USED(slot_index)) {
+    return 0;
+  }
+
+  /* Check generation */
+  if (handle_gen != SLOT_GET_GEN(slot_index)) {
+    return 0; /* Generation mismatch (timer deleted/reused) */
+  }
+
+  return 1;
 }
 
 /**
  * @brief Find first free slot in timer pool
  *
- * @return Slot index (0 ~ MAX_TIMERS-1) if found, -1 if pool full
+ * @return Slot index (0 ~ MAX_TIMERS-1) if found, -1 if pool full
+ *
+ * @note Uses bit scan on the inverted used_bitmap (no per-slot loop)
+ * @note Called inside critical section - keep fast!
+ */
+STATIC int find_free_slot(safetimer_pool_t *pool) {
+  safetimer_bitmap_t free_map;
+  uint8_t w;
+
+  for (w = 0; w < BITMAP_WORDS; w++) {
+    free_map = BITMAP_FREE_WORD(pool, w);
+    if (free_map != 0) {
+      /* Lowest free slot */
+      return (int)(w * BITMAP_WORD_BITS) + (int)BITMAP_CTZ(free_map);
+    }
+  }
+
+  return -1; /* Pool full */
+}
+
+/**
+ * @brief Initialize a free slot as a new (stopped) timer
+ *
+ * @param slot_index Free slot (find_free_slot())
+ * @param user_data  Ignored without SAFETIMER_ENABLE_USER_DATA
+ * @return Handle with a fresh generation (never SAFETIMER_INVALID_HANDLE)
+ *
+ * @note Called inside critical section
+ */
+STATIC safetimer_handle_t alloc_slot(safetimer_pool_t *pool,
+                                     slot_index_t slot_index,
+                                     bsp_tick_t period, timer_mode_t mode,
+                                     timer_callback_t callback,
+                                     void *user_data) {
+  safetimer_handle_t handle;
+  uint8_t generation;
+
+  /* Allocate next generation ID (1~HANDLE_GEN_MAX, wraps, 0 reserved) */
+  pool->next_generation++;
+  if (pool->next_generation == 0 ||
+      pool->next_generation > HANDLE_GEN_MAX) {
+    pool->next_generation = 1;
+  }
+  generation = pool->next_generation;
+
+  /* Initialize timer slot */
+  SLOT_SET_PERIOD(slot_index, period);
+  SLOT_SET_MODE(slot_index, (uint8_t)mode);
+  SLOT_SET_CALLBACK(slot_index, callback);
+#if SAFETIMER_ENABLE_USER_DATA
+  SLOT_SET_USER_DATA(slot_index, user_data);
+#else
+  (void)user_data;
+#endif
+  SLOT_SET_ACTIVE(slot_index, 0); /* Not started yet */
+  SLOT_SET_GEN(slot_index, generation);
+  BITMAP_SET(pool->used_bitmap, slot_index);
+#if SAFETIMER_PRIORITY_LEVELS > 1
+  prio_assign(pool, slot_index, 0); /* Reused slot: back to level 0 */
+#endif
+#if SAFETIMER_ENABLE_SLACK
+  pool->slack[slot_index] = 0; /* Reused slot: no slack */
+  BITMAP_CLEAR(pool->slack_bitmap, slot_index);
+#endif
+#if SAFETIMER_ENABLE_SEM_WAKE
+  BITMAP_CLEAR(pool->sem_bitmap, slot_index); /* Reused slot: not waiting */
+#endif
+#if SAFETIMER_ENABLE_FLAG_TIMERS
+  SLOT_SET_FLAG(slot_index, 0); /* Reused slot: callback timer */
+#endif
+#if SAFETIMER_ENABLE_STATS
+  stats_clear_slot(pool, slot_index);
+#endif
+
+  /* Encode handle: [generation:3bit][index:5bit] */
+  handle = ENCODE_HANDLE(generation, slot_index);
+
+  /* Prevent handle collision with SAFETIMER_INVALID_HANDLE (-1)
+   * Edge case: When handle type is int8_t or when generation/index combination
+   * produces -1, we must skip to next generation to ensure valid handle.
+   * Loop guarantees we find a valid handle (max iterations = HANDLE_GEN_MAX).
+   */
+  while (handle == SAFETIMER_INVALID_HANDLE) {
+    pool->next_generation++;
+    if (pool->next_generation == 0 ||
+        pool->next_generation > HANDLE_GEN_MAX) {
+      pool->next_generation = 1;
+    }
+    generation = pool->next_generation;
+    SLOT_SET_GEN(slot_index, generation);
+    handle = ENCODE_HANDLE(generation, slot_index);
+  }
+
+  return handle;
+}
+
+#if SAFETIMER_PRIORITY_LEVELS > 1
+/**
+ * @brief Move a slot to a priority level
+ *
+ * @param slot_index Slot index
+ * @param priority   0 ~ SAFETIMER_PRIORITY_LEVELS-1
+ *
+ * @note Called inside critical section
+ */
+STATIC void prio_assign(safetimer_pool_t *pool, slot_index_t slot_index,
+                        uint8_t priority) {
+  uint8_t level;
+
+  for (level = 1; level < SAFETIMER_PRIORITY_LEVELS; level++) {
+    if (level == priority) {
+      BITMAP_SET(pool->prio_bitmap[level - 1U], slot_index);
+    } else {
+      BITMAP_CLEAR(pool->prio_bitmap[level - 1U], slot_index);
+    }
+  }
+}
+
+/**
+ * @brief Move the due slots of one priority level out of a due bitmap
+ *
+ * @param level     Priority level (0 = all slots still in due)
+ * @param due       In/out: due slots, this level removed
+ * @param level_due Out: due slots of this level
+ *
+ * Levels are taken from the highest down, so a priority changed while a
+ * pass runs only reorders: level 0 collects every slot left over.
+ */
+STATIC void prio_take_level(safetimer_pool_t *pool, uint8_t level,
+                            safetimer_bitmap_t *due,
+                            safetimer_bitmap_t *level_due) {
+  uint8_t w;
+
+  for (w = 0; w < BITMAP_WORDS; w++) {
+    if (level == 0) {
+      level_due[w] = due[w];
+    } else {
+      level_due[w] =
+          (safetimer_bitmap_t)(due[w] & pool->prio_bitmap[level - 1U][w]);
+    }
+    due[w] &= (safetimer_bitmap_t)~level_due[w];
+  }
+}
+#endif /* SAFETIMER_PRIORITY_LEVELS > 1 */
+
+#ifdef BITMAP_PORTABLE_BITOPS
+/**
+ * @brief Portable count-trailing-zeros for compilers without builtins
+ *
+ * @param map Non-zero bitmap
+ * @return Index of the lowest set bit
+ */
+STATIC uint8_t bitmap_ctz(safetimer_bitmap_t map) {
+  uint8_t index = 0;
+
+  while ((map & BITMAP_ONE) == 0) {
+    map >>= 1;
+    index++;
+  }
+
+  return index;
+}
+
+/**
+ * @brief Portable population count for compilers without builtins
+ *
+ * @param map Bitmap
+ * @return Number of set bits (loops once per set bit)
+ */
+STATIC uint8_t bitmap_popcount(safetimer_bitmap_t map) {
+  uint8_t count = 0;
+
+  while (map != 0) {
+    map &= (safetimer_bitmap_t)(map - 1U);
+    count++;
+  }
+
+  return count;
+}
+#endif /* BITMAP_PORTABLE_BITOPS */
+
+/**
+ * @brief Update expiration time for a timer slot
+ *
+ * @param slot_index Valid slot index (0 ~ MAX_TIMERS-1)
+ *
+ * @note Calculates: expire_time = current_tick + period
+ * @note Handles 32-bit wraparound automatically
+ * @note Called inside critical section
+ */
+STATIC void update_expire_time(safetimer_pool_t *pool, slot_index_t slot_index,
+                               bsp_tick_t current_tick) {
+  /*
+   * Use the tick captured outside the SafeTimer critical section so BSP
+   * implementations remain free to mask interrupts when returning ticks.
+   *
+   * Set expiration time (32-bit wraparound handled by ADR-005 algorithm)
+   * Example: current=4294967290, period=100
+   *   → expire = 4294967390 (wraps to 94)
+   *   → safetimer_process() will correctly detect expiration
+   */
+  SLOT_SET_EXPIRE(slot_index, current_tick + SLOT_PERIOD(slot_index));
+}
+
+/**
+ * @brief Arm a timer from a base tick (restart if already running)
+ *
+ * @param slot_index Validated slot index
+ * @param start_tick Countdown base (caller's or ISR's bsp_get_ticks())
+ *
+ * @note Called outside critical section (takes the pool lock)
+ */
+STATIC void start_slot(safetimer_pool_t *pool, slot_index_t slot_index,
+                       bsp_tick_t start_tick) {
+  POOL_ENTER_CRITICAL(pool);
+  arm_slot(pool, slot_index, start_tick);
+  POOL_EXIT_CRITICAL(pool);
+}
+
+/**
+ * @brief Arm a timer from a base tick (body of start_slot())
+ *
+ * @param slot_index Validated slot index
+ * @param start_tick Countdown base: expire_time = start_tick + period
+ *
+ * @note Called inside critical section
+ */
+STATIC void arm_slot(safetimer_pool_t *pool, slot_index_t slot_index,
+                     bsp_tick_t start_tick) {
+  /* A restart may postpone the cached earliest deadline */
+  if (SLOT_GET_ACTIVE(slot_index)) {
+    expiry_cache_raise(pool, SLOT_EXPIRE(slot_index));
+  }
+
+  /* Update expiration time */
+  update_expire_time(pool, slot_index, start_tick);
+
+  /* Mark as active */
+  SLOT_SET_ACTIVE(slot_index, 1);
+  SCHED_ARM(slot_index);
+  expiry_cache_lower(pool, SLOT_EXPIRE(slot_index));
+#if SAFETIMER_ENABLE_TRACE
+  trace_record(pool, slot_index, SAFETIMER_TRACE_START, start_tick, 0);
+#endif
+}
+
+/**
+ * @brief Stop a timer and optionally release its slot
+ *
+ * @param slot_index Validated slot index
+ * @param release    1 = also clear used_bitmap (delete)
+ *
+ * @note Called outside critical section (takes the pool lock)
+ * @note Generation remains on release, preventing handle reuse (ABA)
+ */
+STATIC void stop_slot(safetimer_pool_t *pool, slot_index_t slot_index,
+                      uint8_t release) {
+#if SAFETIMER_ENABLE_TRACE
+  bsp_tick_t trace_tick = bsp_get_ticks(); /* Outside the critical section */
+#endif
+
+  POOL_ENTER_CRITICAL(pool);
+
+  if (SLOT_GET_ACTIVE(slot_index)) {
+    expiry_cache_raise(pool, SLOT_EXPIRE(slot_index));
+  }
+  SLOT_SET_ACTIVE(slot_index, 0);
+  SCHED_DISARM(slot_index);
+
+  if (release) {
+    BITMAP_CLEAR(pool->used_bitmap, slot_index);
+#if SAFETIMER_ENABLE_SEM_WAKE
+    BITMAP_CLEAR(pool->sem_bitmap, slot_index); /* No wake for a dead slot */
+#endif
+#if SAFETIMER_ENABLE_FLAG_TIMERS
+    BITMAP_CLEAR(pool->expired_bitmap, slot_index); /* Not polled as fired */
+#endif
+  }
+#if SAFETIMER_ENABLE_TRACE
+  trace_record(pool, slot_index,
+               release ? SAFETIMER_TRACE_DELETE : SAFETIMER_TRACE_STOP,
+               trace_tick, 0);
+#endif
+
+  POOL_EXIT_CRITICAL(pool);
+}
+
+/**
+ * @brief Make a timer due at current_tick (start it if stopped)
+ *
+ * @param slot_index   Validated slot index
+ * @param current_tick New deadline (caller's or ISR's bsp_get_ticks())
+ *
+ * @note Called inside critical section
+ */
+STATIC void wake_slot(safetimer_pool_t *pool, slot_index_t slot_index,
+                      bsp_tick_t current_tick) {
+  if (SLOT_GET_ACTIVE(slot_index)) {
+    expiry_cache_raise(pool, SLOT_EXPIRE(slot_index));
+  }
+  SLOT_SET_EXPIRE(slot_index, current_tick);
+  SLOT_SET_ACTIVE(slot_index, 1);
+  SCHED_ARM(slot_index);
+  expiry_cache_lower(pool, current_tick);
+#if SAFETIMER_ENABLE_TRACE
+  trace_record(pool, slot_index, SAFETIMER_TRACE_START, current_tick, 0);
+#endif
+}
+
+/**
+ * @brief Change a timer's period, restarting it from current_tick if running
+ *
+ * @param slot_index   Validated slot index
+ * @param period       New period (range-checked by the caller)
+ * @param current_tick Countdown base for a running timer
+ *
+ * @note Called outside critical section (takes the pool lock)
+ */
+STATIC void set_period_slot(safetimer_pool_t *pool, slot_index_t slot_index,
+                            bsp_tick_t period, bsp_tick_t current_tick) {
+  POOL_ENTER_CRITICAL(pool);
+
+  /* Update period field */
+  SLOT_SET_PERIOD(slot_index, period);
+
+  /* If timer is currently running, restart countdown with new period.
+   * This is equivalent to "delete + create + start" but preserves handle.
+   * Breaks phase-locking intentionally - documented trade-off. */
+  if (SLOT_GET_ACTIVE(slot_index)) {
+    expiry_cache_raise(pool, SLOT_EXPIRE(slot_index));
+    SLOT_SET_EXPIRE(slot_index, current_tick + period);
+    SCHED_ARM(slot_index);
+    expiry_cache_lower(pool, SLOT_EXPIRE(slot_index));
+  }
+  /* If timer is stopped, new period takes effect on next safetimer_start() */
+
+  POOL_EXIT_CRITICAL(pool);
+}
+
+#if SAFETIMER_ENABLE_ISR_QUEUE
+/**
+ * @brief Append a command to the pool's ISR ring (producer side)
+ *
+ * @param op     ISR_CMD_* operation
+ * @param period New period (ISR_CMD_SET_PERIOD only)
+ * @return TIMER_OK, or TIMER_ERR_FULL if the ring is full
+ *
+ * @note Called from ISR context, never masks interrupts: the entry is
+ *       written before isr_head publishes it (both volatile)
+ */
+STATIC timer_error_t isr_queue_push(safetimer_pool_t *pool,
+                                    safetimer_handle_t handle, uint8_t op,
+                                    bsp_tick_t period) {
+  uint8_t head;
+  uint8_t next;
+
+  head = pool->isr_head;
+  next = (uint8_t)((head + 1U) & ISR_QUEUE_MASK);
+  if (next == pool->isr_tail) {
+    return TIMER_ERR_FULL; /* Ring full (process() not called often enough) */
+  }
+
+  pool->isr_queue[head].handle = handle;
+  pool->isr_queue[head].tick = bsp_get_ticks();
+  pool->isr_queue[head].period = period;
+  pool->isr_queue[head].op = op;
+  pool->isr_head = next; /* Publish */
+#if SAFETIMER_ENABLE_ISR_DISPATCH
+  pool->ready = 1; /* Let safetimer_dispatch_ready() apply it */
+#endif
+
+  return TIMER_OK;
+}
+
+/**
+ * @brief Apply every queued ISR command in order (consumer side)
+ *
+ * Stale handles (timer deleted/reused since the ISR queued the command) are
+ * dropped by validate_handle().
+ *
+ * @note Called at the start of a safetimer_process() pass, outside critical
+ *       section
+ */
+STATIC void isr_queue_drain(safetimer_pool_t *pool) {
+  uint8_t tail;
+  safetimer_handle_t handle; /* C89: declare before statements */
+  bsp_tick_t tick;           /* C89: declare before statements */
+  bsp_tick_t period;         /* C89: declare before statements */
+  uint8_t op;                /* C89: declare before statements */
+#if SAFETIMER_ENABLE_SEM_WAKE
+  const volatile void *sem; /* C89: declare before statements */
+#endif
+
+  tail = pool->isr_tail;
+  while (tail != pool->isr_head) {
+    handle = pool->isr_queue[tail].handle;
+    tick = pool->isr_queue[tail].tick;
+    period = pool->isr_queue[tail].period;
+    op = pool->isr_queue[tail].op;
+#if SAFETIMER_ENABLE_SEM_WAKE
+    sem = pool->isr_queue[tail].sem;
+#endif
+    tail = (uint8_t)((tail + 1U) & ISR_QUEUE_MASK);
+    pool->isr_tail = tail; /* Entry copied: release it to the ISR */
+
+#if SAFETIMER_ENABLE_SEM_WAKE
+    if (op == ISR_CMD_SEM_WAKE) {
+      sem_wake_waiters(pool, sem, tick); /* Waiters re-checked there */
+      continue;
+    }
+#endif
+    if (!validate_handle(pool, handle)) {
+      continue;
+    }
+
+    switch (op) {
+    case ISR_CMD_START:
+      start_slot(pool, DECODE_INDEX(handle), tick);
+      break;
+    case ISR_CMD_STOP:
+      stop_slot(pool, DECODE_INDEX(handle), 0);
+      break;
+    case ISR_CMD_SET_PERIOD:
+      set_period_slot(pool, DECODE_INDEX(handle), period, tick);
+      break;
+    case ISR_CMD_TRIGGER:
+      POOL_ENTER_CRITICAL(pool);
+      wake_slot(pool, DECODE_INDEX(handle), tick);
+      POOL_EXIT_CRITICAL(pool);
+      break;
+    default: /* ISR_CMD_DELETE */
+      stop_slot(pool, DECODE_INDEX(handle), 1);
+      break;
+    }
+  }
+}
+#endif /* SAFETIMER_ENABLE_ISR_QUEUE */
+
+/**
+ * @brief Trigger timer callback and handle mode
+ *
+ * @param slot_index Valid slot index (0 ~ MAX_TIMERS-1)
+ *
+ * @note For ONE_SHOT: stops timer after callback
+ * @note For REPEAT: advances expire_time by period (phase-locked, eliminates
+ * drift)
+ * @note Calls user callback if not NULL
+ * @note Called outside critical section to allow callback to run safely
+ */
+STATIC void trigger_timer(safetimer_pool_t *pool, slot_index_t slot_index,
+                          bsp_tick_t current_tick,
+                          timer_callback_t *callback_out,
+                          void **user_data_out) {
+#if SAFETIMER_ENABLE_CATCHUP != SAFETIMER_CATCHUP_BURST
+  /* C89: declare all variables at block start */
+  bsp_tick_t old_expire;
+  bsp_tick_t period;
+  uint8_t old_active;
+  bsp_tick_t new_expire;
+  uint32_t missed;
+#elif !SAFETIMER_ENABLE_STATS && !SAFETIMER_ENABLE_TRACE
+  (void)current_tick; /* Catch-up mode advances one period per pass */
+#endif
+#if !SAFETIMER_ENABLE_USER_DATA
+  (void)user_data_out; /* No user data to report */
+#endif
+
+  /* Caller already holds the BSP critical section. */
+
+#if SAFETIMER_ENABLE_CATCHUP == SAFETIMER_CATCHUP_REPORT
+  pool->executing_missed = 0; /* ONE_SHOT, on time, or lost the commit */
+#endif
+#if SAFETIMER_ENABLE_STATS
+  stats_record_expiry(pool, slot_index, current_tick);
+#endif
+#if SAFETIMER_ENABLE_TRACE
+  trace_expiry(pool, slot_index, current_tick);
+#endif
+
+  if (callback_out != NULL) {
+    *callback_out = SLOT_CALLBACK(slot_index);
+  }
+#if SAFETIMER_ENABLE_FLAG_TIMERS
+  if (SLOT_GET_FLAG(slot_index)) {
+    BITMAP_SET(pool->expired_bitmap, slot_index); /* Polled, never called */
+  }
+#endif
+
+#if SAFETIMER_ENABLE_USER_DATA
+  if (user_data_out != NULL) {
+    *user_data_out = SLOT_USER_DATA(slot_index);
+  }
+#endif
+
+#if SAFETIMER_REPEAT_ONLY
+  /* FORCE REPEAT: advance until next expiration */
+  /* Remove ONE_SHOT check to save ROM */
+  {
+#else
+  if (SLOT_GET_MODE(slot_index) == TIMER_MODE_ONE_SHOT) {
+    /* ONE_SHOT: stop timer */
+    SLOT_SET_ACTIVE(slot_index, 0);
+    SCHED_DISARM(slot_index);
+  } else {
+#endif
+    /* REPEAT: advance until the next expiration is in the future */
+#if SAFETIMER_ENABLE_CATCHUP == SAFETIMER_CATCHUP_BURST
+    /* Catch-up mode: fire callbacks for each missed interval */
+    SLOT_SET_EXPIRE(slot_index,
+                    SLOT_EXPIRE(slot_index) + SLOT_PERIOD(slot_index));
+    SCHED_ARM(slot_index);
+#else
+    /* Skip mode (default): coalesce missed intervals using math instead of loop
+     * to prevent watchdog timeout in critical section (fixes Trap #2)
+     *
+     * CRITICAL: Division moved outside critical section to reduce interrupt
+     * latency on 8-bit MCUs without hardware divider (fixes Heavy Division
+     * risk). 32-bit division can take 50-150μs, unacceptable in critical
+     * section. */
+
+    /* Snapshot values inside critical section */
+    old_expire = SLOT_EXPIRE(slot_index);
+    period = SLOT_PERIOD(slot_index);
+    old_active = SLOT_GET_ACTIVE(slot_index);
+
+    /* Release critical section before expensive division */
+    POOL_EXIT_CRITICAL(pool);
+
+#if ENABLE_DEBUG_ASSERT
+    /* Defensive: period should never be 0 (validated in create/set_period) */
+    if (period == 0) {
+      POOL_ENTER_CRITICAL(pool); /* Restore critical section state */
+      return;               /* Avoid divide-by-zero, fail safe */
+    }
+#endif
+
+    /* Calculate how many periods we're behind (OUTSIDE critical section) */
+    new_expire = calc_skip_expire(old_expire, period, current_tick, &missed);
+
+    /* Re-enter critical section to update expire_time */
+    POOL_ENTER_CRITICAL(pool);
+
+    /* Verify expire_time AND active state weren't modified by ISR during
+     * calculation (fixes Stop-Start Overwrite Race + ABA variant).
+     *
+     * Double verification prevents extreme coincidence where ISR stop+start
+     * results in same expire_time value (ABA variant). Checking both
+     * expire_time and active ensures we detect any ISR interference. */
+    if (SLOT_EXPIRE(slot_index) == old_expire &&
+        SLOT_GET_ACTIVE(slot_index) == old_active) {
+      SLOT_SET_EXPIRE(slot_index, new_expire);
+      SCHED_ARM(slot_index);
+#if SAFETIMER_ENABLE_STATS
+      pool->stats[slot_index].missed_count += missed;
+#endif
+#if SAFETIMER_ENABLE_TRACE
+      if (missed > 0) {
+        trace_record(pool, slot_index, SAFETIMER_TRACE_SKIP, current_tick,
+                     missed);
+      }
+#endif
+#if SAFETIMER_ENABLE_CATCHUP == SAFETIMER_CATCHUP_REPORT
+      pool->executing_missed = missed;
+#elif !SAFETIMER_ENABLE_STATS && !SAFETIMER_ENABLE_TRACE
+      (void)missed;
+#endif
+    }
+    /* else: ISR modified timer state, keep ISR's value */
+#endif
+  }
+}
+
+#if SAFETIMER_ENGINE == SAFETIMER_ENGINE_WHEEL
+/**
+ * @brief Link a running timer into the bucket of its expire_time
+ *
+ * @param slot_index Active, currently unlinked slot
+ *
+ * Deadlines not after wheel_cursor (already due, e.g. catch-up re-arm) go to
+ * the first bucket the next pass walks, so they are never a turn late.
+ *
+ * @note Called inside critical section, O(1)
+ */
+STATIC void wheel_link(safetimer_pool_t *pool, slot_index_t slot_index) {
+  bsp_tick_t expire;
+  uint16_t bucket;
+  wheel_link_t first;
+
+  expire = SLOT_EXPIRE(slot_index);
+  if (safetimer_tick_diff(expire, pool->wheel_cursor) > 0) {
+    bucket = (uint16_t)(expire & WHEEL_MASK);
+  } else {
+    bucket = (uint16_t)((pool->wheel_cursor + 1U) & WHEEL_MASK);
+  }
+
+  first = pool->wheel_head[bucket];
+  pool->wheel_next[slot_index] = first;
+  pool->wheel_prev[slot_index] = WHEEL_HEAD_TAG(bucket);
+  if (first != WHEEL_NONE) {
+    pool->wheel_prev[first - 1U] = (wheel_link_t)(slot_index + 1U);
+  }
+  pool->wheel_head[bucket] = (wheel_link_t)(slot_index + 1U);
+}
+
+/**
+ * @brief Remove a timer from its bucket (no-op if not linked)
+ *
+ * @param slot_index Slot index
+ *
+ * @note Called inside critical section, O(1)
+ */
+STATIC void wheel_unlink(safetimer_pool_t *pool, slot_index_t slot_index) {
+  wheel_link_t prev;
+  wheel_link_t next;
+
+  prev = pool->wheel_prev[slot_index];
+  if (prev == WHEEL_NONE) {
+    return; /* Not linked (stopped, or collected by the current pass) */
+  }
+
+  next = pool->wheel_next[slot_index];
+  if (prev > MAX_TIMERS) {
+    pool->wheel_head[prev - MAX_TIMERS - 1U] = next; /* Was first */
+  } else {
+    pool->wheel_next[prev - 1U] = next;
+  }
+  if (next != WHEEL_NONE) {
+    pool->wheel_prev[next - 1U] = prev;
+  }
+
+  pool->wheel_next[slot_index] = WHEEL_NONE;
+  pool->wheel_prev[slot_index] = WHEEL_NONE;
+}
+
+/**
+ * @brief Move due timers of the elapsed ticks' buckets into a bitmap
+ *
+ * @param from_tick    Previous wheel cursor (its bucket was already walked)
+ * @param current_tick Tick of the current pass (new cursor)
+ * @param due          Out: bitmap of unlinked, due slots (pre-cleared)
+ *
+ * Walks buckets from_tick+1 .. current_tick, at most one full turn, one
+ * short critical section per bucket. Timers of later turns sharing a bucket
+ * stay linked. Each collected slot is re-linked (or stopped) by
+ * trigger_timer() from dispatch_slot().
+ *
+ * A jump of more than MAX_TIMERS ticks (tickless wakeup, long lag) scans
+ * the running slots instead, so the cost is bounded by the pool size, not
+ * by the elapsed ticks.
+ *
+ * @note Called outside critical section
+ */
+STATIC void wheel_collect_due(safetimer_pool_t *pool, bsp_tick_t from_tick,
+                              bsp_tick_t current_tick,
+                              safetimer_bitmap_t *due) {
+  int32_t span;
+  bsp_tick_t tick;
+  wheel_link_t node;
+  slot_index_t i;
+  uint8_t w;
+  safetimer_bitmap_t pending;
+
+  span = safetimer_tick_diff(current_tick, from_tick);
+  if (span > MAX_TIMERS) {
+    for (w = 0; w < BITMAP_WORDS; w++) {
+      POOL_ENTER_CRITICAL(pool);
+      pending = pool->active_bitmap[w];
+      POOL_EXIT_CRITICAL(pool);
+
+      while (pending != 0) {
+        i = (slot_index_t)(w * BITMAP_WORD_BITS + BITMAP_CTZ(pending));
+        pending &= (safetimer_bitmap_t)(pending - 1U);
+
+        /* Linked only: skips slots left over by a budget-stopped pass */
+        POOL_ENTER_CRITICAL(pool);
+        if (pool->wheel_prev[i] != WHEEL_NONE &&
+            safetimer_tick_diff(current_tick, SLOT_EXPIRE(i)) >= 0) {
+          wheel_unlink(pool, i);
+          BITMAP_SET(due, i);
+        }
+        POOL_EXIT_CRITICAL(pool);
+      }
+    }
+    return;
+  }
+  if (span > SAFETIMER_WHEEL_SIZE) {
+    span = SAFETIMER_WHEEL_SIZE; /* Lagged a full turn: every bucket once */
+  }
+
+  tick = from_tick;
+  while (span > 0) {
+    span--;
+    tick++;
+
+    POOL_ENTER_CRITICAL(pool);
+    node = pool->wheel_head[tick & WHEEL_MASK];
+    while (node != WHEEL_NONE) {
+      i = (slot_index_t)(node - 1U);
+      node = pool->wheel_next[i];
+
+      if (safetimer_tick_diff(current_tick, SLOT_EXPIRE(i)) >= 0) {
+        wheel_unlink(pool, i);
+        BITMAP_SET(due, i);
+      }
+    }
+    POOL_EXIT_CRITICAL(pool);
+  }
+}
+#endif /* SAFETIMER_ENGINE_WHEEL */
+
+#if SAFETIMER_ENGINE == SAFETIMER_ENGINE_HEAP
+/**
+ * @brief Store a slot at a heap position and record the back-reference
+ *
+ * @param pos Heap position (0 = root)
+ * @param slot_index Slot to store
+ *
+ * @note Called inside critical section
+ */
+STATIC void heap_place(safetimer_pool_t *pool, uint16_t pos,
+                       slot_index_t slot_index) {
+  pool->heap[pos] = slot_index;
+  pool->heap_pos[slot_index] = (slot_index_t)(pos + 1U);
+}
+
+/**
+ * @brief Move the entry at pos towards the root until its parent is earlier
+ *
+ * @param pos Heap position of the entry
+ *
+ * @note Called inside critical section
+ * @note O(log n), wrap-safe ordering via safetimer_tick_diff()
+ */
+STATIC void heap_sift_up(safetimer_pool_t *pool, uint16_t pos) {
+  slot_index_t slot_index;
+  uint16_t parent; /* C89: declare before statements */
+
+  slot_index = pool->heap[pos];
+  while (pos > 0) {
+    parent = (uint16_t)((pos - 1U) / 2U);
+    if (!HEAP_BEFORE(slot_index, pool->heap[parent])) {
+      break;
+    }
+    heap_place(pool, pos, pool->heap[parent]);
+    pos = parent;
+  }
+  heap_place(pool, pos, slot_index);
+}
+
+/**
+ * @brief Move the entry at pos away from the root until no child is earlier
+ *
+ * @param pos Heap position of the entry
+ *
+ * @note Called inside critical section
+ * @note O(log n), wrap-safe ordering via safetimer_tick_diff()
+ */
+STATIC void heap_sift_down(safetimer_pool_t *pool, uint16_t pos) {
+  slot_index_t slot_index;
+  uint16_t child; /* C89: declare before statements */
+
+  slot_index = pool->heap[pos];
+  for (;;) {
+    child = (uint16_t)(2U * pos + 1U);
+    if (child >= pool->heap_size) {
+      break;
+    }
+    if (child + 1U < pool->heap_size &&
+        HEAP_BEFORE(pool->heap[child + 1U], pool->heap[child])) {
+      child++; /* Earlier of the two children */
+    }
+    if (!HEAP_BEFORE(pool->heap[child], slot_index)) {
+      break;
+    }
+    heap_place(pool, pos, pool->heap[child]);
+    pos = child;
+  }
+  heap_place(pool, pos, slot_index);
+}
+
+/**
+ * @brief Insert a running slot or re-sift it after its expire_time changed
+ *
+ * @param slot_index Slot index (expire_time already updated)
+ *
+ * @note Called inside critical section (SCHED_ARM)
+ * @note O(log n): only the moved entry is re-sifted
+ */
+STATIC void heap_update(safetimer_pool_t *pool, slot_index_t slot_index) {
+  uint16_t pos;
+
+  if (pool->heap_pos[slot_index] == 0) {
+    pos = pool->heap_size;
+    pool->heap_size++;
+    heap_place(pool, pos, slot_index);
+    heap_sift_up(pool, pos);
+    return;
+  }
+
+  pos = (uint16_t)(pool->heap_pos[slot_index] - 1U);
+  if (pos > 0 &&
+      HEAP_BEFORE(slot_index, pool->heap[(pos - 1U) / 2U])) {
+    heap_sift_up(pool, pos); /* Moved earlier */
+  } else {
+    heap_sift_down(pool, pos); /* Moved later (or unchanged) */
+  }
+}
+
+/**
+ * @brief Remove a slot from the heap (no-op if not in the heap)
+ *
+ * @param slot_index Slot index
+ *
+ * @note Called inside critical section (SCHED_DISARM, process() pop)
+ * @note O(log n): the last entry fills the hole and is re-sifted
+ */
+STATIC void heap_remove(safetimer_pool_t *pool, slot_index_t slot_index) {
+  uint16_t pos;
+  slot_index_t last; /* C89: declare before statements */
+
+  if (pool->heap_pos[slot_index] == 0) {
+    return; /* Not running (or already popped by this pass) */
+  }
+
+  pos = (uint16_t)(pool->heap_pos[slot_index] - 1U);
+  pool->heap_pos[slot_index] = 0;
+  pool->heap_size--;
+
+  if (pos == pool->heap_size) {
+    return; /* Was the last entry */
+  }
+
+  last = pool->heap[pool->heap_size];
+  heap_place(pool, pos, last);
+  heap_update(pool, last);
+}
+#endif /* SAFETIMER_ENGINE_HEAP */
+
+/**
+ * @brief One safetimer_process() pass over a pool
+ *
+ * @param max_callbacks Stop after this many callbacks (0 = no limit)
+ * @param max_ticks     Stop once this many ticks elapsed (0 = no limit)
+ * @return 1 if the pass stopped on the budget with slots left to dispatch
+ *
+ * See safetimer_process_pool(). The budget is only checked after a callback
+ * ran, so every pass makes progress. On an early stop the cache is left
+ * STALE, the first undispatched slot is saved in pool->resume_cursor, and
+ * (wheel/heap) the already unlinked due slots are kept in pool->resume_due
+ * so the next pass dispatches them even at the same tick.
+ *
+ * @note Budget parameters are ignored unless SAFETIMER_ENABLE_PROCESS_BUDGET
+ */
+STATIC uint8_t process_pass(safetimer_pool_t *pool, uint16_t max_callbacks,
+                            uint32_t max_ticks) {
+  bsp_tick_t current_tick;
+#if !SAFETIMER_PROCESS_SNAPSHOT
+  slot_index_t i;
+  uint8_t w;                   /* C89: declare before statements */
+  bsp_tick_t scan_next_expiry; /* C89: declare before statements */
+  uint8_t scan_has_next;       /* C89: declare before statements */
+  safetimer_bitmap_t pending;  /* C89: declare before statements */
+  safetimer_bitmap_t due[BITMAP_WORDS]; /* C89: declare before statements */
+  safetimer_bitmap_t *level_due;        /* C89: declare before statements */
+  uint8_t level;                        /* C89: declare before statements */
+  uint8_t coalesce;                     /* C89: declare before statements */
+#if SAFETIMER_PRIORITY_LEVELS > 1
+  safetimer_bitmap_t level_buf[BITMAP_WORDS]; /* C89: declare first */
+#endif
+#if SAFETIMER_ENGINE == SAFETIMER_ENGINE_WHEEL
+  bsp_tick_t from_tick; /* C89: declare before statements */
+#endif
+#if SAFETIMER_ENABLE_PROCESS_BUDGET
+  safetimer_bitmap_t late;  /* C89: declare before statements */
+  safetimer_bitmap_t *word; /* C89: declare before statements */
+  uint16_t callbacks;       /* C89: declare before statements */
+  uint8_t first_w;          /* C89: declare before statements */
+  uint8_t n;                /* C89: declare before statements */
+  uint8_t spent;            /* C89: declare before statements */
+  uint8_t stopped;          /* C89: declare before statements */
+#endif
+#endif
+
+#if !SAFETIMER_ENABLE_PROCESS_BUDGET || SAFETIMER_PROCESS_SNAPSHOT
+  (void)max_callbacks;
+  (void)max_ticks;
+#endif
+
+  CRIT_API(SAFETIMER_API_PROCESS);
+
+#if ENABLE_PARAM_CHECK
+  if (pool == NULL) {
+    return 0;
+  }
+#endif
+
+  /* Recursion guard: prevent callback from calling safetimer_process() again
+   * (fixes Trap #19: Recursive Stack Overflow). On 8-bit MCUs with ~176B RAM,
+   * even 2-3 recursions can exhaust stack and cause system reset. */
+  if (pool->processing) {
+    return 0; /* Already processing, silently return to prevent recursion */
+  }
+
+  pool->processing = 1; /* Mark as processing */
+
+#if SAFETIMER_ENABLE_ISR_QUEUE
+  /* Apply timer commands queued by ISRs since the previous pass */
+  if (pool->isr_tail != pool->isr_head) {
+    isr_queue_drain(pool);
+  }
+#endif
+
+  current_tick = bsp_get_ticks();
+
+#if SAFETIMER_ENABLE_ATOMICS && SAFETIMER_ENGINE == SAFETIMER_ENGINE_BITMAP
+  /* Lock-free fast path: the cache fields are atomic, and a deadline
+   * lowered concurrently is seen by the next pass (same as a start made
+   * just after the check). Re-checked under the lock below. */
+  if (EXPIRY_CACHE_NOTHING_DUE(current_tick)) {
+    pool->processing = 0;
+    return 0;
+  }
+#endif
+
+#if SAFETIMER_PROCESS_SNAPSHOT
+  process_snapshot_pass(pool, current_tick);
+#else
+#if SAFETIMER_ENGINE == SAFETIMER_ENGINE_HEAP
+  /* Fast path: nothing can be due before the heap root */
+  POOL_ENTER_CRITICAL(pool);
+  if (!HEAP_ROOT_DUE(current_tick) && !RESUME_PENDING()) {
+    POOL_EXIT_CRITICAL(pool);
+    pool->processing = 0;
+    return 0;
+  }
+  for (w = 0; w < BITMAP_WORDS; w++) {
+    due[w] = 0;
+  }
+  while (HEAP_ROOT_DUE(current_tick)) {
+    i = pool->heap[0];
+    heap_remove(pool, i);
+    BITMAP_SET(due, i);
+    POOL_EXIT_CRITICAL(pool); /* One pop per critical section (ISR latency) */
+    POOL_ENTER_CRITICAL(pool);
+  }
+#if SAFETIMER_ENABLE_HW_COMPARE
+  hw_compare_sync(pool); /* First root not due (re-armed timers follow) */
+#endif
+  POOL_EXIT_CRITICAL(pool);
+  coalesce = 0; /* Slack windows need the bitmap engine */
+#else
+  /* Fast path: nothing can be due before the cached earliest deadline */
+  POOL_ENTER_CRITICAL(pool);
+  if (EXPIRY_CACHE_NOTHING_DUE(current_tick)) {
+#if SAFETIMER_ENGINE == SAFETIMER_ENGINE_WHEEL
+    /* Skipped buckets hold nothing due: no need to walk them later */
+    pool->wheel_cursor = current_tick;
+#endif
+    POOL_EXIT_CRITICAL(pool);
+    pool->processing = 0;
+    return 0;
+  }
+  /* Known earliest deadline reached: slack windows may join this wakeup */
+  coalesce = (uint8_t)(pool->expiry_state == EXPIRY_CACHE_VALID);
+  pool->expiry_state = EXPIRY_CACHE_SCANNING;
+#if SAFETIMER_ENGINE == SAFETIMER_ENGINE_WHEEL
+  from_tick = pool->wheel_cursor;
+  pool->wheel_cursor = current_tick;
+  POOL_EXIT_CRITICAL(pool);
+
+  /* Unlink due timers from the buckets of the elapsed ticks */
+  for (w = 0; w < BITMAP_WORDS; w++) {
+    due[w] = 0;
+  }
+  wheel_collect_due(pool, from_tick, current_tick, due);
+#else
+  for (w = 0; w < BITMAP_WORDS; w++) {
+    due[w] = pool->active_bitmap[w]; /* Visit running slots only */
+  }
+  POOL_EXIT_CRITICAL(pool);
+#if SAFETIMER_ENABLE_SLACK
+  if (!coalesce) {
+    coalesce = slack_wakeup(pool, current_tick, due); /* Cache was stale */
+  }
+#endif
+#endif
+#endif /* SAFETIMER_ENGINE_HEAP */
+
+  scan_next_expiry = 0;
+  scan_has_next = 0;
+#if SAFETIMER_PRIORITY_LEVELS > 1
+  level_due = level_buf; /* One level at a time, highest first */
+#else
+  level_due = due;
+#endif
+
+#if SAFETIMER_ENABLE_PROCESS_BUDGET
+#if SAFETIMER_ENGINE != SAFETIMER_ENGINE_BITMAP
+  /* Due timers left over by the previous (budget-stopped) pass */
+  if (pool->resume_pending) {
+    for (w = 0; w < BITMAP_WORDS; w++) {
+      due[w] |= pool->resume_due[w];
+      pool->resume_due[w] = 0;
+    }
+    pool->resume_pending = 0;
+  }
+#endif
+
+  callbacks = 0;
+  spent = 0;
+  stopped = 0;
+  first_w = 0;
+  late = 0;
+
+  for (level = SAFETIMER_PRIORITY_LEVELS; level-- > 0 && !stopped;) {
+    PRIO_TAKE_LEVEL(level, due, level_due);
+
+    /* Start at the resume cursor: slots of its word below it run last */
+    first_w = (uint8_t)(pool->resume_cursor / BITMAP_WORD_BITS);
+    late = (safetimer_bitmap_t)(
+        level_due[first_w] &
+        ((BITMAP_ONE << (pool->resume_cursor % BITMAP_WORD_BITS)) - 1U));
+    level_due[first_w] &= (safetimer_bitmap_t)~late;
+
+    w = first_w;
+    for (n = 0; n <= BITMAP_WORDS && !stopped; n++) {
+      word = (n == BITMAP_WORDS) ? &late : &level_due[w];
+      while (*word != 0) {
+        i = (slot_index_t)(w * BITMAP_WORD_BITS + BITMAP_CTZ(*word));
+#if SAFETIMER_ENGINE == SAFETIMER_ENGINE_BITMAP
+        /* Running but not due: keep scanning for the cache, no stop */
+        if (spent && !budget_slot_due(pool, i, current_tick, coalesce,
+                                      &scan_next_expiry, &scan_has_next)) {
+          *word &= (safetimer_bitmap_t)(*word - 1U);
+          continue;
+        }
+#endif
+        if (spent) {
+          stopped = 1; /* Slot i is the first one left for the next pass */
+          pool->resume_cursor = i;
+          break;
+        }
+        *word &= (safetimer_bitmap_t)(*word - 1U);
+
+        if (dispatch_slot(pool, i, current_tick, coalesce, &scan_next_expiry,
+                          &scan_has_next)) {
+          callbacks++;
+          spent = (uint8_t)((max_callbacks != 0 &&
+                             callbacks >= max_callbacks) ||
+                            (max_ticks != 0 &&
+                             (bsp_tick_t)(bsp_get_ticks() - current_tick) >=
+                                 max_ticks));
+        }
+      }
+      w = (uint8_t)((w + 1U) % BITMAP_WORDS);
+    }
+  }
+
+  if (stopped) {
+    POOL_ENTER_CRITICAL(pool);
+#if SAFETIMER_ENGINE == SAFETIMER_ENGINE_BITMAP
+    /* Undispatched timers are still running and due: only drop the cache */
+    pool->expiry_state = EXPIRY_CACHE_STALE;
+#else
+    /* Already unlinked/popped but not dispatched: carry them over */
+    level_due[first_w] |= late;
+    for (w = 0; w < BITMAP_WORDS; w++) {
+      pool->resume_due[w] = (safetimer_bitmap_t)(due[w] | level_due[w]);
+    }
+    pool->resume_pending = 1;
+#if SAFETIMER_ENGINE == SAFETIMER_ENGINE_WHEEL
+    pool->expiry_state = EXPIRY_CACHE_STALE; /* Partial pass */
+#endif
+#endif
+    HW_COMPARE_NOW(pool, current_tick); /* Next pass at once */
+    POOL_EXIT_CRITICAL(pool);
+    pool->processing = 0;
+    return 1;
+  }
+  pool->resume_cursor = 0;
+  (void)pending;
+#else
+  for (level = SAFETIMER_PRIORITY_LEVELS; level-- > 0;) {
+    PRIO_TAKE_LEVEL(level, due, level_due);
+
+    for (w = 0; w < BITMAP_WORDS; w++) {
+      pending = level_due[w];
+      while (pending != 0) {
+        /* Lowest pending slot first (same order as the former index loop) */
+        i = (slot_index_t)(w * BITMAP_WORD_BITS + BITMAP_CTZ(pending));
+        pending &= (safetimer_bitmap_t)(pending - 1U);
+
+        (void)dispatch_slot(pool, i, current_tick, coalesce,
+                            &scan_next_expiry, &scan_has_next);
+      }
+    }
+  }
+#endif /* SAFETIMER_ENABLE_PROCESS_BUDGET */
+
+#if SAFETIMER_ENGINE != SAFETIMER_ENGINE_HEAP
+  /* Publish the rebuilt cache unless a timer was modified during the scan
+   * (callback or ISR), in which case the next pass rescans. */
+  POOL_ENTER_CRITICAL(pool);
+  if (pool->expiry_state == EXPIRY_CACHE_SCANNING) {
+#if SAFETIMER_ENGINE == SAFETIMER_ENGINE_WHEEL
+    /* Only due slots were visited: the minimum is not known */
+    pool->expiry_state = EXPIRY_CACHE_IDLE;
+    for (w = 0; w < BITMAP_WORDS; w++) {
+      if (pool->active_bitmap[w] != 0) {
+        pool->expiry_state = EXPIRY_CACHE_STALE;
+        break;
+      }
+    }
+    (void)scan_next_expiry;
+    (void)scan_has_next;
+#else
+    pool->next_expiry = scan_next_expiry;
+    pool->expiry_state =
+        scan_has_next ? EXPIRY_CACHE_VALID : EXPIRY_CACHE_IDLE;
+#endif
+  }
+  HW_COMPARE_PASS_END(pool, current_tick);
+  POOL_EXIT_CRITICAL(pool);
+#endif
+#endif /* SAFETIMER_PROCESS_SNAPSHOT */
+
+  pool->processing = 0; /* Clear processing flag */
+  return 0;
+}
+
+/**
+ * @brief Check, trigger and invoke one running slot
+ *
+ * @param i                Slot index taken from the pass's due/active set
+ * @param current_tick     Tick of the current safetimer_process() pass
+ * @param coalesce         1 = the pass is a wakeup for a reached deadline:
+ *                         fire early within the slot's slack
+ * @param scan_next_expiry In/out: earliest post-trigger deadline seen
+ * @param scan_has_next    In/out: scan_next_expiry is valid
+ * @return 1 if the callback was invoked
+ *
+ * Copies slot state under a short critical section, triggers the timer if
+ * due, then re-validates (TOCTOU, generation) and calls the callback outside
+ * the critical section.
+ *
+ * @note Called outside critical section, with pool->processing set
+ */
+STATIC uint8_t dispatch_slot(safetimer_pool_t *pool, slot_index_t i,
+                             bsp_tick_t current_tick, uint8_t coalesce,
+                             bsp_tick_t *scan_next_expiry,
+                             uint8_t *scan_has_next) {
+  timer_callback_t callback; /* C89: declare before statements */
+  bsp_tick_t due_tick;       /* C89: declare before statements */
+#if SAFETIMER_ENABLE_USER_DATA
+  void *user_data; /* C89: declare before statements */
+#endif
+  int should_invoke;    /* C89: declare before statements */
+  uint8_t captured_gen; /* C89: declare before statements */
+#if !SAFETIMER_REPEAT_ONLY
+  uint8_t captured_mode; /* C89: declare before statements */
+#endif
+  int valid; /* C89: declare before statements */
+#if SAFETIMER_ENABLE_ATOMICS
+  bsp_tick_t expire; /* C89: declare before statements */
+#endif
+#if SAFETIMER_ENABLE_STATS
+  uint32_t started; /* C89: declare before statements */
+#endif
+
+  callback = NULL;
+#if SAFETIMER_ENABLE_USER_DATA
+  user_data = NULL;
+#endif
+  should_invoke = 0;
+  captured_gen = 0;
+#if !SAFETIMER_REPEAT_ONLY
+  captured_mode = 0;
+#endif
+
+  /* Latest deadline this pass fires: current_tick, or + slack on a wakeup */
+  due_tick = current_tick;
+#if SAFETIMER_ENABLE_SLACK
+  if (coalesce) {
+    due_tick = (bsp_tick_t)(current_tick + pool->slack[i]);
+  }
+#else
+  (void)coalesce;
+#endif
+
+#if SAFETIMER_ENABLE_ATOMICS
+  /*
+   * Lock-free pre-check (atomic active bit and expire_time): stopped and
+   * not-yet-due slots need no lock. A write racing with this read switches
+   * the cache from SCANNING to STALE, so a stale deadline is never
+   * published.
+   */
+  if (!SLOT_GET_ACTIVE(i)) {
+    return 0;
+  }
+  expire = SLOT_EXPIRE(i);
+  if (safetimer_tick_diff(due_tick, expire) < 0) {
+    if (!*scan_has_next || safetimer_tick_diff(expire, *scan_next_expiry) < 0) {
+      *scan_next_expiry = expire;
+      *scan_has_next = 1;
+    }
+    return 0;
+  }
+#endif
+
+  /*
+   * Copy slot state under the BSP critical section (prevents races with
+   * start/stop/delete) and only call user code after releasing the lock.
+   */
+  POOL_ENTER_CRITICAL(pool);
+
+  /* Skip timers stopped since the active_bitmap snapshot */
+  if (!SLOT_GET_ACTIVE(i)) {
+    POOL_EXIT_CRITICAL(pool);
+    return 0;
+  }
+
+  /*
+   * ADR-005: Signed Difference Comparison Algorithm (updated for
+   * 16-bit/32-bit)
+   */
+  if (safetimer_tick_diff(due_tick, SLOT_EXPIRE(i)) >= 0) {
+    /* Timer expired - capture state and trigger it */
+    captured_gen = SLOT_GET_GEN(i);
+#if !SAFETIMER_REPEAT_ONLY
+    captured_mode = SLOT_GET_MODE(i);
+#endif
+#if SAFETIMER_ENABLE_USER_DATA
+    trigger_timer(pool, i, current_tick, &callback, &user_data);
+#else
+    trigger_timer(pool, i, current_tick, &callback, NULL);
+#endif
+    should_invoke = 1;
+  }
+
+  /* Collect the post-trigger deadline for the earliest-deadline cache */
+  if (SLOT_GET_ACTIVE(i) &&
+      (!*scan_has_next ||
+       safetimer_tick_diff(SLOT_EXPIRE(i), *scan_next_expiry) < 0)) {
+    *scan_next_expiry = SLOT_EXPIRE(i);
+    *scan_has_next = 1;
+  }
+
+  POOL_EXIT_CRITICAL(pool);
+
+  /* Execute callback OUTSIDE critical section */
+  if (should_invoke && callback != NULL) {
+    /* Double-check validity to prevent TOCTOU race (fixes Trap #6)
+     * Use generation counter to detect if timer was deleted/reused.
+     * For REPEAT timers: must still be active (user didn't stop it).
+     * For ONE_SHOT timers: trigger_timer() set active=0, so only check gen.
+     */
+    POOL_ENTER_CRITICAL(pool);
+
+    valid = (SLOT_GET_GEN(i) == captured_gen);
+
+    if (valid) {
+#if !SAFETIMER_REPEAT_ONLY
+      if (captured_mode == TIMER_MODE_REPEAT) {
+        if (!SLOT_GET_ACTIVE(i)) {
+          valid = 0; /* User stopped it */
+        }
+      }
+      /* Else: ONE_SHOT, active is 0 (by us) or 1 (user restart), both valid
+       */
+#else
+      /* REPEAT ONLY: Must be active */
+      if (!SLOT_GET_ACTIVE(i)) {
+        valid = 0;
+      }
+#endif
+    }
+    POOL_EXIT_CRITICAL(pool);
+
+    if (valid) {
+#if SAFETIMER_ENABLE_CORO
+      /* Set executing handle for coroutine auto-binding */
+      pool->executing_handle = ENCODE_HANDLE(captured_gen, i);
+#endif
+#if SAFETIMER_ENABLE_STATS
+      started = STATS_NOW();
+#endif
+#if SAFETIMER_ENABLE_USER_DATA
+      callback(user_data);
+#else
+      callback();
+#endif
+      CRIT_API(SAFETIMER_API_PROCESS); /* Callback may have called APIs */
+#if SAFETIMER_ENABLE_STATS
+      stats_record_duration(pool, i, started);
+#endif
+#if SAFETIMER_ENABLE_CORO
+      pool->executing_handle = 0;
+#endif
+#if SAFETIMER_ENABLE_CATCHUP == SAFETIMER_CATCHUP_REPORT
+      pool->executing_missed = 0;
+#endif
+      return 1;
+    }
+  }
+#if SAFETIMER_ENABLE_CATCHUP == SAFETIMER_CATCHUP_REPORT
+  pool->executing_missed = 0; /* Not invoked: nothing to report */
+#endif
+  return 0;
+}
+
+#if SAFETIMER_ENABLE_PROCESS_BUDGET && !SAFETIMER_PROCESS_SNAPSHOT &&          \
+    SAFETIMER_ENGINE == SAFETIMER_ENGINE_BITMAP
+/**
+ * @brief Check a running slot left after the budget was spent
+ *
+ * @param i            Slot index taken from the pass's active set
+ * @param current_tick Tick of the current safetimer_process() pass
+ * @param coalesce     1 = fire early within the slot's slack (see
+ *                     dispatch_slot())
+ * @return 1 if slot i is due, 0 if not (its deadline is then folded into
+ *         scan_next_expiry / scan_has_next like dispatch_slot() does)
+ *
+ * The bitmap engine visits every running slot, so only a due one may stop
+ * the pass; not-yet-due slots must not mark the cache STALE.
+ *
+ * @note Called outside critical section, with pool->processing set
+ */
+STATIC uint8_t budget_slot_due(safetimer_pool_t *pool, slot_index_t i,
+                               bsp_tick_t current_tick, uint8_t coalesce,
+                               bsp_tick_t *scan_next_expiry,
+                               uint8_t *scan_has_next) {
+  bsp_tick_t due_tick; /* C89: declare before statements */
+  uint8_t is_due;      /* C89: declare before statements */
+
+  due_tick = current_tick;
+#if SAFETIMER_ENABLE_SLACK
+  if (coalesce) {
+    due_tick = (bsp_tick_t)(current_tick + pool->slack[i]);
+  }
+#else
+  (void)coalesce;
+#endif
+
+  is_due = 0;
+  POOL_ENTER_CRITICAL(pool);
+  if (SLOT_GET_ACTIVE(i)) {
+    if (safetimer_tick_diff(due_tick, SLOT_EXPIRE(i)) >= 0) {
+      is_due = 1;
+    } else if (!*scan_has_next ||
+               safetimer_tick_diff(SLOT_EXPIRE(i), *scan_next_expiry) < 0) {
+      *scan_next_expiry = SLOT_EXPIRE(i);
+      *scan_has_next = 1;
+    }
+  }
+  POOL_EXIT_CRITICAL(pool);
+  return is_due;
+}
+#endif
+
+#if SAFETIMER_PROCESS_SNAPSHOT
+/**
+ * @brief Check that a snapshot entry still refers to the same live timer
+ *
+ * @param entry Batch entry captured during collection
+ * @return 1 if slot is still allocated with the captured generation
+ *
+ * @note Generation only changes on create(), so the used bit is required to
+ *       catch a delete() that has not been followed by a reuse
+ */
+STATIC uint8_t snapshot_entry_alive(safetimer_pool_t *pool,
+                                    const dispatch_entry_t *entry) {
+  if (!SLOT_IS_USED(entry->index)) {
+    return 0;
+  }
+  return (uint8_t)(SLOT_GET_GEN(entry->index) == entry->generation);
+}
+
+/**
+ * @brief Dispatch all due timers from a single pool snapshot
+ *
+ * @param current_tick Tick of the current safetimer_process() pass
+ *
+ * Phases:
+ * 1. Collect (critical): fast-path check, copy every due slot into a stack
+ *    batch, stop ONE_SHOT timers, gather non-due deadlines for the cache
+ * 2. Compute (no lock): REPEAT catch-up math (may divide)
+ * 3. Commit (critical): per entry, verify slot + generation (+active,
+ *    +unchanged expire_time for REPEAT), write the new deadline, publish
+ *    the cache
+ * 4. Invoke (no lock): callbacks of entries that passed validation, after a
+ *    plain re-check against deletions, stops (REPEAT) and restarts made by
+ *    earlier callbacks (active bit or deadline differs from the commit)
+ *
+ * @note Called with pool->processing set, outside critical section
+ * @note Timers that do not fit in SAFETIMER_SNAPSHOT_BATCH stay due and the
+ *       cache stays STALE, so the next pass picks them up
+ * @note A ONE_SHOT timer already in the batch cannot be cancelled by
+ *       safetimer_stop() from an earlier callback (only by delete)
+ */
+STATIC void process_snapshot_pass(safetimer_pool_t *pool,
+                                  bsp_tick_t current_tick) {
+  dispatch_entry_t batch[SAFETIMER_SNAPSHOT_BATCH];
+  dispatch_entry_t *entry;
+  safetimer_bitmap_t pending;
+  safetimer_bitmap_t remaining[BITMAP_WORDS];
+  safetimer_bitmap_t *level_due;
+  uint8_t level;
+#if SAFETIMER_ENABLE_STATS
+  uint32_t started;
+#endif
+#if SAFETIMER_PRIORITY_LEVELS > 1
+  safetimer_bitmap_t level_buf[BITMAP_WORDS];
+#endif
+  bsp_tick_t scan_next_expiry;
+  bsp_tick_t due_tick;
+  uint8_t scan_has_next;
+  uint8_t batch_count;
+  uint8_t overflow;
+#if SAFETIMER_ENABLE_SLACK
+  uint8_t coalesce;
+#endif
+  slot_index_t i;
+  uint8_t n;
+
+  scan_next_expiry = 0;
+  scan_has_next = 0;
+  batch_count = 0;
+  overflow = 0;
+#if SAFETIMER_PRIORITY_LEVELS > 1
+  level_due = level_buf;
+#else
+  level_due = remaining;
+#endif
+
+  /* ---- Phase 1: collect due set ---- */
+  POOL_ENTER_CRITICAL(pool);
+
+  if (EXPIRY_CACHE_NOTHING_DUE(current_tick)) {
+    POOL_EXIT_CRITICAL(pool);
+    return;
+  }
+  pool->expiry_state = EXPIRY_CACHE_SCANNING;
+
+  remaining[0] = pool->active_bitmap[0]; /* Bitmap engine: one word */
+#if SAFETIMER_ENABLE_SLACK
+  /* Slack windows may only join a wakeup for a deadline that is reached */
+  coalesce = 0;
+  pending = (remaining[0] & pool->slack_bitmap[0]) ? remaining[0] : 0;
+  while (pending != 0 && !coalesce) {
+    i = BITMAP_CTZ(pending);
+    pending &= (safetimer_bitmap_t)(pending - 1U);
+    coalesce =
+        (uint8_t)(safetimer_tick_diff(current_tick, SLOT_EXPIRE(i)) >= 0);
+  }
+#endif
+  for (level = SAFETIMER_PRIORITY_LEVELS; level-- > 0;) {
+    PRIO_TAKE_LEVEL(level, remaining, level_due); /* Batch: highest first */
+    pending = level_due[0];
+    while (pending != 0) {
+      i = BITMAP_CTZ(pending);
+      pending &= (safetimer_bitmap_t)(pending - 1U);
+
+      due_tick = current_tick;
+#if SAFETIMER_ENABLE_SLACK
+      if (coalesce) {
+        due_tick = (bsp_tick_t)(current_tick + pool->slack[i]);
+      }
+#endif
+      if (safetimer_tick_diff(due_tick, SLOT_EXPIRE(i)) < 0) {
+        /* Not due: feeds the earliest-deadline cache */
+        if (!scan_has_next ||
+            safetimer_tick_diff(SLOT_EXPIRE(i), scan_next_expiry) < 0) {
+          scan_next_expiry = SLOT_EXPIRE(i);
+          scan_has_next = 1;
+        }
+        continue;
+      }
+
+      if (batch_count >= SAFETIMER_SNAPSHOT_BATCH) {
+        overflow = 1; /* Left due for the next pass */
+        continue;
+      }
+
+#if SAFETIMER_ENABLE_STATS
+      stats_record_expiry(pool, i, current_tick);
+#endif
+#if SAFETIMER_ENABLE_TRACE
+      trace_expiry(pool, i, current_tick);
+#endif
+      entry = &batch[batch_count++];
+      entry->index = i;
+      entry->generation = SLOT_GET_GEN(i);
+      entry->old_expire = SLOT_EXPIRE(i);
+      entry->new_expire = entry->old_expire;
+      entry->period = SLOT_PERIOD(i);
+      entry->callback = SLOT_CALLBACK(i);
+#if SAFETIMER_ENABLE_USER_DATA
+      entry->user_data = SLOT_USER_DATA(i);
+#endif
+#if SAFETIMER_ENABLE_CATCHUP == SAFETIMER_CATCHUP_REPORT
+      entry->missed = 0; /* ONE_SHOT keeps 0 */
+#endif
+#if SAFETIMER_ENABLE_FLAG_TIMERS
+      if (SLOT_GET_FLAG(i)) {
+        BITMAP_SET(pool->expired_bitmap, i); /* Callback stays NULL */
+      }
+#endif
+#if !SAFETIMER_REPEAT_ONLY
+      entry->mode = SLOT_GET_MODE(i);
+      if (entry->mode == TIMER_MODE_ONE_SHOT) {
+        SLOT_SET_ACTIVE(i, 0); /* ONE_SHOT: stop timer (as trigger_timer) */
+      }
+#endif
+    }
+  }
+
+  POOL_EXIT_CRITICAL(pool);
+
+  /* ---- Phase 2: catch-up math outside the critical section ---- */
+  for (n = 0; n < batch_count; n++) {
+    entry = &batch[n];
+#if !SAFETIMER_REPEAT_ONLY
+    if (entry->mode != TIMER_MODE_REPEAT) {
+      continue;
+    }
+#endif
+#if SAFETIMER_ENABLE_CATCHUP == SAFETIMER_CATCHUP_BURST
+    entry->new_expire = entry->old_expire + entry->period;
+#else
+#if SAFETIMER_ENABLE_STATS || SAFETIMER_ENABLE_TRACE ||                        \
+    SAFETIMER_ENABLE_CATCHUP == SAFETIMER_CATCHUP_REPORT
+    entry->new_expire = calc_skip_expire(entry->old_expire, entry->period,
+                                         current_tick, &entry->missed);
+#else
+    entry->new_expire = calc_skip_expire(entry->old_expire, entry->period,
+                                         current_tick, NULL);
+#endif
+#endif
+  }
+
+  /* ---- Phase 3: validate and commit in one batch ---- */
+  POOL_ENTER_CRITICAL(pool);
+
+  for (n = 0; n < batch_count; n++) {
+    entry = &batch[n];
+    i = entry->index;
+
+    if (!snapshot_entry_alive(pool, entry)) {
+      entry->callback = NULL; /* Deleted (and maybe reused) meanwhile */
+      continue;
+    }
+
+#if !SAFETIMER_REPEAT_ONLY
+    if (entry->mode == TIMER_MODE_REPEAT) {
+#endif
+      if (!SLOT_GET_ACTIVE(i)) {
+        entry->callback = NULL; /* Stopped/deleted meanwhile */
+        continue;
+      }
+      /* Same double verification as trigger_timer(): keep an ISR restart */
+#if SAFETIMER_ENABLE_CATCHUP == SAFETIMER_CATCHUP_REPORT
+      if (SLOT_EXPIRE(i) != entry->old_expire) {
+        entry->missed = 0; /* ISR restart: nothing was coalesced */
+      }
+#endif
+      if (SLOT_EXPIRE(i) == entry->old_expire) {
+        SLOT_SET_EXPIRE(i, entry->new_expire);
+#if SAFETIMER_ENABLE_STATS &&                                                 \
+    SAFETIMER_ENABLE_CATCHUP != SAFETIMER_CATCHUP_BURST
+        pool->stats[i].missed_count += entry->missed;
+#endif
+#if SAFETIMER_ENABLE_TRACE &&                                                 \
+    SAFETIMER_ENABLE_CATCHUP != SAFETIMER_CATCHUP_BURST
+        if (entry->missed > 0) {
+          trace_record(pool, i, SAFETIMER_TRACE_SKIP, current_tick,
+                       entry->missed);
+        }
+#endif
+      }
+#if !SAFETIMER_REPEAT_ONLY
+    }
+    /* Else: ONE_SHOT, active is 0 (by us) or 1 (user restart), both valid */
+#endif
+
+    /* Committed state, re-checked before the callback in phase 4 */
+    entry->new_expire = SLOT_EXPIRE(i);
+    entry->armed = SLOT_GET_ACTIVE(i);
+
+    if (SLOT_GET_ACTIVE(i) &&
+        (!scan_has_next ||
+         safetimer_tick_diff(SLOT_EXPIRE(i), scan_next_expiry) < 0)) {
+      scan_next_expiry = SLOT_EXPIRE(i);
+      scan_has_next = 1;
+    }
+  }
+
+  /* Publish unless modified since collection or batch overflowed */
+  if (pool->expiry_state == EXPIRY_CACHE_SCANNING) {
+    if (overflow) {
+      pool->expiry_state = EXPIRY_CACHE_STALE;
+    } else {
+      pool->next_expiry = scan_next_expiry;
+      pool->expiry_state =
+          scan_has_next ? EXPIRY_CACHE_VALID : EXPIRY_CACHE_IDLE;
+    }
+  }
+  HW_COMPARE_PASS_END(pool, current_tick);
+
+  POOL_EXIT_CRITICAL(pool);
+
+  /* ---- Phase 4: callbacks outside the critical section ---- */
+  for (n = 0; n < batch_count; n++) {
+    entry = &batch[n];
+    if (entry->callback == NULL) {
+      continue;
+    }
+
+    /* Lock-free re-check: an earlier callback in this batch may have
+     * deleted, stopped (REPEAT) or restarted this timer after the commit;
+     * a restart moves the deadline, so the old expiry must not fire */
+    if (!snapshot_entry_alive(pool, entry)) {
+      continue;
+    }
+    if (SLOT_GET_ACTIVE(entry->index) != entry->armed ||
+        SLOT_EXPIRE(entry->index) != entry->new_expire) {
+      continue;
+    }
+
+#if SAFETIMER_ENABLE_CORO
+    pool->executing_handle = ENCODE_HANDLE(entry->generation, entry->index);
+#endif
+#if SAFETIMER_ENABLE_CATCHUP == SAFETIMER_CATCHUP_REPORT
+    pool->executing_missed = entry->missed;
+#endif
+#if SAFETIMER_ENABLE_STATS
+    started = STATS_NOW();
+#endif
+#if SAFETIMER_ENABLE_USER_DATA
+    entry->callback(entry->user_data);
+#else
+    entry->callback();
+#endif
+    CRIT_API(SAFETIMER_API_PROCESS); /* Callback may have called APIs */
+#if SAFETIMER_ENABLE_STATS
+    stats_record_duration(pool, entry->index, started);
+#endif
+#if SAFETIMER_ENABLE_CORO
+    pool->executing_handle = 0;
+#endif
+#if SAFETIMER_ENABLE_CATCHUP == SAFETIMER_CATCHUP_REPORT
+    pool->executing_missed = 0;
+#endif
+  }
+}
+#endif /* SAFETIMER_PROCESS_SNAPSHOT */
+
+#if SAFETIMER_ENABLE_STATS
+/**
+ * @brief process_pass() with its duration recorded in pool_stats.max_pass
+ */
+STATIC uint8_t process_pass_timed(safetimer_pool_t *pool,
+                                  uint16_t max_callbacks, uint32_t max_ticks) {
+  uint32_t started; /* C89: declare before statements */
+  uint32_t elapsed; /* C89: declare before statements */
+  uint8_t stopped;  /* C89: declare before statements */
+
+  started = STATS_NOW();
+  stopped = process_pass(pool, max_callbacks, max_ticks);
+  elapsed = STATS_ELAPSED(started);
+
+  if (elapsed > pool->pool_stats.max_pass) {
+    pool->pool_stats.max_pass = elapsed; /* Main loop only writer */
+  }
+  return stopped;
+}
+
+/**
+ * @brief Reset the statistics of one slot
+ *
+ * @note Called inside critical section
+ */
+STATIC void stats_clear_slot(safetimer_pool_t *pool, slot_index_t slot_index) {
+  safetimer_stats_t *st = &pool->stats[slot_index];
+
+  st->fire_count = 0;
+  st->missed_count = 0;
+  st->max_duration = 0;
+  st->last_lateness = 0;
+  st->max_lateness = 0;
+}
+
+/**
+ * @brief Count an expiry and its lateness (before the deadline advances)
  *
- * @note Uses bitmap for O(n) search
- * @note Called inside critical section - keep fast!
+ * @note Called inside critical section
  */
-STATIC int find_free_slot(void) {
-  uint8_t i;
+STATIC void stats_record_expiry(safetimer_pool_t *pool,
+                                slot_index_t slot_index,
+                                bsp_tick_t current_tick) {
+  safetimer_stats_t *st = &pool->stats[slot_index];
+  bsp_tick_t lateness = (bsp_tick_t)(current_tick - SLOT_EXPIRE(slot_index));
+
+#if SAFETIMER_ENABLE_SLACK
+  if (safetimer_tick_diff(current_tick, SLOT_EXPIRE(slot_index)) < 0) {
+    lateness = 0; /* Fired early within its slack */
+  }
+#endif
+  st->fire_count++;
+  st->last_lateness = lateness;
+  if (lateness > st->max_lateness) {
+    st->max_lateness = lateness;
+  }
+}
 
-  for (i = 0; i < MAX_TIMERS; i++) {
-    if ((g_timer_pool.used_bitmap & (BITMAP_ONE << i)) == 0) {
-      return i; /* Found free slot */
-    }
+/**
+ * @brief Record the duration of a callback started at STATS_NOW() = start
+ *
+ * @note Called outside critical section (main loop is the only writer)
+ */
+STATIC void stats_record_duration(safetimer_pool_t *pool,
+                                  slot_index_t slot_index, uint32_t start) {
+  uint32_t elapsed = STATS_ELAPSED(start);
+
+  if (elapsed > pool->stats[slot_index].max_duration) {
+    pool->stats[slot_index].max_duration = elapsed;
   }
+}
+#endif /* SAFETIMER_ENABLE_STATS */
 
-  return -1; /* Pool full */
+#if SAFETIMER_STATS_CYCLES
+/**
+ * @brief Record the length of the critical section being left
+ *
+ * @note Called inside critical section, just before the unlock
+ */
+STATIC void stats_critical_done(safetimer_pool_t *pool) {
+  uint32_t elapsed = (uint32_t)(bsp_get_cycles() - pool->critical_start);
+
+  if (elapsed > pool->pool_stats.max_critical) {
+    pool->pool_stats.max_critical = elapsed;
+  }
+#if SAFETIMER_ENABLE_CRIT_PROFILE
+  crit_profile_record(g_crit_profile.api, elapsed);
+#endif
 }
+#endif
 
+#if SAFETIMER_ENABLE_CRIT_PROFILE
 /**
- * @brief Update expiration time for a timer slot
+ * @brief Make a call site the running section, registering it on first use
  *
- * @param slot_index Valid slot index (0 ~ MAX_TIMERS-1)
+ * @note Called inside critical section, O(1)
+ */
+STATIC void crit_site_enter(safetimer_crit_site_t *site) {
+  if (!site->registered) {
+    site->registered = 1;
+    site->next = g_crit_profile.sites;
+    g_crit_profile.sites = site;
+  }
+  g_crit_profile.current = site;
+}
+
+/**
+ * @brief Fold the length of the section being left into its site and group
+ *
+ * @note Called inside critical section, just before the unlock
+ */
+STATIC void crit_profile_record(uint8_t api, uint32_t elapsed) {
+  if (elapsed > g_crit_profile.current->max_cycles) {
+    g_crit_profile.current->max_cycles = elapsed;
+  }
+  if (elapsed > g_crit_profile.api_max[api]) {
+    g_crit_profile.api_max[api] = elapsed;
+  }
+}
+#endif
+
+#if SAFETIMER_ENABLE_TRACE
+/**
+ * @brief Append one event to the trace ring (overwrites the oldest record)
+ *
+ * @param slot_index Slot the event refers to (handle uses its generation)
+ * @param arg        Event argument, saturated at 255
+ *
+ * @note Called inside critical section, a no-op without a ring
+ */
+STATIC void trace_record(safetimer_pool_t *pool, slot_index_t slot_index,
+                         uint8_t event, bsp_tick_t tick, uint32_t arg) {
+  safetimer_trace_record_t *rec; /* C89: declare before statements */
+
+  if (pool->trace_buf == NULL) {
+    return;
+  }
+
+  rec = &pool->trace_buf[pool->trace_head & pool->trace_mask];
+  pool->trace_head++;
+  if (pool->trace_head == (uint16_t)((pool->trace_mask + 1U) * 2U)) {
+    pool->trace_head = (uint16_t)(pool->trace_mask + 1U); /* Stay wrapped */
+  }
+  rec->tick = tick;
+  rec->handle =
+      (uint16_t)ENCODE_HANDLE(SLOT_GET_GEN(slot_index), slot_index);
+  rec->event = event;
+  rec->arg = (uint8_t)((arg > 255U) ? 255U : arg);
+}
+
+/**
+ * @brief Record an expiry as FIRE or LATE_FIRE (before the deadline advances)
  *
- * @note Calculates: expire_time = current_tick + period
- * @note Handles 32-bit wraparound automatically
  * @note Called inside critical section
  */
-STATIC void update_expire_time(uint8_t slot_index, bsp_tick_t current_tick) {
-  /*
-   * Use the tick captured outside the SafeTimer critical section so BSP
-   * implementations remain free to mask interrupts when returning ticks.
-   *
-   * Set expiration time (32-bit wraparound handled by ADR-005 algorithm)
-   * Example: current=4294967290, period=100
-   *   → expire = 4294967390 (wraps to 94)
-   *   → safetimer_process() will correctly detect expiration
-   */
-  g_timer_pool.slots[slot_index].expire_time =
-      current_tick + g_timer_pool.slots[slot_index].period;
+STATIC void trace_expiry(safetimer_pool_t *pool, slot_index_t slot_index,
+                         bsp_tick_t current_tick) {
+  bsp_tick_t lateness = (bsp_tick_t)(current_tick - SLOT_EXPIRE(slot_index));
+
+#if SAFETIMER_ENABLE_SLACK
+  if (safetimer_tick_diff(current_tick, SLOT_EXPIRE(slot_index)) < 0) {
+    lateness = 0; /* Fired early within its slack */
+  }
+#endif
+  trace_record(pool, slot_index,
+               (lateness != 0) ? SAFETIMER_TRACE_LATE_FIRE
+                               : SAFETIMER_TRACE_FIRE,
+               current_tick, (uint32_t)lateness);
 }
+#endif /* SAFETIMER_ENABLE_TRACE */
 
+#if SAFETIMER_ENABLE_SLACK && !SAFETIMER_PROCESS_SNAPSHOT
 /**
- * @brief Trigger timer callback and handle mode
+ * @brief Check whether any running slot reached its deadline (not slack)
  *
- * @param slot_index Valid slot index (0 ~ MAX_TIMERS-1)
+ * @param running Slots to check (active_bitmap snapshot of the pass)
+ * @return 1 if the pass is a wakeup that slack windows may join
  *
- * @note For ONE_SHOT: stops timer after callback
- * @note For REPEAT: advances expire_time by period (phase-locked, eliminates
- * drift)
- * @note Calls user callback if not NULL
- * @note Called outside critical section to allow callback to run safely
+ * Only needed when the earliest-deadline cache was not valid at the start
+ * of the pass (e.g. first pass after boot or after a callback restart),
+ * and skipped when no running slot has slack.
+ *
+ * @note Called outside critical section (one short lock per slot, stops
+ *       at the first reached deadline)
  */
-STATIC void trigger_timer(uint8_t slot_index, bsp_tick_t current_tick,
-                          timer_callback_t *callback_out,
-                          void **user_data_out) {
-#if !SAFETIMER_ENABLE_CATCHUP
-  /* C89: declare all variables at block start */
-  bsp_tick_t old_expire;
-  bsp_tick_t period;
-  uint8_t old_active;
+STATIC uint8_t slack_wakeup(safetimer_pool_t *pool, bsp_tick_t current_tick,
+                            const safetimer_bitmap_t *running) {
+  safetimer_bitmap_t pending; /* C89: declare before statements */
+  slot_index_t i;             /* C89: declare before statements */
+  uint8_t reached;            /* C89: declare before statements */
+  uint8_t w;                  /* C89: declare before statements */
+
+  /* Nothing to pull in early: no running slot has slack */
+  reached = 0;
+  for (w = 0; w < BITMAP_WORDS; w++) {
+    if ((running[w] & pool->slack_bitmap[w]) != 0) {
+      reached = 1;
+    }
+  }
+  if (!reached) {
+    return 0;
+  }
+
+  for (w = 0; w < BITMAP_WORDS; w++) {
+    pending = running[w];
+    while (pending != 0) {
+      i = (slot_index_t)(w * BITMAP_WORD_BITS + BITMAP_CTZ(pending));
+      pending &= (safetimer_bitmap_t)(pending - 1U);
+
+      POOL_ENTER_CRITICAL(pool);
+      reached = (uint8_t)(SLOT_GET_ACTIVE(i) &&
+                          safetimer_tick_diff(current_tick, SLOT_EXPIRE(i)) >=
+                              0);
+      POOL_EXIT_CRITICAL(pool);
+      if (reached) {
+        return 1;
+      }
+    }
+  }
+  return 0;
+}
+#endif
+
+#if SAFETIMER_ENABLE_CATCHUP != SAFETIMER_CATCHUP_BURST
+/**
+ * @brief Next REPEAT deadline in skip mode (coalesces missed intervals)
+ *
+ * @param old_expire   Deadline that just expired
+ * @param period       Timer period (non-zero)
+ * @param current_tick Tick of the current safetimer_process() pass
+ * @param missed_out   Out: periods skipped (coalesced), may be NULL
+ *
+ * @return First phase-locked deadline strictly after current_tick
+ *
+ * @note May divide (see calc_missed_periods()): call OUTSIDE critical sections
+ */
+STATIC bsp_tick_t calc_skip_expire(bsp_tick_t old_expire, bsp_tick_t period,
+                                   bsp_tick_t current_tick,
+                                   uint32_t *missed_out) {
   int32_t lag;
-  bsp_tick_t new_expire;
   uint32_t missed_periods;
-#endif
 
-  /* Caller already holds the BSP critical section. */
+  lag = safetimer_tick_diff(current_tick, old_expire);
 
-  if (callback_out != NULL) {
-    *callback_out = g_timer_pool.slots[slot_index].callback;
+  if (lag < 0) {
+    /* Should not happen (timer not expired yet), but handle gracefully */
+    if (missed_out != NULL) {
+      *missed_out = 0;
+    }
+    return old_expire + period;
   }
 
-#if SAFETIMER_ENABLE_USER_DATA
-  if (user_data_out != NULL) {
-    *user_data_out = g_timer_pool.slots[slot_index].user_data;
+  /* We're behind schedule - advance by N periods to catch up */
+  missed_periods = calc_missed_periods((uint32_t)lag, (uint32_t)period) + 1U;
+  if (missed_out != NULL) {
+    *missed_out = missed_periods - 1U; /* Expiries never dispatched */
   }
-#endif
+  return old_expire + (bsp_tick_t)(missed_periods * (uint32_t)period);
+}
+#endif /* SAFETIMER_ENABLE_CATCHUP != SAFETIMER_CATCHUP_BURST */
 
-#if SAFETIMER_REPEAT_ONLY
-  /* FORCE REPEAT: advance until next expiration */
-  /* Remove ONE_SHOT check to save ROM */
-  {
-#else
-  if (SLOT_GET_MODE(g_timer_pool.slots[slot_index]) == TIMER_MODE_ONE_SHOT) {
-    /* ONE_SHOT: stop timer */
-    SLOT_SET_ACTIVE(g_timer_pool.slots[slot_index], 0);
+#if SAFETIMER_ENABLE_CORO_SCHED
+/**
+ * @brief Scheduler timer callback: run due tasks, re-arm for the next one
+ *
+ * @param user_data safetimer_sched_t of the scheduler
+ *
+ * A task that yielded without advancing its wake tick runs again on the
+ * next tick. Exited tasks (CORO_EXIT, _coro_lc == 0xFFFF) are skipped.
+ *
+ * @note Runs as a timer callback (outside critical section)
+ */
+STATIC void sched_timer_callback(void *user_data) {
+  safetimer_sched_t *sched;   /* C89: declare before statements */
+  safetimer_task_ctx_t *task; /* C89: declare before statements */
+  bsp_tick_t current_tick;    /* C89: declare before statements */
+  bsp_tick_t earliest;        /* C89: declare before statements */
+  uint8_t alive;              /* C89: declare before statements */
+  int32_t delay;              /* C89: declare before statements */
+  uint8_t i;                  /* C89: declare before statements */
+
+  sched = (safetimer_sched_t *)user_data;
+  current_tick = bsp_get_ticks();
+  earliest = current_tick;
+  alive = 0;
+
+  for (i = 0; i < sched->count; i++) {
+    task = (safetimer_task_ctx_t *)sched->tasks[i].ctx;
+    if (task->_coro_lc != 0xFFFF &&
+        safetimer_tick_diff(current_tick, task->_task_wake) >= 0) {
+      sched->tasks[i].fn(task);
+    }
+    if (task->_coro_lc == 0xFFFF) {
+      continue; /* Exited */
+    }
+    if (!alive || safetimer_tick_diff(task->_task_wake, earliest) < 0) {
+      earliest = task->_task_wake;
+    }
+    alive = 1;
+  }
+
+  /* Delay from the tick after the tasks ran: no drift from their run time */
+  if (alive) {
+    delay = safetimer_tick_diff(earliest, bsp_get_ticks());
+    if (delay < 1) {
+      delay = 1; /* Due again (yielded or late): next tick */
+    }
   } else {
-#endif
-    /* REPEAT: advance until the next expiration is in the future */
-    /* REPEAT: advance until the next expiration is in the future */
-#if SAFETIMER_ENABLE_CATCHUP
-    /* Catch-up mode: fire callbacks for each missed interval */
-    g_timer_pool.slots[slot_index].expire_time +=
-        g_timer_pool.slots[slot_index].period;
-#else
-    /* Skip mode (default): coalesce missed intervals using math instead of loop
-     * to prevent watchdog timeout in critical section (fixes Trap #2)
-     *
-     * CRITICAL: Division moved outside critical section to reduce interrupt
-     * latency on 8-bit MCUs without hardware divider (fixes Heavy Division
-     * risk). 32-bit division can take 50-150μs, unacceptable in critical
-     * section. */
+    delay = (int32_t)SCHED_IDLE_PERIOD; /* All tasks exited */
+  }
+  (void)safetimer_set_period_in(sched->pool, sched->timer, (uint32_t)delay);
+}
+#endif /* SAFETIMER_ENABLE_CORO_SCHED */
 
-    /* Snapshot values inside critical section */
-    old_expire = g_timer_pool.slots[slot_index].expire_time;
-    period = g_timer_pool.slots[slot_index].period;
-    old_active = SLOT_GET_ACTIVE(g_timer_pool.slots[slot_index]);
+/**
+ * @brief Whole periods elapsed in lag (lag / period)
+ *
+ * @param lag    Ticks behind schedule (>= 0)
+ * @param period Timer period (non-zero)
+ *
+ * @return floor(lag / period)
+ *
+ * With SAFETIMER_CATCHUP_SUBTRACT_LIMIT > 0 the common cases avoid the
+ * software divide routine on 8-bit MCUs:
+ * - Power-of-two period: right shift (<= 31 single-bit shifts)
+ * - Small lag: at most LIMIT subtractions
+ * Only a lag of LIMIT or more non-power-of-two periods reaches the divide.
+ *
+ * @note May divide: call OUTSIDE critical sections
+ */
+STATIC uint32_t calc_missed_periods(uint32_t lag, uint32_t period) {
+#if SAFETIMER_CATCHUP_SUBTRACT_LIMIT > 0
+  uint32_t quotient; /* C89: declare before statements */
+  uint8_t steps;     /* C89: declare before statements */
+
+  if ((period & (period - 1U)) == 0) {
+    /* Power of two: lag >> log2(period) */
+    while (period > 1U) {
+      period >>= 1;
+      lag >>= 1;
+    }
+    return lag;
+  }
 
-    /* Release critical section before expensive division */
-    bsp_exit_critical();
+  quotient = 0;
+  for (steps = 0; steps < SAFETIMER_CATCHUP_SUBTRACT_LIMIT; steps++) {
+    if (lag < period) {
+      return quotient;
+    }
+    lag -= period;
+    quotient++;
+  }
 
-    /* Calculate how many periods we're behind (OUTSIDE critical section) */
-    lag = safetimer_tick_diff(current_tick, old_expire);
+  /* Deep overrun: divide what is left */
+  return quotient + (lag / period);
+#else
+  return lag / period;
+#endif
+}
 
-    if (lag >= 0) {
-      /* We're behind schedule - advance by N periods to catch up */
-#if ENABLE_DEBUG_ASSERT
-      /* Defensive: period should never be 0 (validated in create/set_period) */
-      if (period == 0) {
-        bsp_enter_critical(); /* Restore critical section state */
-        return;               /* Avoid divide-by-zero, fail safe */
-      }
+/**
+ * @brief Fold a new or earlier deadline into the earliest-deadline cache
+ *
+ * @param expire_time Deadline of a timer that was just armed or moved earlier
+ *
+ * @note Called inside critical section
+ * @note O(1): one compare, never rescans the pool
+ * @note No-op with the heap engine (the heap root is the cache)
+ */
+STATIC void expiry_cache_lower(safetimer_pool_t *pool,
+                               bsp_tick_t expire_time) {
+#if SAFETIMER_ENABLE_HW_COMPARE && SAFETIMER_ENGINE != SAFETIMER_ENGINE_HEAP
+  /* Earlier than the programmed compare (any cache state): move it now */
+  if (!pool->hw_armed ||
+      safetimer_tick_diff(expire_time, pool->hw_compare) < 0) {
+    hw_compare_arm(pool, expire_time);
+  }
 #endif
-      missed_periods = ((uint32_t)lag / (uint32_t)period) + 1U;
-      new_expire = old_expire + (bsp_tick_t)(missed_periods * (uint32_t)period);
-    } else {
-      /* Should not happen (timer not expired yet), but handle gracefully */
-      new_expire = old_expire + period;
+#if SAFETIMER_ENGINE == SAFETIMER_ENGINE_HEAP
+  (void)pool;
+  (void)expire_time;
+#else
+  if (pool->expiry_state == EXPIRY_CACHE_IDLE) {
+    pool->next_expiry = expire_time;
+    pool->expiry_state = EXPIRY_CACHE_VALID;
+  } else if (pool->expiry_state == EXPIRY_CACHE_VALID) {
+    if (safetimer_tick_diff(expire_time, pool->next_expiry) < 0) {
+      pool->next_expiry = expire_time;
     }
+  } else if (pool->expiry_state == EXPIRY_CACHE_SCANNING) {
+    /* Scan in progress may already have passed this slot */
+    pool->expiry_state = EXPIRY_CACHE_STALE;
+  }
+  /* STALE: next safetimer_process() pass rebuilds the cache */
+#endif
+}
 
-    /* Re-enter critical section to update expire_time */
-    bsp_enter_critical();
-
-    /* Verify expire_time AND active state weren't modified by ISR during
-     * calculation (fixes Stop-Start Overwrite Race + ABA variant).
-     *
-     * Double verification prevents extreme coincidence where ISR stop+start
-     * results in same expire_time value (ABA variant). Checking both
-     * expire_time and active ensures we detect any ISR interference. */
-    if (g_timer_pool.slots[slot_index].expire_time == old_expire &&
-        SLOT_GET_ACTIVE(g_timer_pool.slots[slot_index]) == old_active) {
-      g_timer_pool.slots[slot_index].expire_time = new_expire;
-    }
-    /* else: ISR modified timer state, keep ISR's value */
+/**
+ * @brief Account for a deadline that was removed or postponed
+ *
+ * @param old_expire_time Previous deadline of a timer being stopped, deleted
+ *                        or rescheduled
+ *
+ * @note Called inside critical section
+ * @note Only invalidates when the earliest deadline itself goes away, so
+ *       the cache stays exact without scanning inside the critical section
+ * @note No-op with the heap engine (the heap root is the cache)
+ */
+STATIC void expiry_cache_raise(safetimer_pool_t *pool,
+                               bsp_tick_t old_expire_time) {
+#if SAFETIMER_ENGINE == SAFETIMER_ENGINE_HEAP
+  (void)pool;
+  (void)old_expire_time;
+#else
+  if ((pool->expiry_state == EXPIRY_CACHE_VALID &&
+       old_expire_time == pool->next_expiry) ||
+      pool->expiry_state == EXPIRY_CACHE_SCANNING) {
+    pool->expiry_state = EXPIRY_CACHE_STALE;
+  }
 #endif
+}
+
+#if SAFETIMER_ENABLE_HW_COMPARE
+/**
+ * @brief Program the hardware compare (no-op if already programmed)
+ *
+ * @param deadline Absolute tick for bsp_set_compare()
+ *
+ * @note Called inside critical section
+ */
+STATIC void hw_compare_arm(safetimer_pool_t *pool, bsp_tick_t deadline) {
+  if (!pool->hw_armed || pool->hw_compare != deadline) {
+    pool->hw_compare = deadline;
+    pool->hw_armed = 1;
+    bsp_set_compare(deadline);
+  }
+}
+
+/**
+ * @brief Follow the earliest known deadline with the hardware compare
+ *
+ * Heap engine: the compare tracks the heap root. Bitmap engine: called
+ * where the cache is published, so a VALID cache always equals the
+ * compare and an IDLE cache leaves it disarmed. A STALE cache keeps the
+ * compare at or before every running deadline; the pass it triggers
+ * rebuilds the cache.
+ *
+ * @note Called inside critical section
+ */
+STATIC void hw_compare_sync(safetimer_pool_t *pool) {
+#if SAFETIMER_ENGINE == SAFETIMER_ENGINE_HEAP
+  if (pool->heap_size == 0) {
+    pool->hw_armed = 0; /* Nothing running: a pending match is harmless */
+  } else {
+    hw_compare_arm(pool, SLOT_EXPIRE(pool->heap[0]));
+  }
+#else
+  if (pool->expiry_state == EXPIRY_CACHE_VALID) {
+    hw_compare_arm(pool, pool->next_expiry);
+  } else if (pool->expiry_state == EXPIRY_CACHE_IDLE) {
+    pool->hw_armed = 0; /* Nothing running: a pending match is harmless */
   }
+#endif
 }
+#endif /* SAFETIMER_ENABLE_HW_COMPARE */
@@ -0,0 +1,210 @@
+/**
+ * @file    bench_safetimer.c
+ * @brief   Host benchmark of safetimer_process() and the timer lifecycle
+ * @version 1.0.0
+ * @date    2026-10-14
+ *
+ * Built against the Mock BSP, one binary per configuration (see
+ * run_bench.sh for the configuration sweep). Reports, per scenario:
+ *   ns/op    wall-clock time per operation (CLOCK_MONOTONIC)
+ *   cyc/op   TSC cycles per operation (x86 only, 0 elsewhere)
+ *   crit/op  bsp_enter_critical() calls per operation
+ *   tick/op  bsp_get_ticks() calls per operation
+ *
+ * Scenarios:
+ *   create / start / delete   one call, timed over the whole pool
+ *   process_idle       MAX_TIMERS running timers, none due (1 tick/pass)
+ *   process_all_due    MAX_TIMERS REPEAT timers of period 1 (1 tick/pass)
+ *   process_late       same, 10 ticks/pass (skip-mode coalescing or
+ *                      catch-up, depending on SAFETIMER_ENABLE_CATCHUP)
+ *
+ * @note Host numbers only compare configurations and releases; they do
+ *       not predict the cost on an 8-bit target
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include "mock_bsp.h"
+#include "safetimer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define BENCH_CYCLES() __builtin_ia32_rdtsc()
+#else
+#define BENCH_CYCLES() 0ULL
+#endif
+
+#ifndef BENCH_PASSES
+#define BENCH_PASSES 20000UL /* process() passes per scenario */
+#endif
+
+#ifndef BENCH_ROUNDS
+#define BENCH_ROUNDS 2000UL /* create/start/delete rounds (x MAX_TIMERS) */
+#endif
+
+/* Idle period: beyond BENCH_PASSES ticks and below half the 16-bit range */
+#define BENCH_IDLE_PERIOD 30000UL
+
+/* ========== Measurement ========== */
+
+typedef struct {
+  struct timespec t0;
+  unsigned long long c0;
+  mock_bsp_stats_t s0;
+} bench_sample_t;
+
+/* Totals over one or more samples of the same scenario */
+typedef struct {
+  double ns;
+  unsigned long long cycles;
+  unsigned long critical;
+  unsigned long ticks;
+  unsigned long ops;
+} bench_total_t;
+
+static safetimer_pool_t g_bench_pool;
+static volatile unsigned long g_bench_fired = 0;
+
+#if SAFETIMER_ENABLE_USER_DATA
+static void bench_callback(void *user_data) {
+  (void)user_data;
+  g_bench_fired++;
+}
+#define BENCH_CREATE(period, mode)                                             \
+  safetimer_create_in(&g_bench_pool, (period), (mode), bench_callback, NULL)
+#else
+static void bench_callback(void) { g_bench_fired++; }
+#define BENCH_CREATE(period, mode)                                             \
+  safetimer_create_in(&g_bench_pool, (period), (mode), bench_callback)
+#endif
+
+static void bench_begin(bench_sample_t *sample) {
+  mock_bsp_get_stats(&sample->s0);
+  clock_gettime(CLOCK_MONOTONIC, &sample->t0);
+  sample->c0 = BENCH_CYCLES();
+}
+
+static void bench_end(const bench_sample_t *sample, bench_total_t *total,
+                      unsigned long ops) {
+  unsigned long long c1 = BENCH_CYCLES();
+  struct timespec t1;
+  mock_bsp_stats_t s1;
+
+  clock_gettime(CLOCK_MONOTONIC, &t1);
+  mock_bsp_get_stats(&s1);
+
+  total->ns += (double)(t1.tv_sec - sample->t0.tv_sec) * 1e9 +
+               (double)(t1.tv_nsec - sample->t0.tv_nsec);
+  total->cycles += c1 - sample->c0;
+  total->critical +=
+      s1.enter_critical_count - sample->s0.enter_critical_count;
+  total->ticks += s1.get_ticks_count - sample->s0.get_ticks_count;
+  total->ops += ops;
+}
+
+static void bench_report(const char *scenario, const bench_total_t *total) {
+  double ops = (double)total->ops;
+
+  printf("  %-16s %10.1f %10.1f %8.2f %8.2f\n", scenario, total->ns / ops,
+         (double)total->cycles / ops, (double)total->critical / ops,
+         (double)total->ticks / ops);
+}
+
+static void bench_reset(void) {
+  mock_bsp_reset();
+  safetimer_pool_init(&g_bench_pool);
+}
+
+/* Fill the pool with started timers */
+static void bench_fill(uint32_t period, timer_mode_t mode) {
+  safetimer_handle_t h;
+  int i;
+
+  for (i = 0; i < MAX_TIMERS; i++) {
+    h = BENCH_CREATE(period, mode);
+    if (h == SAFETIMER_INVALID_HANDLE ||
+        safetimer_start_in(&g_bench_pool, h) != TIMER_OK) {
+      fprintf(stderr, "bench: cannot fill the pool\n");
+      exit(1);
+    }
+  }
+}
+
+/* ========== Scenarios ========== */
+
+static void bench_lifecycle(void) {
+  safetimer_handle_t handles[MAX_TIMERS];
+  bench_total_t create = {0}, start = {0}, del = {0};
+  bench_sample_t sample;
+  unsigned long round;
+  int i;
+
+  bench_reset();
+
+  /* Each phase timed separately over the whole pool, summed over rounds */
+  for (round = 0; round < BENCH_ROUNDS; round++) {
+    bench_begin(&sample);
+    for (i = 0; i < MAX_TIMERS; i++) {
+      handles[i] = BENCH_CREATE(100, TIMER_MODE_REPEAT);
+    }
+    bench_end(&sample, &create, MAX_TIMERS);
+
+    bench_begin(&sample);
+    for (i = 0; i < MAX_TIMERS; i++) {
+      (void)safetimer_start_in(&g_bench_pool, handles[i]);
+    }
+    bench_end(&sample, &start, MAX_TIMERS);
+
+    bench_begin(&sample);
+    for (i = 0; i < MAX_TIMERS; i++) {
+      (void)safetimer_delete_in(&g_bench_pool, handles[i]);
+    }
+    bench_end(&sample, &del, MAX_TIMERS);
+  }
+
+  bench_report("create", &create);
+  bench_report("start", &start);
+  bench_report("delete", &del);
+}
+
+static void bench_process(const char *scenario, uint32_t period,
+                          bsp_tick_t step) {
+  bench_total_t total = {0};
+  bench_sample_t sample;
+  unsigned long pass;
+
+  bench_reset();
+  bench_fill(period, TIMER_MODE_REPEAT);
+  g_bench_fired = 0;
+
+  bench_begin(&sample);
+  for (pass = 0; pass < BENCH_PASSES; pass++) {
+    mock_bsp_advance_time(step);
+    safetimer_process_pool(&g_bench_pool);
+  }
+  bench_end(&sample, &total, BENCH_PASSES);
+  bench_report(scenario, &total);
+}
+
+/* ========== Main ========== */
+
+int main(void) {
+  printf("# MAX_TIMERS=%d BSP_TICK_TYPE_16BIT=%d USE_BITFIELD_META=%d "
+         "SAFETIMER_ENABLE_CATCHUP=%d SAFETIMER_ENGINE=%d "
+         "sizeof(pool)=%lu\n",
+         MAX_TIMERS, BSP_TICK_TYPE_16BIT, USE_BITFIELD_META,
+         SAFETIMER_ENABLE_CATCHUP, SAFETIMER_ENGINE,
+         (unsigned long)sizeof(safetimer_pool_t));
+  printf("# %-16s %10s %10s %8s %8s\n", "scenario", "ns/op", "cyc/op",
+         "crit/op", "tick/op");
+
+  bench_lifecycle();
+  bench_process("process_idle", BENCH_IDLE_PERIOD, 1);
+  bench_process("process_all_due", 1, 1);
+  bench_process("process_late", 1, 10);
+
+  /* Keeps the callback from being optimized away */
+  return (g_bench_fired == 0) ? 1 : 0;
+}
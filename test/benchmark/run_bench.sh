@@ -0,0 +1,45 @@
+#!/bin/sh
+# SafeTimer host benchmark sweep
+#
+# Builds bench_safetimer.c against the Mock BSP once per configuration and
+# prints one table per build. Extra arguments are passed to every build,
+# e.g. to compare engines or to pin a release baseline:
+#
+#   ./run_bench.sh                          # default sweep
+#   ./run_bench.sh -DSAFETIMER_ENGINE=1     # same sweep, wheel engine
+#   ./run_bench.sh > v1.2.6.txt             # save, diff against next release
+#
+# Environment: CC (default gcc), CFLAGS (default -O2)
+
+cd "$(dirname "$0")" || exit 1
+
+CC=${CC:-gcc}
+CFLAGS=${CFLAGS:--O2}
+BIN=${TMPDIR:-/tmp}/safetimer_bench.$$
+SRCS="bench_safetimer.c ../mocks/mock_bsp.c ../../src/safetimer.c"
+status=0
+
+trap 'rm -f "$BIN"' EXIT
+
+for timers in 4 8 16 32; do
+  for tick16 in 1 0; do
+    for bitfield in 1 0; do
+      for catchup in 0 1 2; do
+        cfg="-DMAX_TIMERS=$timers -DBSP_TICK_TYPE_16BIT=$tick16"
+        cfg="$cfg -DUSE_BITFIELD_META=$bitfield"
+        cfg="$cfg -DSAFETIMER_ENABLE_CATCHUP=$catchup"
+        # shellcheck disable=SC2086
+        if ! $CC -std=c99 $CFLAGS $cfg "$@" -I../../include -I../mocks \
+            $SRCS -o "$BIN"; then
+          echo "# BUILD FAILED: $cfg $*"
+          status=1
+          continue
+        fi
+        "$BIN" || status=1
+        echo
+      done
+    done
+  done
+done
+
+exit $status
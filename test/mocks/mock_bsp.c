@@ -6,6 +6,7 @@
  */
 
 #include "mock_bsp.h"
+#include "safetimer.h" /* mock_bsp_fast_forward() drives the default pool */
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -15,6 +16,17 @@ static bsp_tick_t       s_mock_ticks = 0;
 static int              s_critical_nesting = 0;
 static int              s_validation_enabled = 1;
 static mock_bsp_stats_t s_stats = {0};
+#if SAFETIMER_STATS_CYCLES
+static uint32_t         s_mock_cycles = 0;
+static uint32_t         s_mock_cycle_step = 0;
+#endif
+#if SAFETIMER_BSP_TICKLESS
+static uint32_t         s_mock_wakeup = 0;
+#endif
+#if SAFETIMER_ENABLE_HW_COMPARE
+static bsp_tick_t       s_mock_compare = 0;
+static unsigned long    s_mock_compare_count = 0;
+#endif
 
 /* ========== BSP Interface Implementation ========== */
 
@@ -51,11 +63,47 @@ void bsp_exit_critical(void)
     }
 }
 
+#if SAFETIMER_STATS_CYCLES
+uint32_t bsp_get_cycles(void)
+{
+    uint32_t cycles = s_mock_cycles;
+
+    s_mock_cycles += s_mock_cycle_step;
+    return cycles;
+}
+#endif
+
+#if SAFETIMER_BSP_TICKLESS
+void bsp_set_wakeup(uint32_t ticks)
+{
+    s_mock_wakeup = ticks;
+}
+#endif
+
+#if SAFETIMER_ENABLE_HW_COMPARE
+void bsp_set_compare(bsp_tick_t deadline)
+{
+    s_mock_compare = deadline;
+    s_mock_compare_count++;
+}
+#endif
+
 /* ========== Mock Control Functions ========== */
 
 void mock_bsp_reset(void)
 {
     s_mock_ticks = 0;
+#if SAFETIMER_STATS_CYCLES
+    s_mock_cycles = 0;
+    s_mock_cycle_step = 0;
+#endif
+#if SAFETIMER_BSP_TICKLESS
+    s_mock_wakeup = 0;
+#endif
+#if SAFETIMER_ENABLE_HW_COMPARE
+    s_mock_compare = 0;
+    s_mock_compare_count = 0;
+#endif
     s_critical_nesting = 0;
     s_validation_enabled = 1;
     s_stats.get_ticks_count = 0;
@@ -73,6 +121,70 @@ void mock_bsp_advance_time(bsp_tick_t ms)
     s_mock_ticks += ms;
 }
 
+unsigned long mock_bsp_fast_forward(uint32_t ticks)
+{
+    unsigned long passes = 0;
+    uint32_t next;
+
+    /* Work already due at the start instant */
+    if (safetimer_get_next_expiry() == 0U)
+    {
+        safetimer_process();
+        passes++;
+    }
+
+    while (ticks > 0U)
+    {
+        next = safetimer_get_next_expiry();
+        if (next == 0U)
+        {
+            next = 1U; /* Pass left a timer due: retry on the next tick */
+        }
+        if (next > ticks)
+        {
+            next = ticks; /* Also covers SAFETIMER_NO_EXPIRY */
+        }
+
+        s_mock_ticks += (bsp_tick_t)next;
+        ticks -= next;
+        safetimer_process();
+        passes++;
+    }
+
+    return passes;
+}
+
+#if SAFETIMER_STATS_CYCLES
+void mock_bsp_advance_cycles(uint32_t cycles)
+{
+    s_mock_cycles += cycles;
+}
+
+void mock_bsp_set_cycle_step(uint32_t step)
+{
+    s_mock_cycle_step = step;
+}
+#endif
+
+#if SAFETIMER_BSP_TICKLESS
+uint32_t mock_bsp_get_wakeup(void)
+{
+    return s_mock_wakeup;
+}
+#endif
+
+#if SAFETIMER_ENABLE_HW_COMPARE
+bsp_tick_t mock_bsp_get_compare(void)
+{
+    return s_mock_compare;
+}
+
+unsigned long mock_bsp_get_compare_count(void)
+{
+    return s_mock_compare_count;
+}
+#endif
+
 bsp_tick_t mock_bsp_get_current_ticks(void)
 {
     return s_mock_ticks;
@@ -51,6 +51,29 @@ void mock_bsp_set_ticks(bsp_tick_t ticks);
  */
 void mock_bsp_advance_time(bsp_tick_t ms);
 
+/**
+ * @brief Fast-forward the virtual clock through the default pool's deadlines
+ *
+ * Jumps straight to each deadline reported by safetimer_get_next_expiry()
+ * and calls safetimer_process() only there, then once at the end tick.
+ * Idle stretches cost one pass, so weeks of uptime (and any number of
+ * 16/32-bit wraparounds) run in milliseconds.
+ *
+ * @param ticks Ticks to advance (may exceed the bsp_tick_t range)
+ *
+ * @return Number of safetimer_process() calls made
+ *
+ * @note A timer still due after a pass is retried one tick later
+ * @note Only drives the default pool (safetimer_*_in() pools are not polled)
+ *
+ * @code
+ * h = safetimer_create(1000, TIMER_MODE_REPEAT, cb, NULL);
+ * safetimer_start(h);
+ * mock_bsp_fast_forward(7UL * 24UL * 3600UL * 1000UL);  // One week
+ * @endcode
+ */
+unsigned long mock_bsp_fast_forward(uint32_t ticks);
+
 /**
  * @brief Get current mock tick value
  *
@@ -80,6 +103,55 @@ int mock_bsp_get_critical_nesting(void);
  */
 void mock_bsp_enable_validation(int enable);
 
+#if SAFETIMER_STATS_CYCLES
+/**
+ * @brief Advance the mock cycle counter (bsp_get_cycles())
+ *
+ * @param cycles Cycles to add (wraps at 2^32)
+ *
+ * @note Only with SAFETIMER_STATS_CYCLES=1; reset by mock_bsp_reset()
+ */
+void mock_bsp_advance_cycles(uint32_t cycles);
+
+/**
+ * @brief Advance the mock cycle counter on every bsp_get_cycles() read
+ *
+ * @param step Cycles added after each read (0 = counter only moves with
+ *             mock_bsp_advance_cycles())
+ *
+ * @note With step s, a critical section with no read in between measures
+ *       exactly s cycles; reset to 0 by mock_bsp_reset()
+ */
+void mock_bsp_set_cycle_step(uint32_t step);
+#endif
+
+#if SAFETIMER_BSP_TICKLESS
+/**
+ * @brief Get the last value passed to bsp_set_wakeup()
+ *
+ * @return Programmed ticks, 0 if not called since the last reset
+ *
+ * @note Only with SAFETIMER_BSP_TICKLESS=1; reset by mock_bsp_reset()
+ */
+uint32_t mock_bsp_get_wakeup(void);
+#endif
+
+#if SAFETIMER_ENABLE_HW_COMPARE
+/**
+ * @brief Get the last deadline passed to bsp_set_compare()
+ *
+ * @return Programmed absolute tick (0 if not called since the last reset)
+ *
+ * @note Only with SAFETIMER_ENABLE_HW_COMPARE=1; reset by mock_bsp_reset()
+ */
+bsp_tick_t mock_bsp_get_compare(void);
+
+/**
+ * @brief Get the number of bsp_set_compare() calls since the last reset
+ */
+unsigned long mock_bsp_get_compare_count(void);
+#endif
+
 /* ========== Mock Statistics ========== */
 
 /**
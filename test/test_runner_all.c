@@ -9,6 +9,11 @@
 #include "safetimer.h"
 #include "mock_bsp.h"
 
+/* The suites fill up to 4 runtime slots next to the static table */
+#if SAFETIMER_RUNTIME_TIMERS < 4
+#error "Tests need SAFETIMER_RUNTIME_TIMERS >= 4: raise MAX_TIMERS"
+#endif
+
 /* ========== Test Helpers ========== */
 
 #ifdef UNIT_TEST
@@ -53,6 +58,7 @@ extern void test_timer_does_not_expire_before_period(void);
 extern void test_timer_expires_after_period(void);
 extern void test_repeat_timer_continues_after_expiration(void);
 extern void test_timer_handles_32bit_wraparound(void);
+extern void test_process_visits_only_active_slots(void);
 
 /* From test_safetimer_callbacks.c */
 extern void test_oneshot_callback_called_once(void);
@@ -100,6 +106,8 @@ extern void test_create_started_multiple_timers(void);
 extern void test_create_started_batch_success(void);
 extern void test_create_started_batch_partial_failure(void);
 extern void test_create_started_batch_null_checks(void);
+extern void test_create_batch_phase_locked(void);
+extern void test_create_batch_offsets(void);
 extern void test_macro_create_started_or_success(void);
 extern void test_macro_create_started_or_failure(void);
 
@@ -113,6 +121,201 @@ extern void test_advance_period_delayed_execution(void);
 extern void test_advance_period_overflow_wraparound(void);
 extern void test_advance_period_regression_existing_timers(void);
 
+/* From test_safetimer_expiry_cache.c */
+extern void test_expiry_cache_idle_pass_skips_scan(void);
+extern void test_expiry_cache_start_lowers_deadline(void);
+extern void test_expiry_cache_stop_earliest_rescans(void);
+extern void test_expiry_cache_follows_set_period(void);
+
+/* From test_safetimer_next_expiry.c */
+extern void test_next_expiry_no_active_timers(void);
+extern void test_next_expiry_returns_soonest(void);
+extern void test_next_expiry_overdue_returns_zero(void);
+extern void test_next_expiry_across_wraparound(void);
+extern void test_next_expiry_uses_cache(void);
+
+/* Snapshot Dispatch Tests (test_safetimer_snapshot.c) */
+extern void test_snapshot_dispatches_all_due(void);
+extern void test_snapshot_skips_timer_deleted_by_earlier_callback(void);
+extern void test_snapshot_skips_timer_restarted_by_earlier_callback(void);
+extern void test_snapshot_batch_overflow_defers(void);
+
+/* Catch-up Math Tests (test_safetimer_catchup_math.c) */
+extern void test_catchup_missed_periods_matches_division(void);
+extern void test_catchup_skip_power_of_two_period(void);
+extern void test_catchup_advance_period_deep_lag(void);
+
+/* Timing Wheel Tests (test_safetimer_wheel.c) */
+extern void test_wheel_far_deadline_waits_full_turns(void);
+extern void test_wheel_pass_cost_independent_of_pool(void);
+extern void test_wheel_restart_relinks_timer(void);
+extern void test_wheel_lagging_pass_catches_up(void);
+extern void test_wheel_delete_from_callback(void);
+extern void test_wheel_full_pool_handles(void);
+
+/* Min-Heap Engine Tests (test_safetimer_heap.c) */
+extern void test_heap_fires_in_deadline_order(void);
+extern void test_heap_period_changes_reorder(void);
+extern void test_heap_remove_middle_keeps_order(void);
+extern void test_heap_order_across_wraparound(void);
+extern void test_heap_next_expiry_full_pool(void);
+
+/* Multiple Pool Tests (test_safetimer_pool.c) */
+extern void test_pool_handles_are_per_pool(void);
+extern void test_pool_process_is_per_pool(void);
+extern void test_pool_recursion_guard_is_per_pool(void);
+#if SAFETIMER_ENABLE_POOL_LOCK
+extern void test_pool_lock_hooks_replace_bsp(void);
+#endif
+
+/* Process Budget Tests (test_safetimer_budget.c) */
+#if SAFETIMER_ENABLE_PROCESS_BUDGET
+extern void test_budget_callback_limit(void);
+extern void test_budget_resume_no_starvation(void);
+extern void test_budget_tick_limit(void);
+extern void test_budget_leftovers_same_tick(void);
+extern void test_budget_spent_only_future_left(void);
+#endif
+
+/* ISR Command Queue Tests (test_safetimer_isr_queue.c) */
+#if SAFETIMER_ENABLE_ISR_QUEUE
+extern void test_isr_queue_start_uses_isr_tick(void);
+extern void test_isr_queue_full_ring(void);
+extern void test_isr_queue_applies_in_order(void);
+extern void test_isr_queue_drops_stale_handle(void);
+#endif
+
+/* Atomics Tests (test_safetimer_atomics.c) */
+#if SAFETIMER_ENABLE_ATOMICS
+extern void test_atomics_only_due_slots_lock(void);
+extern void test_atomics_cache_follows_writers(void);
+#endif
+
+/* ISR Dispatch Tests (test_safetimer_isr_dispatch.c) */
+#if SAFETIMER_ENABLE_ISR_DISPATCH
+extern void test_isr_dispatch_idle_without_detect(void);
+extern void test_isr_dispatch_fires_on_deadline(void);
+extern void test_isr_dispatch_repeat_period(void);
+#if SAFETIMER_ENABLE_ISR_QUEUE
+extern void test_isr_dispatch_queue_sets_ready(void);
+#endif
+#endif
+
+/* Priority Tests (test_safetimer_priority.c) */
+#if SAFETIMER_PRIORITY_LEVELS > 1
+extern void test_priority_dispatch_order(void);
+extern void test_priority_invalid_and_reset(void);
+#if SAFETIMER_ENABLE_PROCESS_BUDGET
+extern void test_priority_with_budget(void);
+#endif
+#endif
+
+/* Statistics Tests (test_safetimer_stats.c) */
+#if SAFETIMER_ENABLE_STATS
+extern void test_stats_lateness_and_missed(void);
+extern void test_stats_callback_duration(void);
+extern void test_stats_reset_rules(void);
+#endif
+
+/* Event Trace Tests (test_safetimer_trace.c) */
+#if SAFETIMER_ENABLE_TRACE
+extern void test_trace_event_sequence(void);
+extern void test_trace_late_fire_and_skip(void);
+extern void test_trace_ring_overwrite(void);
+extern void test_trace_count_past_16_bits(void);
+extern void test_trace_attach_rules(void);
+#endif
+
+/* Slack Tests (test_safetimer_slack.c) */
+#if SAFETIMER_ENABLE_SLACK
+extern void test_slack_coalesces_into_wakeup(void);
+extern void test_slack_outside_window(void);
+extern void test_slack_repeat_phase_locked(void);
+extern void test_slack_rules(void);
+#endif
+
+/* Trigger Tests (test_safetimer_trigger.c) */
+extern void test_trigger_fires_running_timer(void);
+extern void test_trigger_starts_stopped_timer(void);
+extern void test_trigger_invalid_handle(void);
+#if SAFETIMER_ENABLE_ISR_QUEUE
+extern void test_trigger_from_isr(void);
+#endif
+#if SAFETIMER_ENABLE_SEM_WAKE
+extern void test_sem_wake_resumes_waiter(void);
+extern void test_sem_wake_timeout(void);
+extern void test_sem_wake_forever(void);
+extern void test_sem_wake_deleted_waiter(void);
+#if SAFETIMER_ENABLE_ISR_QUEUE
+extern void test_sem_wake_from_isr(void);
+#endif
+#endif
+
+/* Task Scheduler Tests (test_safetimer_sched.c) */
+#if SAFETIMER_ENABLE_CORO_SCHED
+extern void test_sched_tasks_share_one_slot(void);
+extern void test_sched_wait_phase_locked_when_late(void);
+extern void test_sched_exited_tasks(void);
+extern void test_sched_start_rules(void);
+#endif
+
+/* Tickless BSP Tests (test_safetimer_tickless.c) */
+#if SAFETIMER_BSP_TICKLESS
+extern void test_tickless_arm_programs_next_deadline(void);
+extern void test_tickless_arm_due_programs_nothing(void);
+extern void test_tickless_large_jump_one_pass(void);
+#endif
+
+/* Tick Unit Tests (test_safetimer_tick_unit.c) */
+extern void test_tick_unit_conversion_rounds_up(void);
+extern void test_tick_unit_period_limit(void);
+extern void test_tick_unit_sub_ms_period(void);
+#if SAFETIMER_ENABLE_HW_COMPARE
+extern void test_hw_compare_tracks_earliest(void);
+extern void test_hw_compare_stale_deadline(void);
+extern void test_hw_compare_trigger_and_idle(void);
+#endif
+
+/* Static Timer Table Tests (test_safetimer_static.c) */
+#if SAFETIMER_STATIC_TIMERS > 0
+extern void test_static_timers_run_from_reset(void);
+extern void test_static_timers_are_fixed(void);
+extern void test_static_slots_reserved(void);
+#endif
+
+/* Soak Tests (test_safetimer_soak.c) */
+extern void test_soak_week_repeat_exact_counts(void);
+extern void test_soak_wraparound_exact_ticks(void);
+extern void test_soak_idle_costs_one_pass(void);
+
+/* Flag Timer Tests (test_safetimer_flag.c) */
+#if SAFETIMER_ENABLE_FLAG_TIMERS
+extern void test_flag_timer_sets_bit_without_callback(void);
+extern void test_flag_timer_skips_callback_section(void);
+extern void test_flag_timer_delete_drops_pending_bit(void);
+#endif
+
+/* Compact Slot Tests (test_safetimer_compact.c) */
+#if SAFETIMER_COMPACT_SLOTS
+extern void test_compact_slot_layout(void);
+extern void test_compact_period_units(void);
+extern void test_compact_deadlines_across_wraps(void);
+extern void test_compact_user_data(void);
+#endif
+
+/* Catch-up Report Tests (test_safetimer_catchup_report.c) */
+#if SAFETIMER_ENABLE_CATCHUP == SAFETIMER_CATCHUP_REPORT
+extern void test_catchup_report_counts_missed_periods(void);
+extern void test_catchup_report_zero_outside_callback(void);
+#endif
+
+/* Critical Section Profile Tests (test_safetimer_crit_profile.c) */
+#if SAFETIMER_ENABLE_CRIT_PROFILE
+extern void test_crit_profile_sites_and_groups(void);
+extern void test_crit_profile_callback_attribution(void);
+extern void test_crit_profile_external_site(void);
+#endif
+
 /* ========== Main Test Runner ========== */
 
 int main(void) {
@@ -133,6 +336,7 @@ int main(void) {
     RUN_TEST(test_timer_expires_after_period);
     RUN_TEST(test_repeat_timer_continues_after_expiration);
     RUN_TEST(test_timer_handles_32bit_wraparound);
+    RUN_TEST(test_process_visits_only_active_slots);
 
     printf("\n========== Callback Tests ==========\n");
     RUN_TEST(test_oneshot_callback_called_once);
@@ -180,6 +384,8 @@ int main(void) {
     RUN_TEST(test_create_started_batch_success);
     RUN_TEST(test_create_started_batch_partial_failure);
     RUN_TEST(test_create_started_batch_null_checks);
+    RUN_TEST(test_create_batch_phase_locked);
+    RUN_TEST(test_create_batch_offsets);
     RUN_TEST(test_macro_create_started_or_success);
     RUN_TEST(test_macro_create_started_or_failure);
 
@@ -193,5 +399,200 @@ int main(void) {
     RUN_TEST(test_advance_period_overflow_wraparound);
     RUN_TEST(test_advance_period_regression_existing_timers);
 
+    printf("\n========== Expiry Cache Tests ==========\n");
+    RUN_TEST(test_expiry_cache_idle_pass_skips_scan);
+    RUN_TEST(test_expiry_cache_start_lowers_deadline);
+    RUN_TEST(test_expiry_cache_stop_earliest_rescans);
+    RUN_TEST(test_expiry_cache_follows_set_period);
+
+    printf("\n========== Next Expiry API Tests ==========\n");
+    RUN_TEST(test_next_expiry_no_active_timers);
+    RUN_TEST(test_next_expiry_returns_soonest);
+    RUN_TEST(test_next_expiry_overdue_returns_zero);
+    RUN_TEST(test_next_expiry_across_wraparound);
+    RUN_TEST(test_next_expiry_uses_cache);
+
+    printf("\n========== Snapshot Dispatch Tests ==========\n");
+    RUN_TEST(test_snapshot_dispatches_all_due);
+    RUN_TEST(test_snapshot_skips_timer_deleted_by_earlier_callback);
+    RUN_TEST(test_snapshot_skips_timer_restarted_by_earlier_callback);
+    RUN_TEST(test_snapshot_batch_overflow_defers);
+
+    printf("\n========== Catch-up Math Tests ==========\n");
+    RUN_TEST(test_catchup_missed_periods_matches_division);
+    RUN_TEST(test_catchup_skip_power_of_two_period);
+    RUN_TEST(test_catchup_advance_period_deep_lag);
+
+    printf("\n========== Timing Wheel Tests ==========\n");
+    RUN_TEST(test_wheel_far_deadline_waits_full_turns);
+    RUN_TEST(test_wheel_pass_cost_independent_of_pool);
+    RUN_TEST(test_wheel_restart_relinks_timer);
+    RUN_TEST(test_wheel_lagging_pass_catches_up);
+    RUN_TEST(test_wheel_delete_from_callback);
+    RUN_TEST(test_wheel_full_pool_handles);
+
+    printf("\n========== Min-Heap Engine Tests ==========\n");
+    RUN_TEST(test_heap_fires_in_deadline_order);
+    RUN_TEST(test_heap_period_changes_reorder);
+    RUN_TEST(test_heap_remove_middle_keeps_order);
+    RUN_TEST(test_heap_order_across_wraparound);
+    RUN_TEST(test_heap_next_expiry_full_pool);
+
+    printf("\n========== Multiple Pool Tests ==========\n");
+    RUN_TEST(test_pool_handles_are_per_pool);
+    RUN_TEST(test_pool_process_is_per_pool);
+    RUN_TEST(test_pool_recursion_guard_is_per_pool);
+#if SAFETIMER_ENABLE_POOL_LOCK
+    RUN_TEST(test_pool_lock_hooks_replace_bsp);
+#endif
+
+#if SAFETIMER_ENABLE_PROCESS_BUDGET
+    printf("\n========== Process Budget Tests ==========\n");
+    RUN_TEST(test_budget_callback_limit);
+    RUN_TEST(test_budget_resume_no_starvation);
+    RUN_TEST(test_budget_tick_limit);
+    RUN_TEST(test_budget_leftovers_same_tick);
+    RUN_TEST(test_budget_spent_only_future_left);
+#endif
+
+#if SAFETIMER_ENABLE_ISR_QUEUE
+    printf("\n========== ISR Command Queue Tests ==========\n");
+    RUN_TEST(test_isr_queue_start_uses_isr_tick);
+    RUN_TEST(test_isr_queue_full_ring);
+    RUN_TEST(test_isr_queue_applies_in_order);
+    RUN_TEST(test_isr_queue_drops_stale_handle);
+#endif
+
+#if SAFETIMER_ENABLE_ATOMICS
+    printf("\n========== Atomics Tests ==========\n");
+    RUN_TEST(test_atomics_only_due_slots_lock);
+    RUN_TEST(test_atomics_cache_follows_writers);
+#endif
+
+#if SAFETIMER_ENABLE_ISR_DISPATCH
+    printf("\n========== ISR Dispatch Tests ==========\n");
+    RUN_TEST(test_isr_dispatch_idle_without_detect);
+    RUN_TEST(test_isr_dispatch_fires_on_deadline);
+    RUN_TEST(test_isr_dispatch_repeat_period);
+#if SAFETIMER_ENABLE_ISR_QUEUE
+    RUN_TEST(test_isr_dispatch_queue_sets_ready);
+#endif
+#endif
+
+#if SAFETIMER_PRIORITY_LEVELS > 1
+    printf("\n========== Priority Tests ==========\n");
+    RUN_TEST(test_priority_dispatch_order);
+    RUN_TEST(test_priority_invalid_and_reset);
+#if SAFETIMER_ENABLE_PROCESS_BUDGET
+    RUN_TEST(test_priority_with_budget);
+#endif
+#endif
+
+#if SAFETIMER_ENABLE_STATS
+    printf("\n========== Statistics Tests ==========\n");
+    RUN_TEST(test_stats_lateness_and_missed);
+    RUN_TEST(test_stats_callback_duration);
+    RUN_TEST(test_stats_reset_rules);
+#endif
+
+#if SAFETIMER_ENABLE_TRACE
+    printf("\n========== Event Trace Tests ==========\n");
+    RUN_TEST(test_trace_event_sequence);
+    RUN_TEST(test_trace_late_fire_and_skip);
+    RUN_TEST(test_trace_ring_overwrite);
+    RUN_TEST(test_trace_count_past_16_bits);
+    RUN_TEST(test_trace_attach_rules);
+#endif
+
+#if SAFETIMER_ENABLE_SLACK
+    printf("\n========== Slack Tests ==========\n");
+    RUN_TEST(test_slack_coalesces_into_wakeup);
+    RUN_TEST(test_slack_outside_window);
+    RUN_TEST(test_slack_repeat_phase_locked);
+    RUN_TEST(test_slack_rules);
+#endif
+
+    printf("\n========== Trigger Tests ==========\n");
+    RUN_TEST(test_trigger_fires_running_timer);
+    RUN_TEST(test_trigger_starts_stopped_timer);
+    RUN_TEST(test_trigger_invalid_handle);
+#if SAFETIMER_ENABLE_ISR_QUEUE
+    RUN_TEST(test_trigger_from_isr);
+#endif
+#if SAFETIMER_ENABLE_SEM_WAKE
+    RUN_TEST(test_sem_wake_resumes_waiter);
+    RUN_TEST(test_sem_wake_timeout);
+    RUN_TEST(test_sem_wake_forever);
+    RUN_TEST(test_sem_wake_deleted_waiter);
+#if SAFETIMER_ENABLE_ISR_QUEUE
+    RUN_TEST(test_sem_wake_from_isr);
+#endif
+#endif
+
+#if SAFETIMER_ENABLE_CORO_SCHED
+    printf("\n========== Task Scheduler Tests ==========\n");
+    RUN_TEST(test_sched_tasks_share_one_slot);
+    RUN_TEST(test_sched_wait_phase_locked_when_late);
+    RUN_TEST(test_sched_exited_tasks);
+    RUN_TEST(test_sched_start_rules);
+#endif
+
+#if SAFETIMER_BSP_TICKLESS
+    printf("\n========== Tickless BSP Tests ==========\n");
+    RUN_TEST(test_tickless_arm_programs_next_deadline);
+    RUN_TEST(test_tickless_arm_due_programs_nothing);
+    RUN_TEST(test_tickless_large_jump_one_pass);
+#endif
+
+    printf("\n========== Tick Unit Tests ==========\n");
+    RUN_TEST(test_tick_unit_conversion_rounds_up);
+    RUN_TEST(test_tick_unit_period_limit);
+    RUN_TEST(test_tick_unit_sub_ms_period);
+#if SAFETIMER_ENABLE_HW_COMPARE
+    RUN_TEST(test_hw_compare_tracks_earliest);
+    RUN_TEST(test_hw_compare_stale_deadline);
+    RUN_TEST(test_hw_compare_trigger_and_idle);
+#endif
+
+#if SAFETIMER_STATIC_TIMERS > 0
+    printf("\n========== Static Timer Table Tests ==========\n");
+    RUN_TEST(test_static_timers_run_from_reset);
+    RUN_TEST(test_static_timers_are_fixed);
+    RUN_TEST(test_static_slots_reserved);
+#endif
+
+    printf("\n========== Soak Tests ==========\n");
+    RUN_TEST(test_soak_week_repeat_exact_counts);
+    RUN_TEST(test_soak_wraparound_exact_ticks);
+    RUN_TEST(test_soak_idle_costs_one_pass);
+
+#if SAFETIMER_ENABLE_FLAG_TIMERS
+    printf("\n========== Flag Timer Tests ==========\n");
+    RUN_TEST(test_flag_timer_sets_bit_without_callback);
+    RUN_TEST(test_flag_timer_skips_callback_section);
+    RUN_TEST(test_flag_timer_delete_drops_pending_bit);
+#endif
+
+#if SAFETIMER_COMPACT_SLOTS
+    printf("\n========== Compact Slot Tests ==========\n");
+    RUN_TEST(test_compact_slot_layout);
+    RUN_TEST(test_compact_period_units);
+    RUN_TEST(test_compact_deadlines_across_wraps);
+    RUN_TEST(test_compact_user_data);
+#endif
+
+#if SAFETIMER_ENABLE_CATCHUP == SAFETIMER_CATCHUP_REPORT
+    printf("\n========== Catch-up Report Tests ==========\n");
+    RUN_TEST(test_catchup_report_counts_missed_periods);
+    RUN_TEST(test_catchup_report_zero_outside_callback);
+#endif
+
+#if SAFETIMER_ENABLE_CRIT_PROFILE
+    printf("\n========== Critical Section Profile Tests ==========\n");
+    RUN_TEST(test_crit_profile_sites_and_groups);
+    RUN_TEST(test_crit_profile_callback_attribution);
+    RUN_TEST(test_crit_profile_external_site);
+#endif
+
     return UNITY_END();
 }
@@ -0,0 +1,96 @@
+/**
+ * @file    test_safetimer_atomics.c
+ * @brief   Unit tests for lock-free slot checks (SAFETIMER_ENABLE_ATOMICS)
+ * @version 1.0.0
+ * @date    2026-10-14
+ *
+ * Tests that safetimer_process() only locks for due slots and still sees
+ * deadlines changed between passes.
+ */
+
+#include "mock_bsp.h"
+#include "safetimer.h"
+#include "unity.h"
+
+/* External test helper from safetimer.c */
+#ifdef UNIT_TEST
+extern void safetimer_test_reset_pool(void);
+#endif
+
+#if SAFETIMER_ENABLE_ATOMICS
+
+#define ATOMICS_TEST_TIMERS 4
+
+/* ========== Test Data ========== */
+
+static int g_atomics_fire_count = 0;
+
+static void atomics_callback(void *user_data) {
+  (void)user_data;
+  g_atomics_fire_count++;
+}
+
+/* ========== Test Cases ========== */
+
+/* Run one pass at tick 10 with running_timers timers, slot 0 due */
+static unsigned long atomics_locks_for_pass(int running_timers) {
+  mock_bsp_stats_t stats;
+  safetimer_handle_t h;
+  int i;
+
+  safetimer_test_reset_pool();
+  mock_bsp_set_ticks(0);
+  g_atomics_fire_count = 0;
+  for (i = 0; i < running_timers; i++) {
+    h = safetimer_create(i == 0 ? 10 : 1000, TIMER_MODE_REPEAT,
+                         atomics_callback, NULL);
+    TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+  }
+
+  mock_bsp_set_ticks(10);
+  mock_bsp_reset_stats();
+  safetimer_process();
+  mock_bsp_get_stats(&stats);
+
+  TEST_ASSERT_EQUAL_INT(1, g_atomics_fire_count);
+  TEST_ASSERT_EQUAL_UINT32(10, safetimer_get_next_expiry());
+  return stats.enter_critical_count;
+}
+
+/**
+ * Test: one due timer alone, then among three running non-due timers
+ * Verify: non-due slots are checked without a critical section
+ */
+void test_atomics_only_due_slots_lock(void) {
+  unsigned long alone;
+
+  alone = atomics_locks_for_pass(1);
+  TEST_ASSERT_EQUAL_UINT32(alone, atomics_locks_for_pass(ATOMICS_TEST_TIMERS));
+}
+
+/**
+ * Test: deadline moved earlier and timer stopped between lock-free passes
+ * Verify: the cached deadline follows both changes
+ */
+void test_atomics_cache_follows_writers(void) {
+  safetimer_handle_t slow, fast;
+
+  g_atomics_fire_count = 0;
+  slow = safetimer_create(1000, TIMER_MODE_REPEAT, atomics_callback, NULL);
+  fast = safetimer_create(50, TIMER_MODE_ONE_SHOT, atomics_callback, NULL);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(slow));
+  safetimer_process(); /* Cache holds tick 1000 */
+
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(fast));
+  mock_bsp_set_ticks(50);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(1, g_atomics_fire_count);
+
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_stop(slow));
+  mock_bsp_set_ticks(1000);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(1, g_atomics_fire_count);
+  TEST_ASSERT_EQUAL_UINT32(SAFETIMER_NO_EXPIRY, safetimer_get_next_expiry());
+}
+
+#endif /* SAFETIMER_ENABLE_ATOMICS */
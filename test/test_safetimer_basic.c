@@ -43,29 +43,37 @@ void test_create_valid_timer_repeat(void) {
 }
 
 void test_create_timer_zero_period_should_fail(void) {
+#if ENABLE_PARAM_CHECK
   safetimer_handle_t handle;
 
   handle = safetimer_create(0, TIMER_MODE_ONE_SHOT, NULL, NULL);
 
   TEST_ASSERT_EQUAL(SAFETIMER_INVALID_HANDLE, handle);
+#else
+  TEST_IGNORE_MESSAGE("Requires ENABLE_PARAM_CHECK=1");
+#endif
 }
 
 void test_create_timer_too_large_period_should_fail(void) {
+#if ENABLE_PARAM_CHECK
   safetimer_handle_t handle;
 
   /* Period > 2^31-1 should fail (ADR-005 constraint) */
   handle = safetimer_create(0x80000000UL, TIMER_MODE_ONE_SHOT, NULL, NULL);
 
   TEST_ASSERT_EQUAL(SAFETIMER_INVALID_HANDLE, handle);
+#else
+  TEST_IGNORE_MESSAGE("Requires ENABLE_PARAM_CHECK=1");
+#endif
 }
 
 void test_create_multiple_timers_until_pool_full(void) {
-  safetimer_handle_t handles[MAX_TIMERS + 1];
+  safetimer_handle_t handles[SAFETIMER_RUNTIME_TIMERS + 1];
   int i;
   int used, total;
 
-  /* Create MAX_TIMERS timers */
-  for (i = 0; i < MAX_TIMERS; i++) {
+  /* Create SAFETIMER_RUNTIME_TIMERS timers */
+  for (i = 0; i < SAFETIMER_RUNTIME_TIMERS; i++) {
     handles[i] = safetimer_create(100, TIMER_MODE_ONE_SHOT, NULL, NULL);
     TEST_ASSERT_NOT_EQUAL(SAFETIMER_INVALID_HANDLE, handles[i]);
   }
@@ -76,8 +84,10 @@ void test_create_multiple_timers_until_pool_full(void) {
   TEST_ASSERT_EQUAL_INT(MAX_TIMERS, total);
 
   /* Next create should fail */
-  handles[MAX_TIMERS] = safetimer_create(100, TIMER_MODE_ONE_SHOT, NULL, NULL);
-  TEST_ASSERT_EQUAL(SAFETIMER_INVALID_HANDLE, handles[MAX_TIMERS]);
+  handles[SAFETIMER_RUNTIME_TIMERS] =
+      safetimer_create(100, TIMER_MODE_ONE_SHOT, NULL, NULL);
+  TEST_ASSERT_EQUAL(SAFETIMER_INVALID_HANDLE,
+                    handles[SAFETIMER_RUNTIME_TIMERS]);
 }
 
 /* ========== Test Cases: Timer Start/Stop ========== */
@@ -115,6 +125,7 @@ void test_stop_timer_clears_active_state(void) {
 }
 
 void test_start_invalid_handle_should_fail(void) {
+#if ENABLE_PARAM_CHECK
   timer_error_t err;
 
   err = safetimer_start(SAFETIMER_INVALID_HANDLE);
@@ -122,6 +133,9 @@ void test_start_invalid_handle_should_fail(void) {
 
   err = safetimer_start(MAX_TIMERS); /* Out of range */
   TEST_ASSERT_EQUAL(TIMER_ERR_INVALID, err);
+#else
+  TEST_IGNORE_MESSAGE("Requires ENABLE_PARAM_CHECK=1");
+#endif
 }
 
 /* ========== Test Cases: Timer Deletion ========== */
@@ -226,3 +240,43 @@ void test_timer_handles_32bit_wraparound(void) {
   TEST_PASS_MESSAGE("Skipping 32-bit overflow test in 16-bit mode");
 #endif
 }
+
+/* ========== Test Cases: Active Bitmap Dispatch ========== */
+
+void test_process_visits_only_active_slots(void) {
+  safetimer_handle_t handles[SAFETIMER_RUNTIME_TIMERS];
+  mock_bsp_stats_t stats;
+  int used, total;
+  int i;
+
+  for (i = 0; i < SAFETIMER_RUNTIME_TIMERS; i++) {
+    handles[i] = safetimer_create(100, TIMER_MODE_ONE_SHOT, NULL, NULL);
+    TEST_ASSERT_NOT_EQUAL(SAFETIMER_INVALID_HANDLE, handles[i]);
+  }
+  /* Only the last slot runs */
+  safetimer_start(handles[SAFETIMER_RUNTIME_TIMERS - 1]);
+
+  mock_bsp_set_ticks(100);
+  mock_bsp_reset_stats();
+  safetimer_process();
+  mock_bsp_get_stats(&stats);
+
+#if SAFETIMER_PROCESS_SNAPSHOT
+  /* Collect + commit, independent of pool size */
+  TEST_ASSERT_EQUAL_UINT32(2, stats.enter_critical_count);
+#elif SAFETIMER_ENGINE == SAFETIMER_ENGINE_WHEEL && MAX_TIMERS < 100
+  /* Jump > MAX_TIMERS: fast path + running-slot scan + slot + publish */
+  TEST_ASSERT_EQUAL_UINT32(3 + BITMAP_WORDS + 1, stats.enter_critical_count);
+#elif SAFETIMER_ENGINE == SAFETIMER_ENGINE_WHEEL
+  /* Fast path + one bucket per elapsed tick (one turn max) + slot + publish */
+  TEST_ASSERT_EQUAL_UINT32(
+      3 + (SAFETIMER_WHEEL_SIZE < 100 ? SAFETIMER_WHEEL_SIZE : 100),
+      stats.enter_critical_count);
+#else
+  /* Fast-path check + one slot + cache publish, independent of pool size */
+  TEST_ASSERT_EQUAL_UINT32(3, stats.enter_critical_count);
+#endif
+
+  safetimer_get_pool_usage(&used, &total);
+  TEST_ASSERT_EQUAL_INT(MAX_TIMERS, used);
+}
@@ -0,0 +1,172 @@
+/**
+ * @file    test_safetimer_budget.c
+ * @brief   Unit tests for safetimer_process_budget()
+ * @version 1.0.0
+ * @date    2026-10-14
+ *
+ * Tests that budgeted passes stop after the callback/tick budget and that
+ * the next pass resumes at the first undispatched slot.
+ */
+
+#include "mock_bsp.h"
+#include "safetimer.h"
+#include "unity.h"
+
+/* External test helper from safetimer.c */
+#ifdef UNIT_TEST
+extern void safetimer_test_reset_pool(void);
+#endif
+
+#if SAFETIMER_ENABLE_PROCESS_BUDGET
+
+#define BUDGET_TEST_TIMERS 4
+
+/* ========== Test Data ========== */
+
+static int g_budget_order[BUDGET_TEST_TIMERS * 2];
+static int g_budget_order_len = 0;
+static int g_budget_ids[BUDGET_TEST_TIMERS] = {0, 1, 2, 3};
+
+static void budget_order_callback(void *user_data) {
+  if (g_budget_order_len < BUDGET_TEST_TIMERS * 2) {
+    g_budget_order[g_budget_order_len++] = *(int *)user_data;
+  }
+}
+
+/* Simulates a slow callback: 5 ms of work */
+static void budget_slow_callback(void *user_data) {
+  budget_order_callback(user_data);
+  mock_bsp_advance_time(5);
+}
+
+/* Create BUDGET_TEST_TIMERS timers that all expire at the same tick */
+static void budget_create_timers(safetimer_handle_t *handles,
+                                 timer_mode_t mode,
+                                 timer_callback_t callback) {
+  int i;
+
+  g_budget_order_len = 0;
+  for (i = 0; i < BUDGET_TEST_TIMERS; i++) {
+    handles[i] = safetimer_create(10, mode, callback, &g_budget_ids[i]);
+    TEST_ASSERT_NOT_EQUAL(SAFETIMER_INVALID_HANDLE, handles[i]);
+    TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(handles[i]));
+  }
+}
+
+/* ========== Test Cases ========== */
+
+/**
+ * Test: four timers due at once, one callback per call
+ * Verify: each call runs exactly one callback, in slot order
+ */
+void test_budget_callback_limit(void) {
+  safetimer_handle_t h[BUDGET_TEST_TIMERS];
+  int i;
+
+  budget_create_timers(h, TIMER_MODE_ONE_SHOT, budget_order_callback);
+  mock_bsp_advance_time(10);
+
+  for (i = 0; i < BUDGET_TEST_TIMERS - 1; i++) {
+    TEST_ASSERT_EQUAL_INT(1, safetimer_process_budget(1, 0));
+    TEST_ASSERT_EQUAL_INT(i + 1, g_budget_order_len);
+  }
+  TEST_ASSERT_EQUAL_INT(0, safetimer_process_budget(1, 0)); /* Last one */
+
+  for (i = 0; i < BUDGET_TEST_TIMERS; i++) {
+    TEST_ASSERT_EQUAL_INT(i, g_budget_order[i]);
+  }
+  TEST_ASSERT_EQUAL_UINT32(SAFETIMER_NO_EXPIRY, safetimer_get_next_expiry());
+}
+
+/**
+ * Test: REPEAT timers due again before the previous pass finished
+ * Verify: next pass resumes at slot 2 instead of restarting at slot 0
+ */
+void test_budget_resume_no_starvation(void) {
+  safetimer_handle_t h[BUDGET_TEST_TIMERS];
+
+  budget_create_timers(h, TIMER_MODE_REPEAT, budget_order_callback);
+
+  mock_bsp_advance_time(10);
+  TEST_ASSERT_EQUAL_INT(1, safetimer_process_budget(2, 0));
+
+  mock_bsp_advance_time(10); /* Slots 0 and 1 are due again */
+  TEST_ASSERT_EQUAL_INT(1, safetimer_process_budget(2, 0));
+
+  TEST_ASSERT_EQUAL_INT(4, g_budget_order_len);
+  TEST_ASSERT_EQUAL_INT(0, g_budget_order[0]);
+  TEST_ASSERT_EQUAL_INT(1, g_budget_order[1]);
+  TEST_ASSERT_EQUAL_INT(2, g_budget_order[2]);
+  TEST_ASSERT_EQUAL_INT(3, g_budget_order[3]);
+
+  /* Wrapped around: slots 0 and 1 of the second period */
+  (void)safetimer_process_budget(2, 0);
+  TEST_ASSERT_EQUAL_INT(6, g_budget_order_len);
+  TEST_ASSERT_EQUAL_INT(0, g_budget_order[4]);
+  TEST_ASSERT_EQUAL_INT(1, g_budget_order[5]);
+}
+
+/**
+ * Test: 5 ms callbacks with a 10 ms tick budget
+ * Verify: pass stops once the budget elapsed, after two callbacks
+ */
+void test_budget_tick_limit(void) {
+  safetimer_handle_t h[BUDGET_TEST_TIMERS];
+
+  budget_create_timers(h, TIMER_MODE_ONE_SHOT, budget_slow_callback);
+  mock_bsp_advance_time(10);
+
+  TEST_ASSERT_EQUAL_INT(1, safetimer_process_budget(0, 10));
+  TEST_ASSERT_EQUAL_INT(2, g_budget_order_len);
+
+  TEST_ASSERT_EQUAL_INT(0, safetimer_process_budget(0, 0)); /* No limit */
+  TEST_ASSERT_EQUAL_INT(4, g_budget_order_len);
+  TEST_ASSERT_EQUAL_INT(3, g_budget_order[3]);
+}
+
+/**
+ * Test: plain safetimer_process() at the same tick after a budget stop
+ * Verify: leftovers are still reported due and dispatched (all engines)
+ */
+void test_budget_leftovers_same_tick(void) {
+  safetimer_handle_t h[BUDGET_TEST_TIMERS];
+
+  budget_create_timers(h, TIMER_MODE_ONE_SHOT, budget_order_callback);
+  mock_bsp_advance_time(10);
+
+  TEST_ASSERT_EQUAL_INT(1, safetimer_process_budget(1, 0));
+  TEST_ASSERT_EQUAL_UINT32(0, safetimer_get_next_expiry());
+
+  /* A stopped leftover must not fire */
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_stop(h[2]));
+  safetimer_process();
+
+  TEST_ASSERT_EQUAL_INT(3, g_budget_order_len);
+  TEST_ASSERT_EQUAL_INT(1, g_budget_order[1]);
+  TEST_ASSERT_EQUAL_INT(3, g_budget_order[2]);
+  TEST_ASSERT_EQUAL_UINT32(SAFETIMER_NO_EXPIRY, safetimer_get_next_expiry());
+}
+
+/**
+ * Test: timers due at 10 and 1000, one callback per call at tick 10
+ * Verify: budget spent with only a not-yet-due timer left is not an early
+ *         stop (returns 0), the cache keeps its deadline
+ */
+void test_budget_spent_only_future_left(void) {
+  safetimer_handle_t near_h, far_h;
+
+  g_budget_order_len = 0;
+  near_h = safetimer_create(10, TIMER_MODE_ONE_SHOT, budget_order_callback,
+                            &g_budget_ids[0]);
+  far_h = safetimer_create(1000, TIMER_MODE_ONE_SHOT, budget_order_callback,
+                           &g_budget_ids[1]);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(near_h));
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(far_h));
+  mock_bsp_advance_time(10);
+
+  TEST_ASSERT_EQUAL_INT(0, safetimer_process_budget(1, 0));
+  TEST_ASSERT_EQUAL_INT(1, g_budget_order_len);
+  TEST_ASSERT_EQUAL_UINT32(990, safetimer_get_next_expiry());
+}
+
+#endif /* SAFETIMER_ENABLE_PROCESS_BUDGET */
@@ -107,6 +107,11 @@ void test_callback_receives_user_data(void) {
     safetimer_handle_t h;
     int my_data = 0x1234;
 
+    if (SAFETIMER_COMPACT_SLOTS == 2) {
+        TEST_IGNORE_MESSAGE(
+            "Requires user_data (SAFETIMER_COMPACT_SLOTS=2)");
+    }
+
     h = safetimer_create(1000, TIMER_MODE_ONE_SHOT, count_callback, &my_data);
     safetimer_start(h);
 
@@ -171,6 +176,11 @@ void test_callback_with_different_user_data(void) {
     int data1 = 111;
     int data2 = 222;
 
+    if (SAFETIMER_COMPACT_SLOTS == 2) {
+        TEST_IGNORE_MESSAGE(
+            "Requires user_data (SAFETIMER_COMPACT_SLOTS=2)");
+    }
+
     h1 = safetimer_create(1000, TIMER_MODE_ONE_SHOT, tracking_callback, &data1);
     h2 = safetimer_create(2000, TIMER_MODE_ONE_SHOT, tracking_callback, &data2);
 
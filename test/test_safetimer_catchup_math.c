@@ -0,0 +1,113 @@
+/**
+ * @file    test_safetimer_catchup_math.c
+ * @brief   Unit tests for division-free catch-up math
+ * @version 1.0.0
+ * @date    2026-10-14
+ *
+ * Checks calc_missed_periods() against plain division on every fast path
+ * and verifies skip-mode deadlines for power-of-two and deep-lag cases.
+ */
+
+#include "mock_bsp.h"
+#include "safetimer.h"
+#include "unity.h"
+
+/* External helpers from safetimer.c (STATIC is empty under UNIT_TEST) */
+#ifdef UNIT_TEST
+extern void safetimer_test_reset_pool(void);
+extern uint32_t calc_missed_periods(uint32_t lag, uint32_t period);
+#endif
+
+/* ========== Test Data ========== */
+
+static int g_catchup_fire_count = 0;
+
+static void catchup_callback(void *user_data) {
+  (void)user_data;
+  g_catchup_fire_count++;
+}
+
+/* ========== Test Cases ========== */
+
+/**
+ * Test: shift, subtract and divide paths all match lag / period
+ * Verify: power-of-two, small-lag and deep-lag inputs
+ */
+void test_catchup_missed_periods_matches_division(void) {
+  static const uint32_t periods[] = {1,   2,    3,     7,     64,
+                                     100, 1000, 32768, 65535, 0x7FFFFFFFUL};
+  static const uint32_t lags[] = {0,    1,     63,     64,    99,
+                                  100,  399,   400,    401,   65535,
+                                  65536, 99999, 0x7FFFFFFFUL};
+  uint32_t p, l;
+  unsigned int i, j;
+
+  for (i = 0; i < sizeof(periods) / sizeof(periods[0]); i++) {
+    for (j = 0; j < sizeof(lags) / sizeof(lags[0]); j++) {
+      p = periods[i];
+      l = lags[j];
+      TEST_ASSERT_EQUAL_UINT32(l / p, calc_missed_periods(l, p));
+    }
+  }
+}
+
+/**
+ * Test: skip mode with a power-of-two period after a long stall
+ * Verify: one callback, next deadline stays phase-locked
+ */
+void test_catchup_skip_power_of_two_period(void) {
+  safetimer_handle_t h;
+
+  if (!SAFETIMER_PERIOD_FITS(64UL)) {
+    TEST_IGNORE_MESSAGE("Period not accepted by this slot layout");
+  }
+
+  g_catchup_fire_count = 0;
+  h = safetimer_create(64, TIMER_MODE_REPEAT, catchup_callback, NULL);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+
+  /* Stall: deadline 64, now 64 + 5*64 + 10 = 394 */
+  mock_bsp_set_ticks(394);
+  safetimer_process();
+
+  TEST_ASSERT_EQUAL_INT(1, g_catchup_fire_count);
+
+#if SAFETIMER_ENABLE_CATCHUP != SAFETIMER_CATCHUP_BURST
+  /* Next phase-locked deadline: 448 */
+  mock_bsp_set_ticks(447);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(1, g_catchup_fire_count);
+
+  mock_bsp_set_ticks(448);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(2, g_catchup_fire_count);
+#endif
+}
+
+/**
+ * Test: advance_period() far behind schedule (past the subtract limit)
+ * Verify: deadline lands on the next phase-locked interval
+ */
+void test_catchup_advance_period_deep_lag(void) {
+  safetimer_handle_t h;
+
+  g_catchup_fire_count = 0;
+  h = safetimer_create(100, TIMER_MODE_REPEAT, catchup_callback, NULL);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+
+  mock_bsp_set_ticks(100);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(1, g_catchup_fire_count);
+
+  /* last=100, new period 30: 130 is 1000 ticks late => 130 + 34*30 = 1150 */
+  mock_bsp_set_ticks(1130);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_advance_period(h, 30));
+
+  mock_bsp_set_ticks(1149);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(1, g_catchup_fire_count);
+
+  mock_bsp_set_ticks(1150);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(2, g_catchup_fire_count);
+}
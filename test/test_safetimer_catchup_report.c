@@ -0,0 +1,126 @@
+/**
+ * @file    test_safetimer_catchup_report.c
+ * @brief   Unit tests for the reporting catch-up policy
+ * @version 1.0.0
+ * @date    2026-10-14
+ *
+ * Tests that a stalled REPEAT timer fires once, stays phase-locked and
+ * reports the coalesced periods through safetimer_get_missed_count(), and
+ * that the count is per callback and 0 outside callbacks
+ * (SAFETIMER_ENABLE_CATCHUP == SAFETIMER_CATCHUP_REPORT).
+ */
+
+#include "mock_bsp.h"
+#include "safetimer.h"
+#include "unity.h"
+
+#if SAFETIMER_ENABLE_CATCHUP == SAFETIMER_CATCHUP_REPORT
+
+/* ========== Test Data ========== */
+
+typedef struct {
+  int calls;
+  uint32_t missed;  /* Missed count seen by the last call */
+  uint32_t elapsed; /* Sum of (missed + 1) over all calls */
+} report_probe_t;
+
+static report_probe_t g_probe[2];
+
+static void report_callback(void *user_data) {
+  report_probe_t *probe = (report_probe_t *)user_data;
+
+  probe->calls++;
+  probe->missed = safetimer_get_missed_count();
+  probe->elapsed += probe->missed + 1U;
+}
+
+static void report_reset_probes(void) {
+  int i;
+
+  for (i = 0; i < 2; i++) {
+    g_probe[i].calls = 0;
+    g_probe[i].missed = 0xFFFFFFFFUL;
+    g_probe[i].elapsed = 0;
+  }
+}
+
+/* ========== Test Cases ========== */
+
+/**
+ * Test: REPEAT 10 ms stalled from deadline 20 to tick 55, with a 5 ms
+ *       timer due on time in the same pass
+ * Verify: one callback seeing 3 missed periods, on-time timer sees 0,
+ *         next deadline phase-locked at 60, elapsed periods exact
+ */
+void test_catchup_report_counts_missed_periods(void) {
+  safetimer_handle_t slow;
+  safetimer_handle_t fast;
+
+  if (!SAFETIMER_PERIOD_FITS(5UL)) {
+    TEST_IGNORE_MESSAGE("Period not accepted by this slot layout");
+  }
+  if (SAFETIMER_COMPACT_SLOTS == 2) {
+    TEST_IGNORE_MESSAGE("Requires user_data (SAFETIMER_COMPACT_SLOTS=2)");
+  }
+
+  report_reset_probes();
+  slow = safetimer_create(10, TIMER_MODE_REPEAT, report_callback,
+                          &g_probe[0]);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(slow));
+
+  mock_bsp_set_ticks(10);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(1, g_probe[0].calls);
+  TEST_ASSERT_EQUAL_UINT32(0, g_probe[0].missed);
+
+  mock_bsp_set_ticks(50);
+  fast = safetimer_create(5, TIMER_MODE_REPEAT, report_callback, &g_probe[1]);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(fast));
+
+  mock_bsp_set_ticks(55); /* Deadlines 20, 30, 40, 50 elapsed */
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(2, g_probe[0].calls);
+  TEST_ASSERT_EQUAL_UINT32(3, g_probe[0].missed);
+  TEST_ASSERT_EQUAL_INT(1, g_probe[1].calls);
+  TEST_ASSERT_EQUAL_UINT32(0, g_probe[1].missed);
+
+  mock_bsp_set_ticks(59);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(2, g_probe[0].calls);
+
+  mock_bsp_set_ticks(60);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(3, g_probe[0].calls);
+  TEST_ASSERT_EQUAL_UINT32(0, g_probe[0].missed);
+  TEST_ASSERT_EQUAL_UINT32(6, g_probe[0].elapsed); /* 60 / 10 */
+}
+
+/**
+ * Test: ONE_SHOT fired 100 ticks late, then query outside callbacks
+ * Verify: ONE_SHOT reports 0, no count leaks out of a callback
+ */
+void test_catchup_report_zero_outside_callback(void) {
+  safetimer_handle_t h;
+
+  report_reset_probes();
+  h = safetimer_create(10, TIMER_MODE_ONE_SHOT, report_callback,
+                       &g_probe[0]);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+  mock_bsp_set_ticks(110);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(1, g_probe[0].calls);
+  TEST_ASSERT_EQUAL_UINT32(0, g_probe[0].missed);
+
+  h = safetimer_create(10, TIMER_MODE_REPEAT, report_callback, &g_probe[1]);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+  mock_bsp_set_ticks(200); /* Deadline 120: 8 periods coalesced */
+  safetimer_process();
+  TEST_ASSERT_EQUAL_UINT32(8, g_probe[1].missed);
+  TEST_ASSERT_EQUAL_UINT32(0, safetimer_get_missed_count());
+
+#if ENABLE_PARAM_CHECK
+  TEST_ASSERT_EQUAL_UINT32(0, safetimer_get_missed_count_in(NULL));
+#endif
+}
+
+#endif /* SAFETIMER_ENABLE_CATCHUP == SAFETIMER_CATCHUP_REPORT */
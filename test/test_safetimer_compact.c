@@ -0,0 +1,180 @@
+/**
+ * @file    test_safetimer_compact.c
+ * @brief   Unit tests for prescaled compact timer slots
+ * @version 1.0.0
+ * @date    2026-10-14
+ *
+ * Tests the compact slot layout (8-bit period in
+ * SAFETIMER_COMPACT_PERIOD_UNIT ticks, 16-bit deadline against the pool
+ * epoch): field widths, whole-unit period validation, exact deadlines over
+ * many 16-bit and full tick wraps, and user_data handling
+ * (SAFETIMER_COMPACT_SLOTS).
+ */
+
+#include "mock_bsp.h"
+#include "safetimer.h"
+#include "unity.h"
+
+#if SAFETIMER_COMPACT_SLOTS
+
+/* ========== Test Data ========== */
+
+#define COMPACT_UNIT SAFETIMER_COMPACT_PERIOD_UNIT
+
+static unsigned long g_compact_fired[2];
+static unsigned long g_compact_late;
+static bsp_tick_t g_compact_last[2];
+static void *g_compact_user_data;
+
+static void compact_check(int which, bsp_tick_t period) {
+  bsp_tick_t now = mock_bsp_get_current_ticks();
+
+  if ((bsp_tick_t)(now - g_compact_last[which]) != period) {
+    g_compact_late++;
+  }
+  g_compact_last[which] = now;
+  g_compact_fired[which]++;
+}
+
+static void compact_fast_callback(void *user_data) {
+  (void)user_data;
+  compact_check(0, (bsp_tick_t)COMPACT_UNIT);
+}
+
+static void compact_slow_callback(void *user_data) {
+  (void)user_data;
+  compact_check(1, (bsp_tick_t)SAFETIMER_MAX_PERIOD);
+}
+
+static void compact_user_data_callback(void *user_data) {
+  g_compact_user_data = user_data;
+  g_compact_fired[0]++;
+}
+
+/* ========== Test Cases ========== */
+
+/**
+ * Test: slot field widths and period limit
+ * Verify: 1-byte period, 2-byte deadline, 255-unit maximum period
+ */
+void test_compact_slot_layout(void) {
+  safetimer_pool_t *pool = (safetimer_pool_t *)0;
+
+  TEST_ASSERT_EQUAL_UINT32(1, sizeof(pool->slots[0].period));
+  TEST_ASSERT_EQUAL_UINT32(2, sizeof(pool->slots[0].expire_time));
+  TEST_ASSERT_EQUAL_UINT32(255UL * COMPACT_UNIT, SAFETIMER_MAX_PERIOD);
+}
+
+/**
+ * Test: periods of 1, 2 and 255 units, and off-unit / too long periods
+ * Verify: whole units accepted, others rejected (ENABLE_PARAM_CHECK),
+ *         a 2-unit ONE_SHOT fires exactly on its deadline
+ */
+void test_compact_period_units(void) {
+  safetimer_handle_t h;
+
+  h = safetimer_create(SAFETIMER_MAX_PERIOD, TIMER_MODE_REPEAT,
+                       compact_fast_callback, NULL);
+  TEST_ASSERT_NOT_EQUAL(SAFETIMER_INVALID_HANDLE, h);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_delete(h));
+
+#if ENABLE_PARAM_CHECK
+  TEST_ASSERT_EQUAL(SAFETIMER_INVALID_HANDLE,
+                    safetimer_create(SAFETIMER_MAX_PERIOD + COMPACT_UNIT,
+                                     TIMER_MODE_REPEAT, compact_fast_callback,
+                                     NULL));
+#if COMPACT_UNIT > 1
+  TEST_ASSERT_EQUAL(SAFETIMER_INVALID_HANDLE,
+                    safetimer_create(COMPACT_UNIT + 1U, TIMER_MODE_REPEAT,
+                                     compact_fast_callback, NULL));
+#endif
+#endif
+
+  g_compact_fired[0] = 0;
+  h = safetimer_create(COMPACT_UNIT, TIMER_MODE_ONE_SHOT,
+                       compact_user_data_callback, NULL);
+  TEST_ASSERT_NOT_EQUAL(SAFETIMER_INVALID_HANDLE, h);
+#if ENABLE_PARAM_CHECK && COMPACT_UNIT > 1
+  TEST_ASSERT_EQUAL(TIMER_ERR_INVALID,
+                    safetimer_set_period(h, 2U * COMPACT_UNIT - 1U));
+#endif
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_set_period(h, 2U * COMPACT_UNIT));
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+
+  mock_bsp_set_ticks((bsp_tick_t)(2U * COMPACT_UNIT - 1U));
+  safetimer_process();
+  TEST_ASSERT_EQUAL_UINT32(0, g_compact_fired[0]);
+  mock_bsp_set_ticks((bsp_tick_t)(2U * COMPACT_UNIT));
+  safetimer_process();
+  TEST_ASSERT_EQUAL_UINT32(1, g_compact_fired[0]);
+}
+
+/**
+ * Test: 1-unit and 255-unit REPEAT timers started 3000 ticks before a
+ *       full tick wrap, run for 400 longest periods
+ * Verify: exact fire counts, every fire exactly one period after the last
+ *         (deadlines rebuilt correctly across 16-bit and full wraps)
+ */
+void test_compact_deadlines_across_wraps(void) {
+  static const uint32_t span = 400UL * SAFETIMER_MAX_PERIOD;
+  safetimer_handle_t fast;
+  safetimer_handle_t slow;
+
+  mock_bsp_set_ticks((bsp_tick_t)(0U - 3000U));
+  safetimer_process(); /* Idle pass: the clock jumped, as in a running loop */
+  g_compact_last[0] = mock_bsp_get_current_ticks();
+  g_compact_last[1] = g_compact_last[0];
+  g_compact_fired[0] = 0;
+  g_compact_fired[1] = 0;
+  g_compact_late = 0;
+
+  fast = safetimer_create(COMPACT_UNIT, TIMER_MODE_REPEAT,
+                          compact_fast_callback, NULL);
+  slow = safetimer_create(SAFETIMER_MAX_PERIOD, TIMER_MODE_REPEAT,
+                          compact_slow_callback, NULL);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(fast));
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(slow));
+
+  mock_bsp_fast_forward(span);
+
+  TEST_ASSERT_EQUAL_UINT32(span / COMPACT_UNIT, g_compact_fired[0]);
+  TEST_ASSERT_EQUAL_UINT32(400, g_compact_fired[1]);
+  TEST_ASSERT_EQUAL_UINT32(0, g_compact_late);
+}
+
+/**
+ * Test: callback timer created with and without user_data
+ * Verify: SAFETIMER_COMPACT_SLOTS=1 passes user_data through, =2 rejects
+ *         it (ENABLE_PARAM_CHECK) and calls back with NULL
+ */
+void test_compact_user_data(void) {
+  static int marker;
+  safetimer_handle_t h;
+
+  g_compact_fired[0] = 0;
+  g_compact_user_data = &marker;
+#if SAFETIMER_COMPACT_SLOTS == 2
+#if ENABLE_PARAM_CHECK
+  TEST_ASSERT_EQUAL(SAFETIMER_INVALID_HANDLE,
+                    safetimer_create(COMPACT_UNIT, TIMER_MODE_ONE_SHOT,
+                                     compact_user_data_callback, &marker));
+#endif
+  h = safetimer_create(COMPACT_UNIT, TIMER_MODE_ONE_SHOT,
+                       compact_user_data_callback, NULL);
+#else
+  h = safetimer_create(COMPACT_UNIT, TIMER_MODE_ONE_SHOT,
+                       compact_user_data_callback, &marker);
+#endif
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+  mock_bsp_set_ticks((bsp_tick_t)COMPACT_UNIT);
+  safetimer_process();
+
+  TEST_ASSERT_EQUAL_UINT32(1, g_compact_fired[0]);
+#if SAFETIMER_COMPACT_SLOTS == 2
+  TEST_ASSERT_NULL(g_compact_user_data);
+#else
+  TEST_ASSERT_EQUAL_PTR(&marker, g_compact_user_data);
+#endif
+}
+
+#endif /* SAFETIMER_COMPACT_SLOTS */
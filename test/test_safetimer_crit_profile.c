@@ -0,0 +1,139 @@
+/**
+ * @file    test_safetimer_crit_profile.c
+ * @brief   Unit tests for critical section profiling
+ * @version 1.0.0
+ * @date    2026-10-14
+ *
+ * Tests per call site and per public API group maxima, their attribution
+ * across callbacks, the profiled semaphore entry points and the reset
+ * rules (SAFETIMER_ENABLE_CRIT_PROFILE).
+ */
+
+#include "mock_bsp.h"
+#include "safetimer.h"
+#include "unity.h"
+#include <string.h>
+
+#if SAFETIMER_ENABLE_CRIT_PROFILE
+
+/* ========== Test Data ========== */
+
+static safetimer_handle_t g_probe_handle;
+
+static void profile_empty_callback(void *user_data) { (void)user_data; }
+
+/* Queries its own timer with 1-cycle sections while the pass runs at 7 */
+static void profile_query_callback(void *user_data) {
+  int running;
+
+  (void)user_data;
+  mock_bsp_set_cycle_step(1);
+  (void)safetimer_get_status(g_probe_handle, &running);
+  mock_bsp_set_cycle_step(7);
+}
+
+static int profile_is_core_site(const safetimer_crit_site_t *site) {
+  return strstr(site->file, "safetimer.c") != NULL && site->line > 0;
+}
+
+/* ========== Test Cases ========== */
+
+/**
+ * Test: create, start and process a timer with 5-cycle critical sections
+ * Verify: every registered site and the groups that ran measure 5, groups
+ *         that did not run stay 0, reset clears all but keeps the sites
+ */
+void test_crit_profile_sites_and_groups(void) {
+  const safetimer_crit_site_t *site;
+  safetimer_handle_t h;
+  int sites;
+
+  safetimer_reset_crit_profile();
+  mock_bsp_set_cycle_step(5);
+
+  h = safetimer_create(10, TIMER_MODE_REPEAT, profile_empty_callback, NULL);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+  mock_bsp_set_ticks(10);
+  safetimer_process();
+  mock_bsp_set_cycle_step(0);
+
+  sites = 0;
+  for (site = safetimer_crit_first_site(); site != NULL; site = site->next) {
+    if (site->max_cycles != 0) { /* Reset 0: earlier tests' sites */
+      TEST_ASSERT_TRUE(profile_is_core_site(site));
+      TEST_ASSERT_EQUAL_UINT32(5, site->max_cycles);
+      sites++;
+    }
+  }
+  TEST_ASSERT_TRUE(sites >= 3); /* create + start + process at least */
+
+  TEST_ASSERT_EQUAL_UINT32(5, safetimer_get_crit_api_max(SAFETIMER_API_CREATE));
+  TEST_ASSERT_EQUAL_UINT32(5, safetimer_get_crit_api_max(SAFETIMER_API_START));
+  TEST_ASSERT_EQUAL_UINT32(5,
+                           safetimer_get_crit_api_max(SAFETIMER_API_PROCESS));
+  TEST_ASSERT_EQUAL_UINT32(0,
+                           safetimer_get_crit_api_max(SAFETIMER_API_TRIGGER));
+  TEST_ASSERT_EQUAL_UINT32(0, safetimer_get_crit_api_max(SAFETIMER_API_COUNT));
+
+  site = safetimer_crit_first_site();
+  safetimer_reset_crit_profile();
+  TEST_ASSERT_EQUAL_PTR(site, safetimer_crit_first_site());
+  for (; site != NULL; site = site->next) {
+    TEST_ASSERT_EQUAL_UINT32(0, site->max_cycles);
+  }
+  TEST_ASSERT_EQUAL_UINT32(0, safetimer_get_crit_api_max(SAFETIMER_API_START));
+}
+
+/**
+ * Test: callback calling safetimer_get_status() during a pass, with 1-cycle
+ *       sections inside the callback and 7-cycle sections around it
+ * Verify: the query's sections count towards QUERY, the pass's sections
+ *         after the callback still count towards PROCESS
+ */
+void test_crit_profile_callback_attribution(void) {
+  g_probe_handle = safetimer_create(10, TIMER_MODE_REPEAT,
+                                    profile_query_callback, NULL);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(g_probe_handle));
+
+  safetimer_reset_crit_profile();
+  mock_bsp_set_cycle_step(7);
+  mock_bsp_set_ticks(10);
+  safetimer_process();
+  mock_bsp_set_cycle_step(0);
+
+  TEST_ASSERT_EQUAL_UINT32(1, safetimer_get_crit_api_max(SAFETIMER_API_QUERY));
+  TEST_ASSERT_EQUAL_UINT32(7,
+                           safetimer_get_crit_api_max(SAFETIMER_API_PROCESS));
+}
+
+/**
+ * Test: external section through safetimer_crit_enter() / _exit(), 40
+ *       cycles long
+ * Verify: site registered once at the list head with its file and line,
+ *         counted towards SEM, critical section balanced
+ */
+void test_crit_profile_external_site(void) {
+  static safetimer_crit_site_t site = SAFETIMER_CRIT_SITE_INIT;
+  const safetimer_crit_site_t *head;
+
+  safetimer_reset_crit_profile();
+  safetimer_crit_enter(&site);
+  TEST_ASSERT_EQUAL_INT(1, mock_bsp_get_critical_nesting());
+  mock_bsp_advance_cycles(40);
+  safetimer_crit_exit();
+
+  head = safetimer_crit_first_site();
+  TEST_ASSERT_EQUAL_PTR(&site, head);
+  TEST_ASSERT_EQUAL_STRING(__FILE__, head->file);
+  TEST_ASSERT_TRUE(head->line > 0);
+  TEST_ASSERT_EQUAL_UINT32(40, head->max_cycles);
+  TEST_ASSERT_EQUAL_UINT32(40, safetimer_get_crit_api_max(SAFETIMER_API_SEM));
+
+  safetimer_crit_enter(&site); /* Shorter run keeps the maximum */
+  mock_bsp_advance_cycles(3);
+  safetimer_crit_exit();
+  TEST_ASSERT_EQUAL_PTR(&site, safetimer_crit_first_site());
+  TEST_ASSERT_EQUAL_UINT32(40, site.max_cycles);
+}
+
+#endif /* SAFETIMER_ENABLE_CRIT_PROFILE */
@@ -31,6 +31,10 @@ void test_maximum_period(void) {
   safetimer_handle_t h;
   uint32_t max_period = 0x7FFFFFFFUL; /* 2^31 - 1 */
 
+  if (!SAFETIMER_PERIOD_FITS(max_period)) {
+    TEST_IGNORE_MESSAGE("Period not accepted by this slot layout");
+  }
+
   h = safetimer_create(max_period, TIMER_MODE_ONE_SHOT, NULL, NULL);
   TEST_ASSERT_NOT_EQUAL(SAFETIMER_INVALID_HANDLE, h);
 
@@ -44,16 +48,24 @@ void test_maximum_period(void) {
 }
 
 void test_period_exceeds_maximum_should_fail(void) {
+#if ENABLE_PARAM_CHECK
   safetimer_handle_t h;
   uint32_t invalid_period = 0x80000000UL; /* 2^31 */
 
   h = safetimer_create(invalid_period, TIMER_MODE_ONE_SHOT, NULL, NULL);
   TEST_ASSERT_EQUAL(SAFETIMER_INVALID_HANDLE, h);
+#else
+  TEST_IGNORE_MESSAGE("Requires ENABLE_PARAM_CHECK=1");
+#endif
 }
 
 void test_minimum_period(void) {
   safetimer_handle_t h;
 
+  if (!SAFETIMER_PERIOD_FITS(1UL)) {
+    TEST_IGNORE_MESSAGE("Period not accepted by this slot layout");
+  }
+
   h = safetimer_create(1, TIMER_MODE_ONE_SHOT, NULL, NULL);
   TEST_ASSERT_NOT_EQUAL(SAFETIMER_INVALID_HANDLE, h);
 
@@ -99,6 +111,7 @@ void test_expired_but_not_processed_returns_zero_remaining(void) {
 /* ========== NULL Pointer Tests ========== */
 
 void test_get_status_with_null_output_pointer(void) {
+#if ENABLE_PARAM_CHECK
   safetimer_handle_t h;
   timer_error_t err;
 
@@ -106,9 +119,13 @@ void test_get_status_with_null_output_pointer(void) {
 
   err = safetimer_get_status(h, NULL);
   TEST_ASSERT_EQUAL(TIMER_ERR_INVALID, err);
+#else
+  TEST_IGNORE_MESSAGE("Requires ENABLE_PARAM_CHECK=1");
+#endif
 }
 
 void test_get_remaining_with_null_output_pointer(void) {
+#if ENABLE_PARAM_CHECK
   safetimer_handle_t h;
   timer_error_t err;
 
@@ -116,6 +133,9 @@ void test_get_remaining_with_null_output_pointer(void) {
 
   err = safetimer_get_remaining(h, NULL);
   TEST_ASSERT_EQUAL(TIMER_ERR_INVALID, err);
+#else
+  TEST_IGNORE_MESSAGE("Requires ENABLE_PARAM_CHECK=1");
+#endif
 }
 
 void test_get_pool_usage_with_null_pointers(void) {
@@ -138,31 +158,51 @@ void test_get_pool_usage_with_null_pointers(void) {
 /* ========== Invalid Parameter Tests ========== */
 
 void test_create_with_invalid_mode(void) {
+#if ENABLE_PARAM_CHECK
   safetimer_handle_t h;
 
   h = safetimer_create(1000, 99, NULL, NULL); /* Invalid mode */
   TEST_ASSERT_EQUAL(SAFETIMER_INVALID_HANDLE, h);
+#else
+  TEST_IGNORE_MESSAGE("Requires ENABLE_PARAM_CHECK=1");
+#endif
 }
 
 void test_start_with_invalid_handle_negative(void) {
+#if ENABLE_PARAM_CHECK
   timer_error_t err = safetimer_start(-1);
   TEST_ASSERT_EQUAL(TIMER_ERR_INVALID, err);
+#else
+  TEST_IGNORE_MESSAGE("Requires ENABLE_PARAM_CHECK=1");
+#endif
 }
 
 void test_start_with_invalid_handle_out_of_range(void) {
+#if ENABLE_PARAM_CHECK
   timer_error_t err = safetimer_start(MAX_TIMERS);
   TEST_ASSERT_EQUAL(TIMER_ERR_INVALID, err);
+#else
+  TEST_IGNORE_MESSAGE("Requires ENABLE_PARAM_CHECK=1");
+#endif
 }
 
 void test_stop_unallocated_timer(void) {
+#if ENABLE_PARAM_CHECK
   /* Try to stop a never-allocated handle */
   timer_error_t err = safetimer_stop(0); /* Handle 0 not allocated */
   TEST_ASSERT_EQUAL(TIMER_ERR_INVALID, err);
+#else
+  TEST_IGNORE_MESSAGE("Requires ENABLE_PARAM_CHECK=1");
+#endif
 }
 
 void test_delete_unallocated_timer(void) {
+#if ENABLE_PARAM_CHECK
   timer_error_t err = safetimer_delete(0); /* Handle 0 not allocated */
   TEST_ASSERT_EQUAL(TIMER_ERR_INVALID, err);
+#else
+  TEST_IGNORE_MESSAGE("Requires ENABLE_PARAM_CHECK=1");
+#endif
 }
 
 /* ========== Rapid Operations Tests ========== */
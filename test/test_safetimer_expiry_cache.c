@@ -0,0 +1,160 @@
+/**
+ * @file    test_safetimer_expiry_cache.c
+ * @brief   Unit tests for the earliest-deadline cache in safetimer_process()
+ * @version 1.0.0
+ * @date    2026-10-14
+ *
+ * Tests that idle passes return after one tick compare and that every
+ * mutating API keeps the cached deadline exact.
+ */
+
+#include "mock_bsp.h"
+#include "safetimer.h"
+#include "unity.h"
+
+/* External test helper from safetimer.c */
+#ifdef UNIT_TEST
+extern void safetimer_test_reset_pool(void);
+#endif
+
+/* ========== Test Data ========== */
+
+static int g_cache_fire_count = 0;
+
+static void cache_callback(void *user_data) {
+  int *counter = (int *)user_data;
+  if (counter != NULL) {
+    (*counter)++;
+  }
+  g_cache_fire_count++;
+}
+
+/* ========== Test Cases ========== */
+
+/**
+ * Test: idle passes cost a single critical section
+ * Verify: once the cache is built, process() skips the slot scan
+ */
+void test_expiry_cache_idle_pass_skips_scan(void) {
+  mock_bsp_stats_t stats;
+  safetimer_handle_t h;
+  int i;
+
+  g_cache_fire_count = 0;
+  h = safetimer_create(1000, TIMER_MODE_REPEAT, cache_callback, NULL);
+  TEST_ASSERT_NOT_EQUAL(SAFETIMER_INVALID_HANDLE, h);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+
+  /* First pass rebuilds the cache */
+  mock_bsp_advance_time(10);
+  safetimer_process();
+#if SAFETIMER_ENGINE == SAFETIMER_ENGINE_WHEEL
+  /* Wheel passes leave the cache stale: rebuild it by query */
+  safetimer_get_next_expiry();
+#endif
+
+  mock_bsp_reset_stats();
+  for (i = 0; i < 100; i++) {
+    mock_bsp_advance_time(1);
+    safetimer_process();
+  }
+  mock_bsp_get_stats(&stats);
+
+#if SAFETIMER_ENABLE_ATOMICS && SAFETIMER_ENGINE == SAFETIMER_ENGINE_BITMAP
+  /* Atomic cache fields: the compare itself needs no lock */
+  TEST_ASSERT_EQUAL_UINT32(0, stats.enter_critical_count);
+#else
+  TEST_ASSERT_EQUAL_UINT32(100, stats.enter_critical_count);
+#endif
+  TEST_ASSERT_EQUAL_INT(0, g_cache_fire_count);
+}
+
+/**
+ * Test: starting an earlier timer lowers the cached deadline
+ * Verify: a timer armed after the cache was built is not skipped
+ */
+void test_expiry_cache_start_lowers_deadline(void) {
+  safetimer_handle_t slow, fast;
+  int fast_count = 0;
+
+  if (!SAFETIMER_PERIOD_FITS(5000UL) || !SAFETIMER_PERIOD_FITS(50UL)) {
+    TEST_IGNORE_MESSAGE("Period not accepted by this slot layout");
+  }
+
+  g_cache_fire_count = 0;
+  slow = safetimer_create(5000, TIMER_MODE_REPEAT, cache_callback, NULL);
+  fast = safetimer_create(50, TIMER_MODE_ONE_SHOT, cache_callback, &fast_count);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(slow));
+
+  safetimer_process(); /* Cache now holds tick 5000 */
+
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(fast));
+  mock_bsp_advance_time(50);
+  safetimer_process();
+
+  TEST_ASSERT_EQUAL_INT(1, fast_count);
+  TEST_ASSERT_EQUAL_INT(1, g_cache_fire_count);
+}
+
+/**
+ * Test: stopping the earliest timer invalidates the cache
+ * Verify: the next deadline still fires on time
+ */
+void test_expiry_cache_stop_earliest_rescans(void) {
+  safetimer_handle_t first, second;
+  int second_count = 0;
+
+  if (SAFETIMER_COMPACT_SLOTS == 2) {
+    TEST_IGNORE_MESSAGE("Requires user_data (SAFETIMER_COMPACT_SLOTS=2)");
+  }
+
+  first = safetimer_create(100, TIMER_MODE_ONE_SHOT, cache_callback, NULL);
+  second =
+      safetimer_create(200, TIMER_MODE_ONE_SHOT, cache_callback, &second_count);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(first));
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(second));
+
+  safetimer_process(); /* Cache now holds tick 100 */
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_stop(first));
+
+  mock_bsp_set_ticks(199);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(0, second_count);
+
+  mock_bsp_set_ticks(200);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(1, second_count);
+}
+
+/**
+ * Test: set_period() on a running timer moves the cached deadline
+ * Verify: both shortening and lengthening are honoured
+ */
+void test_expiry_cache_follows_set_period(void) {
+  safetimer_handle_t h;
+  int count = 0;
+
+  if (SAFETIMER_COMPACT_SLOTS == 2) {
+    TEST_IGNORE_MESSAGE("Requires user_data (SAFETIMER_COMPACT_SLOTS=2)");
+  }
+
+  h = safetimer_create(1000, TIMER_MODE_REPEAT, cache_callback, &count);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+  safetimer_process();
+
+  /* Shorten: 0 + 100 */
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_set_period(h, 100));
+  mock_bsp_set_ticks(100);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(1, count);
+
+  /* Lengthen: 100 + 500 */
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_set_period(h, 500));
+  mock_bsp_set_ticks(200);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(1, count);
+
+  mock_bsp_set_ticks(600);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(2, count);
+}
@@ -0,0 +1,151 @@
+/**
+ * @file    test_safetimer_flag.c
+ * @brief   Unit tests for callback-free flag timers
+ * @version 1.0.0
+ * @date    2026-10-14
+ *
+ * Tests that flag timers only set their bit in the expired bitmap, that
+ * safetimer_poll_expired() fetches and clears it, that a flag expiry skips
+ * the callback re-validation critical section, and that a deleted timer
+ * leaves no pending bit (SAFETIMER_ENABLE_FLAG_TIMERS).
+ */
+
+#include "mock_bsp.h"
+#include "safetimer.h"
+#include "unity.h"
+
+/* External test helper from safetimer.c */
+#ifdef UNIT_TEST
+extern void safetimer_test_reset_pool(void);
+#endif
+
+#if SAFETIMER_ENABLE_FLAG_TIMERS
+
+/* ========== Test Data ========== */
+
+static int g_flag_calls = 0;
+
+static void flag_callback(void *user_data) {
+  (void)user_data;
+  g_flag_calls++;
+}
+
+/* Critical sections of the pass at tick 10 firing one 10 ms timer */
+static unsigned long flag_pass_cost(uint8_t use_flag) {
+  safetimer_handle_t h;
+  mock_bsp_stats_t stats;
+
+  safetimer_test_reset_pool();
+  mock_bsp_reset();
+  if (use_flag) {
+    h = safetimer_create_flag(10, TIMER_MODE_REPEAT);
+  } else {
+    h = safetimer_create(10, TIMER_MODE_REPEAT, flag_callback, NULL);
+  }
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+
+  mock_bsp_set_ticks(10);
+  mock_bsp_reset_stats();
+  safetimer_process();
+  mock_bsp_get_stats(&stats);
+  return stats.enter_critical_count;
+}
+
+/* ========== Test Cases ========== */
+
+/**
+ * Test: REPEAT flag (10 ms), ONE_SHOT flag (25 ms) and a callback timer
+ *       (10 ms), polled at tick 10 and tick 25
+ * Verify: only flag bits reported, poll clears them, callback timer still
+ *         called and never reported
+ */
+void test_flag_timer_sets_bit_without_callback(void) {
+  safetimer_bitmap_t fired[BITMAP_WORDS];
+  safetimer_handle_t a, b, c;
+  int running = 1;
+
+  if (!SAFETIMER_PERIOD_FITS(25UL)) {
+    TEST_IGNORE_MESSAGE("Period not accepted by this slot layout");
+  }
+  g_flag_calls = 0;
+  a = safetimer_create_flag(10, TIMER_MODE_REPEAT);
+  b = safetimer_create_flag(25, TIMER_MODE_ONE_SHOT);
+  c = safetimer_create(10, TIMER_MODE_REPEAT, flag_callback, NULL);
+  TEST_ASSERT_NOT_EQUAL(SAFETIMER_INVALID_HANDLE, a);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(a));
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(b));
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(c));
+
+  TEST_ASSERT_EQUAL(TIMER_ERR_NOT_FOUND, safetimer_poll_expired(fired));
+
+  mock_bsp_set_ticks(10);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(1, g_flag_calls);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_poll_expired(fired));
+  TEST_ASSERT_TRUE(SAFETIMER_EXPIRED(fired, a));
+  TEST_ASSERT_FALSE(SAFETIMER_EXPIRED(fired, b));
+  TEST_ASSERT_FALSE(SAFETIMER_EXPIRED(fired, c));
+  TEST_ASSERT_EQUAL(TIMER_ERR_NOT_FOUND, safetimer_poll_expired(fired));
+
+  mock_bsp_set_ticks(25);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(2, g_flag_calls);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_poll_expired(fired));
+  TEST_ASSERT_TRUE(SAFETIMER_EXPIRED(fired, a));
+  TEST_ASSERT_TRUE(SAFETIMER_EXPIRED(fired, b));
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_get_status(b, &running));
+  TEST_ASSERT_EQUAL_INT(0, running); /* ONE_SHOT stopped as usual */
+}
+
+/**
+ * Test: same pass firing one callback timer, then one flag timer
+ * Verify: the flag expiry saves the callback re-validation critical
+ *         section (snapshot dispatch has none to save)
+ */
+void test_flag_timer_skips_callback_section(void) {
+  unsigned long cost_callback;
+  unsigned long cost_flag;
+
+  cost_callback = flag_pass_cost(0);
+  cost_flag = flag_pass_cost(1);
+
+#if SAFETIMER_PROCESS_SNAPSHOT
+  TEST_ASSERT_EQUAL_UINT32(cost_callback, cost_flag);
+#else
+  TEST_ASSERT_EQUAL_UINT32(cost_callback - 1UL, cost_flag);
+#endif
+}
+
+/**
+ * Test: flag timer fires, is deleted before the poll, slot reused by a
+ *       callback timer that fires
+ * Verify: no pending bit survives the delete, reused slot calls back
+ */
+void test_flag_timer_delete_drops_pending_bit(void) {
+  safetimer_bitmap_t fired[BITMAP_WORDS];
+  safetimer_handle_t h;
+
+  if (!SAFETIMER_PERIOD_FITS(5UL)) {
+    TEST_IGNORE_MESSAGE("Period not accepted by this slot layout");
+  }
+  g_flag_calls = 0;
+  h = safetimer_create_flag(5, TIMER_MODE_ONE_SHOT);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+  mock_bsp_set_ticks(5);
+  safetimer_process();
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_delete(h));
+  TEST_ASSERT_EQUAL(TIMER_ERR_NOT_FOUND, safetimer_poll_expired(fired));
+
+  h = safetimer_create(5, TIMER_MODE_ONE_SHOT, flag_callback, NULL);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+  mock_bsp_set_ticks(10);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(1, g_flag_calls);
+  TEST_ASSERT_EQUAL(TIMER_ERR_NOT_FOUND, safetimer_poll_expired(fired));
+
+#if ENABLE_PARAM_CHECK
+  TEST_ASSERT_EQUAL(TIMER_ERR_INVALID, safetimer_poll_expired(NULL));
+#endif
+}
+
+#endif /* SAFETIMER_ENABLE_FLAG_TIMERS */
@@ -0,0 +1,211 @@
+/**
+ * @file    test_safetimer_heap.c
+ * @brief   Unit tests for the min-heap engine (SAFETIMER_ENGINE_HEAP)
+ * @version 1.0.0
+ * @date    2026-10-14
+ *
+ * Behavioral tests run with every engine; the O(1) query check only applies
+ * to the heap.
+ */
+
+#include "mock_bsp.h"
+#include "safetimer.h"
+#include "unity.h"
+
+/* External test helper from safetimer.c */
+#ifdef UNIT_TEST
+extern void safetimer_test_reset_pool(void);
+#endif
+
+#define HEAP_TEST_TIMERS 4
+
+/* ========== Test Data ========== */
+
+static int g_heap_order[HEAP_TEST_TIMERS * 2];
+static int g_heap_order_len = 0;
+static int g_heap_ids[HEAP_TEST_TIMERS] = {0, 1, 2, 3};
+
+static void heap_order_callback(void *user_data) {
+  if (g_heap_order_len < HEAP_TEST_TIMERS * 2) {
+    g_heap_order[g_heap_order_len++] = *(int *)user_data;
+  }
+}
+
+/* Step the clock one tick at a time up to end_tick */
+static void heap_run_until(bsp_tick_t end_tick) {
+  while (bsp_get_ticks() != end_tick) {
+    mock_bsp_advance_time(1);
+    safetimer_process();
+  }
+}
+
+static void heap_reset_order(void) {
+  int i;
+  for (i = 0; i < HEAP_TEST_TIMERS * 2; i++) {
+    g_heap_order[i] = -1;
+  }
+  g_heap_order_len = 0;
+}
+
+/* ========== Test Cases ========== */
+
+/**
+ * Test: deadlines created in reverse slot order
+ * Verify: timers fire in deadline order, each exactly on time
+ */
+void test_heap_fires_in_deadline_order(void) {
+  safetimer_handle_t h;
+  int i;
+
+  if (SAFETIMER_COMPACT_SLOTS == 2) {
+    TEST_IGNORE_MESSAGE("Requires user_data (SAFETIMER_COMPACT_SLOTS=2)");
+  }
+
+  heap_reset_order();
+  for (i = 0; i < HEAP_TEST_TIMERS; i++) {
+    h = safetimer_create((uint32_t)(400 - i * 100), TIMER_MODE_ONE_SHOT,
+                         heap_order_callback, &g_heap_ids[i]);
+    TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+  }
+
+  heap_run_until(99);
+  TEST_ASSERT_EQUAL_INT(0, g_heap_order_len);
+
+  heap_run_until(400);
+  TEST_ASSERT_EQUAL_INT(HEAP_TEST_TIMERS, g_heap_order_len);
+  for (i = 0; i < HEAP_TEST_TIMERS; i++) {
+    TEST_ASSERT_EQUAL_INT(HEAP_TEST_TIMERS - 1 - i, g_heap_order[i]);
+  }
+  TEST_ASSERT_EQUAL_UINT32(SAFETIMER_NO_EXPIRY, safetimer_get_next_expiry());
+}
+
+/**
+ * Test: set_period() and advance_period() on running timers
+ * Verify: the moved entry is re-ordered (earlier and later)
+ */
+void test_heap_period_changes_reorder(void) {
+  safetimer_handle_t a, b, c;
+
+  if (SAFETIMER_COMPACT_SLOTS == 2) {
+    TEST_IGNORE_MESSAGE("Requires user_data (SAFETIMER_COMPACT_SLOTS=2)");
+  }
+
+  heap_reset_order();
+  a = safetimer_create(100, TIMER_MODE_ONE_SHOT, heap_order_callback,
+                       &g_heap_ids[0]);
+  b = safetimer_create(200, TIMER_MODE_ONE_SHOT, heap_order_callback,
+                       &g_heap_ids[1]);
+  c = safetimer_create(300, TIMER_MODE_ONE_SHOT, heap_order_callback,
+                       &g_heap_ids[2]);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(a));
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(b));
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(c));
+
+  /* c: 300 -> 50 (moves to the root), a: 100 -> 0 + 400 (moves back) */
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_set_period(c, 50));
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_advance_period(a, 400));
+  TEST_ASSERT_EQUAL_UINT32(50, safetimer_get_next_expiry());
+
+  heap_run_until(399);
+  TEST_ASSERT_EQUAL_INT(2, g_heap_order_len);
+  TEST_ASSERT_EQUAL_INT(2, g_heap_order[0]);
+  TEST_ASSERT_EQUAL_INT(1, g_heap_order[1]);
+
+  heap_run_until(400);
+  TEST_ASSERT_EQUAL_INT(3, g_heap_order_len);
+  TEST_ASSERT_EQUAL_INT(0, g_heap_order[2]);
+}
+
+/**
+ * Test: stop and delete entries from the middle of the order
+ * Verify: remaining timers keep their deadlines and order
+ */
+void test_heap_remove_middle_keeps_order(void) {
+  safetimer_handle_t h[HEAP_TEST_TIMERS];
+  int i;
+
+  if (SAFETIMER_COMPACT_SLOTS == 2) {
+    TEST_IGNORE_MESSAGE("Requires user_data (SAFETIMER_COMPACT_SLOTS=2)");
+  }
+
+  heap_reset_order();
+  for (i = 0; i < HEAP_TEST_TIMERS; i++) {
+    h[i] = safetimer_create((uint32_t)(100 + i * 100), TIMER_MODE_REPEAT,
+                            heap_order_callback, &g_heap_ids[i]);
+    TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h[i]));
+  }
+
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_stop(h[1]));
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_delete(h[2]));
+
+  heap_run_until(400);
+  TEST_ASSERT_EQUAL_INT(5, g_heap_order_len); /* 0@100,200,300,400 3@400 */
+  TEST_ASSERT_EQUAL_INT(0, g_heap_order[0]);
+  TEST_ASSERT_EQUAL_INT(0, g_heap_order[3]);
+  TEST_ASSERT_EQUAL_INT(3, g_heap_order[4]);
+
+  /* Restarted timer is re-inserted from the current tick */
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h[1]));
+  TEST_ASSERT_EQUAL_UINT32(100, safetimer_get_next_expiry());
+}
+
+/**
+ * Test: deadlines on both sides of the tick wraparound
+ * Verify: ordering uses wrap-safe tick differences, not raw values
+ */
+void test_heap_order_across_wraparound(void) {
+  safetimer_handle_t before, after;
+
+  if (SAFETIMER_COMPACT_SLOTS == 2) {
+    TEST_IGNORE_MESSAGE("Requires user_data (SAFETIMER_COMPACT_SLOTS=2)");
+  }
+
+  heap_reset_order();
+  mock_bsp_set_ticks((bsp_tick_t)(0U - 100U));
+
+  after = safetimer_create(150, TIMER_MODE_ONE_SHOT, heap_order_callback,
+                           &g_heap_ids[0]);
+  before = safetimer_create(50, TIMER_MODE_ONE_SHOT, heap_order_callback,
+                            &g_heap_ids[1]);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(after));
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(before));
+  TEST_ASSERT_EQUAL_UINT32(50, safetimer_get_next_expiry());
+
+  heap_run_until((bsp_tick_t)50U);
+  TEST_ASSERT_EQUAL_INT(2, g_heap_order_len);
+  TEST_ASSERT_EQUAL_INT(1, g_heap_order[0]);
+  TEST_ASSERT_EQUAL_INT(0, g_heap_order[1]);
+}
+
+/**
+ * Test: next-expiry query with a full pool of running timers
+ * Verify: correct minimum; heap engine answers in one critical section
+ */
+void test_heap_next_expiry_full_pool(void) {
+  safetimer_handle_t h;
+  mock_bsp_stats_t stats;
+  int i;
+
+  if (!SAFETIMER_PERIOD_FITS(1001UL)) {
+    TEST_IGNORE_MESSAGE("Period not accepted by this slot layout");
+  }
+
+  for (i = 0; i < SAFETIMER_RUNTIME_TIMERS; i++) {
+    /* Earliest deadline lands in the middle of the pool */
+    h = safetimer_create(
+        (uint32_t)(i == SAFETIMER_RUNTIME_TIMERS / 2 ? 1000 : 1001 + i),
+        TIMER_MODE_REPEAT, heap_order_callback, NULL);
+    TEST_ASSERT_NOT_EQUAL(SAFETIMER_INVALID_HANDLE, h);
+    TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+  }
+
+#if SAFETIMER_ENGINE == SAFETIMER_ENGINE_HEAP
+  mock_bsp_reset_stats();
+  TEST_ASSERT_EQUAL_UINT32(1000, safetimer_get_next_expiry());
+  mock_bsp_get_stats(&stats);
+  TEST_ASSERT_EQUAL_UINT32(1, stats.enter_critical_count);
+#else
+  (void)stats;
+  TEST_ASSERT_EQUAL_UINT32(1000, safetimer_get_next_expiry());
+#endif
+}
@@ -24,6 +24,13 @@ void test_callback(void *user_data) {
   g_callback_count++;
 }
 
+/* Dispatch everything due now (SAFETIMER_SNAPSHOT_BATCH may split it) */
+static void process_all_due(void) {
+  do {
+    safetimer_process();
+  } while (safetimer_get_next_expiry() == 0);
+}
+
 /* ========== Test Cases ========== */
 
 /**
@@ -59,6 +66,7 @@ void test_create_started_success(void) {
  * @brief   Verify create_started fails gracefully with invalid parameters
  */
 void test_create_started_invalid_parameters(void) {
+#if ENABLE_PARAM_CHECK
   safetimer_handle_t h;
 
   /* Test with zero period (should fail) */
@@ -73,6 +81,9 @@ void test_create_started_invalid_parameters(void) {
   /* Test with invalid mode (should fail) */
   h = safetimer_create_started(1000, (timer_mode_t)99, test_callback, NULL);
   TEST_ASSERT_EQUAL(SAFETIMER_INVALID_HANDLE, h);
+#else
+  TEST_IGNORE_MESSAGE("Requires ENABLE_PARAM_CHECK=1");
+#endif
 }
 
 /**
@@ -80,23 +91,24 @@ void test_create_started_invalid_parameters(void) {
  * @brief   Verify create_started handles pool exhaustion correctly
  */
 void test_create_started_pool_exhaustion(void) {
-  safetimer_handle_t handles[MAX_TIMERS + 1];
+  safetimer_handle_t handles[SAFETIMER_RUNTIME_TIMERS + 1];
   int i;
 
   /* Fill pool */
-  for (i = 0; i < MAX_TIMERS; i++) {
+  for (i = 0; i < SAFETIMER_RUNTIME_TIMERS; i++) {
     handles[i] =
         safetimer_create_started(1000, TIMER_MODE_REPEAT, test_callback, NULL);
     TEST_ASSERT_NOT_EQUAL(SAFETIMER_INVALID_HANDLE, handles[i]);
   }
 
   /* Next creation should fail */
-  handles[MAX_TIMERS] =
+  handles[SAFETIMER_RUNTIME_TIMERS] =
       safetimer_create_started(1000, TIMER_MODE_REPEAT, test_callback, NULL);
-  TEST_ASSERT_EQUAL(SAFETIMER_INVALID_HANDLE, handles[MAX_TIMERS]);
+  TEST_ASSERT_EQUAL(SAFETIMER_INVALID_HANDLE,
+                    handles[SAFETIMER_RUNTIME_TIMERS]);
 
   /* Cleanup */
-  for (i = 0; i < MAX_TIMERS; i++) {
+  for (i = 0; i < SAFETIMER_RUNTIME_TIMERS; i++) {
     safetimer_delete(handles[i]);
   }
 }
@@ -132,6 +144,10 @@ void test_create_started_multiple_timers(void) {
   safetimer_handle_t h1, h2, h3;
   int counts[3] = {0, 0, 0};
 
+  if (SAFETIMER_COMPACT_SLOTS == 2) {
+    TEST_IGNORE_MESSAGE("Requires user_data (SAFETIMER_COMPACT_SLOTS=2)");
+  }
+
   /* Create three timers with different periods */
   h1 = safetimer_create_started(100, TIMER_MODE_REPEAT, test_callback,
                                 &counts[0]);
@@ -191,39 +207,39 @@ void test_create_started_batch_success(void) {
 
 /**
  * @test    test_create_started_batch_partial_failure
- * @brief   Verify batch creation handles partial failures correctly
+ * @brief   Verify a batch larger than the pool creates nothing (all-or-nothing)
  */
 void test_create_started_batch_partial_failure(void) {
-  safetimer_handle_t handles[MAX_TIMERS + 2];
-  timer_callback_t callbacks[MAX_TIMERS + 2];
-  void *data[MAX_TIMERS + 2];
+  safetimer_handle_t handles[SAFETIMER_RUNTIME_TIMERS + 2];
+  timer_callback_t callbacks[SAFETIMER_RUNTIME_TIMERS + 2];
+  void *data[SAFETIMER_RUNTIME_TIMERS + 2];
   int i;
 
   /* Fill callback arrays */
-  for (i = 0; i < MAX_TIMERS + 2; i++) {
+  for (i = 0; i < SAFETIMER_RUNTIME_TIMERS + 2; i++) {
     callbacks[i] = test_callback;
     data[i] = NULL;
   }
 
   /* Try to create more than pool capacity */
   int created = safetimer_create_started_batch(
-      MAX_TIMERS + 2, 500, TIMER_MODE_REPEAT, callbacks, data, handles);
-
-  /* Should only create MAX_TIMERS */
-  TEST_ASSERT_EQUAL_INT(MAX_TIMERS, created);
-
-  /* First MAX_TIMERS should be valid */
-  for (i = 0; i < MAX_TIMERS; i++) {
-    TEST_ASSERT_NOT_EQUAL(SAFETIMER_INVALID_HANDLE, handles[i]);
-  }
+      SAFETIMER_RUNTIME_TIMERS + 2, 500, TIMER_MODE_REPEAT, callbacks, data,
+      handles);
 
-  /* Remaining should be invalid */
-  for (i = MAX_TIMERS; i < MAX_TIMERS + 2; i++) {
+  /* Nothing created, every handle invalid */
+  TEST_ASSERT_EQUAL_INT(0, created);
+  for (i = 0; i < SAFETIMER_RUNTIME_TIMERS + 2; i++) {
     TEST_ASSERT_EQUAL(SAFETIMER_INVALID_HANDLE, handles[i]);
   }
 
+  /* No slot leaked: the full runtime capacity still fits */
+  created = safetimer_create_started_batch(SAFETIMER_RUNTIME_TIMERS, 500,
+                                           TIMER_MODE_REPEAT, callbacks, data,
+                                           handles);
+  TEST_ASSERT_EQUAL_INT(SAFETIMER_RUNTIME_TIMERS, created);
+
   /* Cleanup */
-  for (i = 0; i < MAX_TIMERS; i++) {
+  for (i = 0; i < SAFETIMER_RUNTIME_TIMERS; i++) {
     safetimer_delete(handles[i]);
   }
 }
@@ -301,6 +317,82 @@ void test_macro_create_started_or_failure(void) {
   }
 }
 
+/**
+ * @test    test_create_batch_phase_locked
+ * @brief   Verify a batch reads the tick once, locks once and fires together
+ */
+void test_create_batch_phase_locked(void) {
+  safetimer_handle_t handles[3];
+  timer_callback_t callbacks[] = {test_callback, test_callback, test_callback};
+  void *data[] = {NULL, NULL, NULL};
+  mock_bsp_stats_t stats;
+
+  mock_bsp_set_ticks(100);
+  mock_bsp_reset_stats();
+  TEST_ASSERT_EQUAL(TIMER_OK,
+                    safetimer_create_batch(3, 500, TIMER_MODE_REPEAT,
+                                           callbacks, data, NULL, handles));
+  mock_bsp_get_stats(&stats);
+  TEST_ASSERT_EQUAL_UINT32(1, stats.get_ticks_count);
+  TEST_ASSERT_EQUAL_UINT32(1, stats.enter_critical_count);
+
+  /* Same base tick: all three due in the same pass */
+  g_callback_count = 0;
+  mock_bsp_set_ticks(599);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(0, g_callback_count);
+  mock_bsp_set_ticks(600);
+  process_all_due();
+  TEST_ASSERT_EQUAL_INT(3, g_callback_count);
+}
+
+/**
+ * @test    test_create_batch_offsets
+ * @brief   Verify per-timer offsets stagger the deadlines and keep the phase
+ */
+void test_create_batch_offsets(void) {
+  safetimer_handle_t handles[3];
+  timer_callback_t callbacks[] = {test_callback, test_callback, test_callback};
+  void *data[] = {NULL, NULL, NULL};
+  const uint32_t stagger[3] = {0, 10, 20};
+  const uint32_t too_late[3] = {0, 10, 30};
+  int used = 0;
+
+  TEST_ASSERT_EQUAL(TIMER_OK,
+                    safetimer_create_batch(3, 30, TIMER_MODE_REPEAT, callbacks,
+                                           data, stagger, handles));
+
+  /* Deadlines 30/40/50, then 60/70/80: one expiry per 10 ms step */
+  g_callback_count = 0;
+  mock_bsp_set_ticks(30);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(1, g_callback_count);
+  mock_bsp_set_ticks(40);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(2, g_callback_count);
+  mock_bsp_set_ticks(50);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(3, g_callback_count);
+  mock_bsp_set_ticks(80);
+  process_all_due();
+  TEST_ASSERT_EQUAL_INT(6, g_callback_count);
+  TEST_ASSERT_EQUAL_UINT32(10, safetimer_get_next_expiry());
+
+#if ENABLE_PARAM_CHECK
+  /* Offset must stay below the period; nothing created on rejection */
+  safetimer_test_reset_pool();
+  TEST_ASSERT_EQUAL(TIMER_ERR_INVALID,
+                    safetimer_create_batch(3, 30, TIMER_MODE_REPEAT, callbacks,
+                                           data, too_late, handles));
+  TEST_ASSERT_EQUAL(SAFETIMER_INVALID_HANDLE, handles[0]);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_get_pool_usage(&used, NULL));
+  TEST_ASSERT_EQUAL_INT(SAFETIMER_STATIC_TIMERS, used);
+#else
+  (void)too_late;
+  (void)used;
+#endif
+}
+
 /* ========== End of Tests ========== */
 
 /**
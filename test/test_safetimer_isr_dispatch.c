@@ -0,0 +1,131 @@
+/**
+ * @file    test_safetimer_isr_dispatch.c
+ * @brief   Unit tests for ISR expiry detection (safetimer_dispatch_ready())
+ * @version 1.0.0
+ * @date    2026-10-14
+ *
+ * Tests that safetimer_dispatch_ready() stays idle until the tick ISR
+ * (safetimer_isr_detect()) sees a due deadline, and then dispatches it.
+ */
+
+#include "mock_bsp.h"
+#include "safetimer.h"
+#include "unity.h"
+
+/* External test helper from safetimer.c */
+#ifdef UNIT_TEST
+extern void safetimer_test_reset_pool(void);
+#endif
+
+#if SAFETIMER_ENABLE_ISR_DISPATCH
+
+/* ========== Test Data ========== */
+
+static int g_dispatch_fire_count = 0;
+
+static void dispatch_callback(void *user_data) {
+  (void)user_data;
+  g_dispatch_fire_count++;
+}
+
+/* One simulated 1ms tick: increment, then the ISR-side detection */
+static void dispatch_tick(void) {
+  mock_bsp_advance_time(1);
+  safetimer_isr_detect();
+}
+
+/* ========== Test Cases ========== */
+
+/**
+ * Test: dispatch_ready() without any detection
+ * Verify: no critical section, no callback
+ */
+void test_isr_dispatch_idle_without_detect(void) {
+  mock_bsp_stats_t stats;
+  safetimer_handle_t h;
+
+  g_dispatch_fire_count = 0;
+  h = safetimer_create(10, TIMER_MODE_ONE_SHOT, dispatch_callback, NULL);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+  mock_bsp_advance_time(10); /* Due, but the ISR never looked */
+
+  mock_bsp_reset_stats();
+  safetimer_dispatch_ready();
+  mock_bsp_get_stats(&stats);
+
+  TEST_ASSERT_EQUAL_UINT32(0, stats.enter_critical_count);
+  TEST_ASSERT_EQUAL_INT(0, g_dispatch_fire_count);
+}
+
+/**
+ * Test: 50 ms timer, tick ISR detection + dispatch_ready() every tick
+ * Verify: ticks 1..49 only take the detection lock, the timer fires at 50
+ */
+void test_isr_dispatch_fires_on_deadline(void) {
+  mock_bsp_stats_t stats;
+  safetimer_handle_t h;
+  int i;
+
+  g_dispatch_fire_count = 0;
+  h = safetimer_create(50, TIMER_MODE_ONE_SHOT, dispatch_callback, NULL);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+  safetimer_process(); /* Builds the earliest-deadline cache */
+
+  mock_bsp_reset_stats();
+  for (i = 1; i < 50; i++) {
+    dispatch_tick();
+    safetimer_dispatch_ready();
+  }
+  mock_bsp_get_stats(&stats);
+  TEST_ASSERT_EQUAL_INT(0, g_dispatch_fire_count);
+  TEST_ASSERT_EQUAL_UINT32(49, stats.enter_critical_count);
+
+  dispatch_tick();
+  safetimer_dispatch_ready();
+  TEST_ASSERT_EQUAL_INT(1, g_dispatch_fire_count);
+
+  /* Flag consumed: next call is idle again */
+  mock_bsp_reset_stats();
+  safetimer_dispatch_ready();
+  mock_bsp_get_stats(&stats);
+  TEST_ASSERT_EQUAL_UINT32(0, stats.enter_critical_count);
+}
+
+/**
+ * Test: REPEAT timer driven only by detection + dispatch_ready()
+ * Verify: fires once per period
+ */
+void test_isr_dispatch_repeat_period(void) {
+  safetimer_handle_t h;
+  int i;
+
+  g_dispatch_fire_count = 0;
+  h = safetimer_create(20, TIMER_MODE_REPEAT, dispatch_callback, NULL);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+
+  for (i = 0; i < 100; i++) {
+    dispatch_tick();
+    safetimer_dispatch_ready();
+  }
+  TEST_ASSERT_EQUAL_INT(5, g_dispatch_fire_count);
+}
+
+#if SAFETIMER_ENABLE_ISR_QUEUE
+/**
+ * Test: timer started from an ISR, no tick detection
+ * Verify: the queued command requests a pass by itself
+ */
+void test_isr_dispatch_queue_sets_ready(void) {
+  safetimer_handle_t h;
+  int running = 0;
+
+  h = safetimer_create(100, TIMER_MODE_ONE_SHOT, dispatch_callback, NULL);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start_from_isr(h));
+
+  safetimer_dispatch_ready();
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_get_status(h, &running));
+  TEST_ASSERT_EQUAL_INT(1, running);
+}
+#endif /* SAFETIMER_ENABLE_ISR_QUEUE */
+
+#endif /* SAFETIMER_ENABLE_ISR_DISPATCH */
@@ -0,0 +1,136 @@
+/**
+ * @file    test_safetimer_isr_queue.c
+ * @brief   Unit tests for the ISR command queue (*_from_isr() APIs)
+ * @version 1.0.0
+ * @date    2026-10-14
+ *
+ * Tests that ISR-side commands never enter a critical section, are applied
+ * in order by the next safetimer_process() pass, and count from the ISR
+ * tick.
+ */
+
+#include "mock_bsp.h"
+#include "safetimer.h"
+#include "unity.h"
+
+/* External test helper from safetimer.c */
+#ifdef UNIT_TEST
+extern void safetimer_test_reset_pool(void);
+#endif
+
+#if SAFETIMER_ENABLE_ISR_QUEUE
+
+/* ========== Test Data ========== */
+
+static int g_isr_fire_count = 0;
+
+static void isr_queue_callback(void *user_data) {
+  (void)user_data;
+  g_isr_fire_count++;
+}
+
+/* ========== Test Cases ========== */
+
+/**
+ * Test: start queued from an ISR at tick 10, applied at tick 50
+ * Verify: no critical section in the ISR, deadline counts from tick 10
+ */
+void test_isr_queue_start_uses_isr_tick(void) {
+  mock_bsp_stats_t stats;
+  safetimer_handle_t h;
+  int running = 0;
+
+  g_isr_fire_count = 0;
+  h = safetimer_create(100, TIMER_MODE_ONE_SHOT, isr_queue_callback, NULL);
+  TEST_ASSERT_NOT_EQUAL(SAFETIMER_INVALID_HANDLE, h);
+
+  mock_bsp_set_ticks(10);
+  mock_bsp_reset_stats();
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start_from_isr(h));
+  mock_bsp_get_stats(&stats);
+  TEST_ASSERT_EQUAL_UINT32(0, stats.enter_critical_count);
+
+  /* Not applied before the next pass */
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_get_status(h, &running));
+  TEST_ASSERT_EQUAL_INT(0, running);
+
+  mock_bsp_set_ticks(50);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_UINT32(60, safetimer_get_next_expiry());
+
+  mock_bsp_set_ticks(110);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(1, g_isr_fire_count);
+}
+
+/**
+ * Test: fill the ring without a process pass
+ * Verify: SIZE-1 commands fit, the next one is rejected until drained
+ */
+void test_isr_queue_full_ring(void) {
+  safetimer_handle_t h;
+  int i;
+
+  h = safetimer_create(100, TIMER_MODE_REPEAT, isr_queue_callback, NULL);
+  for (i = 0; i < SAFETIMER_ISR_QUEUE_SIZE - 1; i++) {
+    TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start_from_isr(h));
+  }
+  TEST_ASSERT_EQUAL(TIMER_ERR_FULL, safetimer_start_from_isr(h));
+#if ENABLE_PARAM_CHECK
+  TEST_ASSERT_EQUAL(TIMER_ERR_INVALID,
+                    safetimer_start_from_isr(SAFETIMER_INVALID_HANDLE));
+#endif
+
+  safetimer_process();
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start_from_isr(h));
+}
+
+/**
+ * Test: start, set_period, stop queued back to back, then delete
+ * Verify: commands are applied in queue order
+ */
+void test_isr_queue_applies_in_order(void) {
+  safetimer_handle_t h;
+  int running = 1;
+  uint32_t remaining = 0;
+
+  h = safetimer_create(100, TIMER_MODE_REPEAT, isr_queue_callback, NULL);
+
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start_from_isr(h));
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_set_period_from_isr(h, 300));
+  safetimer_process();
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_get_remaining(h, &remaining));
+  TEST_ASSERT_EQUAL_UINT32(300, remaining);
+
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_stop_from_isr(h));
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_delete_from_isr(h));
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_get_status(h, &running));
+  TEST_ASSERT_EQUAL_INT(1, running); /* Still queued */
+
+  safetimer_process();
+#if ENABLE_PARAM_CHECK
+  TEST_ASSERT_EQUAL(TIMER_ERR_INVALID, safetimer_get_status(h, &running));
+#endif
+}
+
+/**
+ * Test: timer deleted and its slot reused before the queued start is applied
+ * Verify: the stale command is dropped (generation check)
+ */
+void test_isr_queue_drops_stale_handle(void) {
+  safetimer_handle_t old_h, new_h;
+  int running = 1;
+
+  old_h = safetimer_create(100, TIMER_MODE_REPEAT, isr_queue_callback, NULL);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start_from_isr(old_h));
+
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_delete(old_h));
+  new_h = safetimer_create(100, TIMER_MODE_REPEAT, isr_queue_callback, NULL);
+  TEST_ASSERT_NOT_EQUAL(old_h, new_h);
+
+  safetimer_process();
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_get_status(new_h, &running));
+  TEST_ASSERT_EQUAL_INT(0, running);
+}
+
+#endif /* SAFETIMER_ENABLE_ISR_QUEUE */
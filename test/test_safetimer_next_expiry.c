@@ -0,0 +1,119 @@
+/**
+ * @file    test_safetimer_next_expiry.c
+ * @brief   Unit tests for safetimer_get_next_expiry() API
+ * @version 1.0.0
+ * @date    2026-10-14
+ *
+ * Tests the soonest-deadline query used for low-power sleep decisions.
+ */
+
+#include "mock_bsp.h"
+#include "safetimer.h"
+#include "unity.h"
+
+/* External test helper from safetimer.c */
+#ifdef UNIT_TEST
+extern void safetimer_test_reset_pool(void);
+#endif
+
+/* ========== Test Cases ========== */
+
+/**
+ * Test: no active timers reports the sentinel
+ * Verify: created-but-stopped timers are ignored
+ */
+void test_next_expiry_no_active_timers(void) {
+  safetimer_handle_t h;
+
+  TEST_ASSERT_EQUAL_UINT32(SAFETIMER_NO_EXPIRY, safetimer_get_next_expiry());
+
+  h = safetimer_create(100, TIMER_MODE_ONE_SHOT, NULL, NULL);
+  TEST_ASSERT_NOT_EQUAL(SAFETIMER_INVALID_HANDLE, h);
+  TEST_ASSERT_EQUAL_UINT32(SAFETIMER_NO_EXPIRY, safetimer_get_next_expiry());
+}
+
+/**
+ * Test: returns ticks until the soonest of several deadlines
+ * Verify: value counts down with time and is independent of slot order
+ */
+void test_next_expiry_returns_soonest(void) {
+  safetimer_handle_t a, b, c;
+
+  mock_bsp_set_ticks(1000);
+  a = safetimer_create(500, TIMER_MODE_REPEAT, NULL, NULL);
+  b = safetimer_create(120, TIMER_MODE_REPEAT, NULL, NULL);
+  c = safetimer_create(300, TIMER_MODE_REPEAT, NULL, NULL);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(a));
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(b));
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(c));
+
+  TEST_ASSERT_EQUAL_UINT32(120, safetimer_get_next_expiry());
+
+  mock_bsp_advance_time(20);
+  TEST_ASSERT_EQUAL_UINT32(100, safetimer_get_next_expiry());
+
+  /* After b fires it re-arms at 1240, so c (1300) is still later */
+  mock_bsp_set_ticks(1120);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_UINT32(120, safetimer_get_next_expiry());
+}
+
+/**
+ * Test: overdue timer reports zero
+ * Verify: a deadline that passed without process() is not negative/huge
+ */
+void test_next_expiry_overdue_returns_zero(void) {
+  safetimer_handle_t h;
+
+  h = safetimer_create(50, TIMER_MODE_ONE_SHOT, NULL, NULL);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+
+  mock_bsp_advance_time(80);
+  TEST_ASSERT_EQUAL_UINT32(0, safetimer_get_next_expiry());
+
+  safetimer_process();
+  TEST_ASSERT_EQUAL_UINT32(SAFETIMER_NO_EXPIRY, safetimer_get_next_expiry());
+}
+
+/**
+ * Test: deadline across tick wraparound
+ * Verify: same wraparound rules as safetimer_process()
+ */
+void test_next_expiry_across_wraparound(void) {
+  safetimer_handle_t h;
+
+#if BSP_TICK_TYPE_16BIT
+  mock_bsp_set_ticks(0xFFF0U);
+#else
+  mock_bsp_set_ticks(0xFFFFFFF0UL);
+#endif
+  h = safetimer_create(100, TIMER_MODE_ONE_SHOT, NULL, NULL);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+
+  TEST_ASSERT_EQUAL_UINT32(100, safetimer_get_next_expiry());
+
+  mock_bsp_advance_time(40); /* Wrapped past zero */
+  TEST_ASSERT_EQUAL_UINT32(60, safetimer_get_next_expiry());
+}
+
+/**
+ * Test: query is O(1) once the cache is valid
+ * Verify: a single critical section per call after process()
+ */
+void test_next_expiry_uses_cache(void) {
+  mock_bsp_stats_t stats;
+  safetimer_handle_t h;
+
+  h = safetimer_create(200, TIMER_MODE_REPEAT, NULL, NULL);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+  safetimer_process();
+#if SAFETIMER_ENGINE == SAFETIMER_ENGINE_WHEEL
+  /* Wheel passes leave the cache stale: the first query rebuilds it */
+  safetimer_get_next_expiry();
+#endif
+
+  mock_bsp_reset_stats();
+  TEST_ASSERT_EQUAL_UINT32(200, safetimer_get_next_expiry());
+  mock_bsp_get_stats(&stats);
+  TEST_ASSERT_EQUAL_UINT32(1, stats.enter_critical_count);
+}
@@ -0,0 +1,184 @@
+/**
+ * @file    test_safetimer_pool.c
+ * @brief   Unit tests for multiple independent timer pools
+ * @version 1.0.0
+ * @date    2026-10-14
+ *
+ * Tests that explicit pools (safetimer_pool_init() / *_in() API) share no
+ * state with each other or with the default pool.
+ */
+
+#include "mock_bsp.h"
+#include "safetimer.h"
+#include "unity.h"
+
+/* External test helper from safetimer.c */
+#ifdef UNIT_TEST
+extern void safetimer_test_reset_pool(void);
+#endif
+
+/* ========== Test Data ========== */
+
+static safetimer_pool_t g_pool_a;
+static safetimer_pool_t g_pool_b;
+
+static int g_pool_a_count = 0;
+static int g_pool_b_count = 0;
+
+static void pool_count_callback(void *user_data) {
+  (*(int *)user_data)++;
+}
+
+/* Pool A callback that processes pool B and tries to re-enter pool A */
+static void pool_nested_callback(void *user_data) {
+  (void)user_data;
+  g_pool_a_count++;
+  safetimer_process_pool(&g_pool_b);
+  safetimer_process_pool(&g_pool_a); /* Blocked by pool A's guard */
+}
+
+static void pool_reset(void) {
+  safetimer_pool_init(&g_pool_a);
+  safetimer_pool_init(&g_pool_b);
+  g_pool_a_count = 0;
+  g_pool_b_count = 0;
+}
+
+/* ========== Test Cases ========== */
+
+/**
+ * Test: identical timers created in two fresh pools
+ * Verify: same handle values, but each handle only controls its own pool
+ */
+void test_pool_handles_are_per_pool(void) {
+  safetimer_handle_t ha, hb;
+  int running = 0;
+
+  if (SAFETIMER_COMPACT_SLOTS == 2) {
+    TEST_IGNORE_MESSAGE("Requires user_data (SAFETIMER_COMPACT_SLOTS=2)");
+  }
+
+  pool_reset();
+  ha = safetimer_create_in(&g_pool_a, 100, TIMER_MODE_REPEAT,
+                           pool_count_callback, &g_pool_a_count);
+  hb = safetimer_create_in(&g_pool_b, 100, TIMER_MODE_REPEAT,
+                           pool_count_callback, &g_pool_b_count);
+  TEST_ASSERT_NOT_EQUAL(SAFETIMER_INVALID_HANDLE, ha);
+  TEST_ASSERT_EQUAL(ha, hb);
+
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start_in(&g_pool_a, ha));
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_get_status_in(&g_pool_b, hb, &running));
+  TEST_ASSERT_EQUAL_INT(0, running);
+
+  /* Deleting in pool B leaves pool A's timer running */
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_delete_in(&g_pool_b, hb));
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_get_status_in(&g_pool_a, ha, &running));
+  TEST_ASSERT_EQUAL_INT(1, running);
+}
+
+/**
+ * Test: timers in an explicit pool and in the default pool
+ * Verify: each process call dispatches only its own pool
+ */
+void test_pool_process_is_per_pool(void) {
+  safetimer_handle_t h;
+  int default_count = 0;
+  int used = 0, total = 0;
+
+  if (SAFETIMER_COMPACT_SLOTS == 2) {
+    TEST_IGNORE_MESSAGE("Requires user_data (SAFETIMER_COMPACT_SLOTS=2)");
+  }
+
+  pool_reset();
+  h = safetimer_create_in(&g_pool_a, 50, TIMER_MODE_ONE_SHOT,
+                          pool_count_callback, &g_pool_a_count);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start_in(&g_pool_a, h));
+  h = safetimer_create(50, TIMER_MODE_ONE_SHOT, pool_count_callback,
+                       &default_count);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_get_pool_usage(&used, &total));
+  TEST_ASSERT_EQUAL_INT(1 + SAFETIMER_STATIC_TIMERS, used);
+  TEST_ASSERT_EQUAL_UINT32(50, safetimer_get_next_expiry_in(&g_pool_a));
+  TEST_ASSERT_EQUAL_UINT32(SAFETIMER_NO_EXPIRY,
+                           safetimer_get_next_expiry_in(&g_pool_b));
+
+  mock_bsp_advance_time(50);
+  safetimer_process_pool(&g_pool_a);
+  TEST_ASSERT_EQUAL_INT(1, g_pool_a_count);
+  TEST_ASSERT_EQUAL_INT(0, default_count);
+
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(1, default_count);
+  TEST_ASSERT_EQUAL_INT(1, g_pool_a_count);
+}
+
+/**
+ * Test: a pool A callback processes pool B, then re-enters pool A
+ * Verify: recursion guard is per pool (B runs, nested A pass is skipped)
+ */
+void test_pool_recursion_guard_is_per_pool(void) {
+  safetimer_handle_t ha, hb;
+
+  if (SAFETIMER_COMPACT_SLOTS == 2) {
+    TEST_IGNORE_MESSAGE("Requires user_data (SAFETIMER_COMPACT_SLOTS=2)");
+  }
+
+  pool_reset();
+  ha = safetimer_create_in(&g_pool_a, 10, TIMER_MODE_REPEAT,
+                           pool_nested_callback, NULL);
+  hb = safetimer_create_in(&g_pool_b, 10, TIMER_MODE_ONE_SHOT,
+                           pool_count_callback, &g_pool_b_count);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start_in(&g_pool_a, ha));
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start_in(&g_pool_b, hb));
+
+  mock_bsp_advance_time(10);
+  safetimer_process_pool(&g_pool_a);
+  TEST_ASSERT_EQUAL_INT(1, g_pool_a_count);
+  TEST_ASSERT_EQUAL_INT(1, g_pool_b_count);
+}
+
+#if SAFETIMER_ENABLE_POOL_LOCK
+static unsigned long g_pool_lock_enter = 0;
+static unsigned long g_pool_lock_exit = 0;
+
+static void pool_lock_enter(void) { g_pool_lock_enter++; }
+
+static void pool_lock_exit(void) { g_pool_lock_exit++; }
+
+/**
+ * Test: custom lock installed on one pool
+ * Verify: that pool never touches the global BSP critical section
+ */
+void test_pool_lock_hooks_replace_bsp(void) {
+  mock_bsp_stats_t stats;
+  safetimer_handle_t h;
+
+  pool_reset();
+  g_pool_lock_enter = 0;
+  g_pool_lock_exit = 0;
+  TEST_ASSERT_EQUAL(TIMER_ERR_INVALID,
+                    safetimer_pool_set_lock(&g_pool_a, pool_lock_enter, NULL));
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_pool_set_lock(
+                                  &g_pool_a, pool_lock_enter, pool_lock_exit));
+
+  mock_bsp_reset_stats();
+  h = safetimer_create_in(&g_pool_a, 20, TIMER_MODE_ONE_SHOT,
+                          pool_count_callback, &g_pool_a_count);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start_in(&g_pool_a, h));
+  mock_bsp_advance_time(20);
+  safetimer_process_pool(&g_pool_a);
+  mock_bsp_get_stats(&stats);
+
+  TEST_ASSERT_EQUAL_INT(1, g_pool_a_count);
+  TEST_ASSERT_EQUAL_UINT32(0, stats.enter_critical_count);
+  TEST_ASSERT_TRUE(g_pool_lock_enter > 0);
+  TEST_ASSERT_EQUAL_UINT32(g_pool_lock_enter, g_pool_lock_exit);
+
+  /* Removing the hooks falls back to the BSP critical section */
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_pool_set_lock(&g_pool_a, NULL, NULL));
+  safetimer_get_next_expiry_in(&g_pool_a);
+  mock_bsp_get_stats(&stats);
+  TEST_ASSERT_TRUE(stats.enter_critical_count > 0);
+}
+#endif /* SAFETIMER_ENABLE_POOL_LOCK */
@@ -0,0 +1,134 @@
+/**
+ * @file    test_safetimer_priority.c
+ * @brief   Unit tests for dispatch priority levels (safetimer_set_priority())
+ * @version 1.0.0
+ * @date    2026-10-14
+ *
+ * Tests that timers due in the same pass are dispatched highest priority
+ * first (slot order within a level), also across budgeted passes.
+ */
+
+#include "mock_bsp.h"
+#include "safetimer.h"
+#include "unity.h"
+
+/* External test helper from safetimer.c */
+#ifdef UNIT_TEST
+extern void safetimer_test_reset_pool(void);
+#endif
+
+#if SAFETIMER_PRIORITY_LEVELS > 1
+
+#define PRIO_TEST_TIMERS 4
+#define PRIO_TOP (SAFETIMER_PRIORITY_LEVELS - 1)
+
+/* ========== Test Data ========== */
+
+static int g_prio_order[PRIO_TEST_TIMERS];
+static int g_prio_order_len = 0;
+static int g_prio_ids[PRIO_TEST_TIMERS] = {0, 1, 2, 3};
+
+static void prio_order_callback(void *user_data) {
+  if (g_prio_order_len < PRIO_TEST_TIMERS) {
+    g_prio_order[g_prio_order_len++] = *(int *)user_data;
+  }
+}
+
+/* Create PRIO_TEST_TIMERS one-shot timers that all expire at tick 10 */
+static void prio_create_timers(safetimer_handle_t *handles) {
+  int i;
+
+  g_prio_order_len = 0;
+  for (i = 0; i < PRIO_TEST_TIMERS; i++) {
+    handles[i] = safetimer_create(10, TIMER_MODE_ONE_SHOT,
+                                  prio_order_callback, &g_prio_ids[i]);
+    TEST_ASSERT_NOT_EQUAL(SAFETIMER_INVALID_HANDLE, handles[i]);
+    TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(handles[i]));
+  }
+}
+
+/* ========== Test Cases ========== */
+
+/**
+ * Test: slot 3 at the top level, slot 1 one level lower, others at level 0
+ * Verify: dispatch order 3, 1, 0, 2 (3, 0, 1, 2 with two levels)
+ */
+void test_priority_dispatch_order(void) {
+  safetimer_handle_t h[PRIO_TEST_TIMERS];
+
+  prio_create_timers(h);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_set_priority(h[3], PRIO_TOP));
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_set_priority(h[1], PRIO_TOP - 1));
+
+  mock_bsp_advance_time(10);
+  safetimer_process();
+  safetimer_process(); /* Snapshot batch smaller than the due set */
+
+  TEST_ASSERT_EQUAL_INT(PRIO_TEST_TIMERS, g_prio_order_len);
+  TEST_ASSERT_EQUAL_INT(3, g_prio_order[0]);
+#if SAFETIMER_PRIORITY_LEVELS > 2
+  TEST_ASSERT_EQUAL_INT(1, g_prio_order[1]);
+  TEST_ASSERT_EQUAL_INT(0, g_prio_order[2]);
+#else
+  TEST_ASSERT_EQUAL_INT(0, g_prio_order[1]);
+  TEST_ASSERT_EQUAL_INT(1, g_prio_order[2]);
+#endif
+  TEST_ASSERT_EQUAL_INT(2, g_prio_order[3]);
+}
+
+/**
+ * Test: invalid priority, then priority of a deleted and reused slot
+ * Verify: out of range is rejected, a reused slot starts at level 0
+ */
+void test_priority_invalid_and_reset(void) {
+  safetimer_handle_t h[PRIO_TEST_TIMERS];
+  safetimer_handle_t old_h;
+
+  old_h = safetimer_create(10, TIMER_MODE_ONE_SHOT, prio_order_callback,
+                           &g_prio_ids[0]);
+  TEST_ASSERT_EQUAL(TIMER_ERR_INVALID,
+                    safetimer_set_priority(old_h, SAFETIMER_PRIORITY_LEVELS));
+  TEST_ASSERT_EQUAL(TIMER_ERR_INVALID,
+                    safetimer_set_priority(SAFETIMER_INVALID_HANDLE, 0));
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_set_priority(old_h, PRIO_TOP));
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_delete(old_h));
+
+  prio_create_timers(h); /* Slot 0 reused */
+  mock_bsp_advance_time(10);
+  safetimer_process();
+  safetimer_process(); /* Snapshot batch smaller than the due set */
+
+  TEST_ASSERT_EQUAL_INT(PRIO_TEST_TIMERS, g_prio_order_len);
+  TEST_ASSERT_EQUAL_INT(0, g_prio_order[0]);
+  TEST_ASSERT_EQUAL_INT(3, g_prio_order[3]);
+}
+
+#if SAFETIMER_ENABLE_PROCESS_BUDGET
+/**
+ * Test: one callback per budgeted pass, high-priority slot 2
+ * Verify: slot 2 runs in the first pass, then the rest in slot order
+ */
+void test_priority_with_budget(void) {
+  safetimer_handle_t h[PRIO_TEST_TIMERS];
+
+  prio_create_timers(h);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_set_priority(h[2], PRIO_TOP));
+  mock_bsp_advance_time(10);
+
+  TEST_ASSERT_EQUAL_INT(1, safetimer_process_budget(1, 0));
+  TEST_ASSERT_EQUAL_INT(1, g_prio_order_len);
+  TEST_ASSERT_EQUAL_INT(2, g_prio_order[0]);
+
+  TEST_ASSERT_EQUAL_INT(1, safetimer_process_budget(1, 0));
+  TEST_ASSERT_EQUAL_INT(1, safetimer_process_budget(1, 0));
+  TEST_ASSERT_EQUAL_INT(0, safetimer_process_budget(1, 0));
+
+  TEST_ASSERT_EQUAL_INT(PRIO_TEST_TIMERS, g_prio_order_len);
+  TEST_ASSERT_EQUAL_INT(0, g_prio_order[1]);
+  TEST_ASSERT_EQUAL_INT(1, g_prio_order[2]);
+  TEST_ASSERT_EQUAL_INT(3, g_prio_order[3]);
+  TEST_ASSERT_EQUAL_UINT32(SAFETIMER_NO_EXPIRY, safetimer_get_next_expiry());
+}
+#endif /* SAFETIMER_ENABLE_PROCESS_BUDGET */
+
+#endif /* SAFETIMER_PRIORITY_LEVELS > 1 */
@@ -0,0 +1,178 @@
+/**
+ * @file    test_safetimer_sched.c
+ * @brief   Unit tests for the coroutine task scheduler
+ * @version 1.0.0
+ * @date    2026-10-14
+ *
+ * Tests that a task table shares one timer slot, that SAFETIMER_TASK_WAIT
+ * stays phase-locked (skipping missed periods when late), and that exited
+ * tasks and invalid tables are handled (SAFETIMER_ENABLE_CORO_SCHED).
+ */
+
+#include "mock_bsp.h"
+#include "safetimer.h"
+#include "safetimer_coro.h"
+#include "unity.h"
+
+/* External test helper from safetimer.c */
+#ifdef UNIT_TEST
+extern void safetimer_test_reset_pool(void);
+#endif
+
+#if SAFETIMER_ENABLE_CORO_SCHED
+
+/* ========== Test Data ========== */
+
+typedef struct {
+  SAFETIMER_TASK_CONTEXT;
+  uint32_t period; /* SAFETIMER_TASK_WAIT argument */
+  int runs;        /* Resumes (incl. the first run) */
+  int limit;       /* Exit after this many runs, 0 = never */
+  bsp_tick_t last; /* Tick of the last run */
+} sched_ctx_t;
+
+static void sched_task(void *arg) {
+  sched_ctx_t *ctx = (sched_ctx_t *)arg;
+
+  SAFETIMER_TASK_BEGIN(ctx);
+  while (1) {
+    ctx->runs++;
+    ctx->last = bsp_get_ticks();
+    if (ctx->limit != 0 && ctx->runs >= ctx->limit) {
+      CORO_EXIT();
+    }
+    SAFETIMER_TASK_WAIT(ctx->period);
+  }
+  SAFETIMER_TASK_END();
+}
+
+static sched_ctx_t g_ctx[3];
+static const safetimer_task_t g_tasks[3] = {
+    {sched_task, &g_ctx[0]}, {sched_task, &g_ctx[1]}, {sched_task, &g_ctx[2]}};
+static safetimer_sched_t g_sched;
+
+static void sched_setup(uint32_t p0, uint32_t p1, uint32_t p2) {
+  int i;
+
+  for (i = 0; i < 3; i++) {
+    g_ctx[i]._coro_lc = 0;
+    g_ctx[i].runs = 0;
+    g_ctx[i].limit = 0;
+    g_ctx[i].last = 0;
+  }
+  g_ctx[0].period = p0;
+  g_ctx[1].period = p1;
+  g_ctx[2].period = p2;
+  mock_bsp_set_ticks(10); /* Tasks start at tick 10 */
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_sched_start(&g_sched, g_tasks, 3));
+}
+
+/* ========== Test Cases ========== */
+
+/**
+ * Test: three tasks (100/250/300 ms) processed every tick for 1000 ms
+ *       from tick 10
+ * Verify: one timer slot in use, each task runs exactly on its period
+ */
+void test_sched_tasks_share_one_slot(void) {
+  safetimer_handle_t h;
+  int used = 0;
+  int i;
+
+  sched_setup(100, 250, 300);
+
+  /* Every other slot still free */
+  for (i = 0; i < MAX_TIMERS - 1; i++) {
+    h = safetimer_create(1000, TIMER_MODE_ONE_SHOT, NULL, NULL);
+    TEST_ASSERT_NOT_EQUAL(SAFETIMER_INVALID_HANDLE, h);
+    used++;
+  }
+  TEST_ASSERT_EQUAL_INT(MAX_TIMERS - 1, used);
+
+  /* First pass runs every task */
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(1, g_ctx[0].runs);
+  TEST_ASSERT_EQUAL_INT(1, g_ctx[1].runs);
+  TEST_ASSERT_EQUAL_INT(1, g_ctx[2].runs);
+  TEST_ASSERT_EQUAL_UINT32(100, safetimer_get_next_expiry());
+
+  for (i = 0; i < 1000; i++) {
+    mock_bsp_advance_time(1);
+    safetimer_process();
+  }
+  TEST_ASSERT_EQUAL_INT(11, g_ctx[0].runs); /* +0, +100, ..., +1000 */
+  TEST_ASSERT_EQUAL_INT(5, g_ctx[1].runs);  /* +0, +250, ..., +1000 */
+  TEST_ASSERT_EQUAL_INT(4, g_ctx[2].runs);  /* +0, +300, +600, +900 */
+  TEST_ASSERT_EQUAL_UINT32(1010, g_ctx[0].last);
+  TEST_ASSERT_EQUAL_UINT32(910, g_ctx[2].last);
+}
+
+/**
+ * Test: no pass between tick 10 and tick 1060 (100 ms task)
+ * Verify: one late run, missed periods skipped, phase kept (next 1110)
+ */
+void test_sched_wait_phase_locked_when_late(void) {
+  sched_setup(100, 1000, 1000);
+  safetimer_process();
+
+  mock_bsp_set_ticks(1060);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(2, g_ctx[0].runs);
+  TEST_ASSERT_EQUAL_INT(2, g_ctx[1].runs); /* Due at 1010 */
+  TEST_ASSERT_EQUAL_UINT32(50, safetimer_get_next_expiry());
+
+  mock_bsp_set_ticks(1110);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(3, g_ctx[0].runs);
+  TEST_ASSERT_EQUAL_UINT32(1110, g_ctx[0].last);
+}
+
+/**
+ * Test: task 0 exits after 2 runs, then the others
+ * Verify: exited tasks no longer run, scheduler idles when all exited
+ */
+void test_sched_exited_tasks(void) {
+  int i;
+
+  sched_setup(10, 20, 20);
+  g_ctx[0].limit = 2;
+  g_ctx[1].limit = 1;
+  g_ctx[2].limit = 1;
+
+  for (i = 0; i <= 100; i++) {
+    safetimer_process();
+    mock_bsp_advance_time(1);
+  }
+  TEST_ASSERT_EQUAL_INT(2, g_ctx[0].runs);
+  TEST_ASSERT_EQUAL_INT(1, g_ctx[1].runs);
+  TEST_ASSERT_EQUAL_INT(1, g_ctx[2].runs);
+  TEST_ASSERT_TRUE(safetimer_get_next_expiry() > 30000UL);
+}
+
+/**
+ * Test: invalid tables and a full pool
+ * Verify: TIMER_ERR_INVALID / TIMER_ERR_FULL
+ */
+void test_sched_start_rules(void) {
+  static const safetimer_task_t bad[1] = {{NULL, &g_ctx[0]}};
+  int i;
+
+#if ENABLE_PARAM_CHECK
+  TEST_ASSERT_EQUAL(TIMER_ERR_INVALID,
+                    safetimer_sched_start(NULL, g_tasks, 3));
+  TEST_ASSERT_EQUAL(TIMER_ERR_INVALID,
+                    safetimer_sched_start(&g_sched, g_tasks, 0));
+  TEST_ASSERT_EQUAL(TIMER_ERR_INVALID,
+                    safetimer_sched_start(&g_sched, bad, 1));
+#else
+  (void)bad;
+#endif
+
+  for (i = 0; i < MAX_TIMERS; i++) {
+    (void)safetimer_create(1000, TIMER_MODE_ONE_SHOT, NULL, NULL);
+  }
+  TEST_ASSERT_EQUAL(TIMER_ERR_FULL,
+                    safetimer_sched_start(&g_sched, g_tasks, 3));
+}
+
+#endif /* SAFETIMER_ENABLE_CORO_SCHED */
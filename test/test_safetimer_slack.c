@@ -0,0 +1,150 @@
+/**
+ * @file    test_safetimer_slack.c
+ * @brief   Unit tests for per-timer slack (SAFETIMER_ENABLE_SLACK)
+ * @version 1.0.0
+ * @date    2026-10-14
+ *
+ * Tests that timers with slack fire early only on another timer's wakeup,
+ * stay phase-locked, and that the slack is validated and reset on create.
+ */
+
+#include "mock_bsp.h"
+#include "safetimer.h"
+#include "unity.h"
+
+/* External test helper from safetimer.c */
+#ifdef UNIT_TEST
+extern void safetimer_test_reset_pool(void);
+#endif
+
+#if SAFETIMER_ENABLE_SLACK
+
+/* ========== Test Data ========== */
+
+static int g_slack_fired[2];
+static int g_slack_ids[2] = {0, 1};
+
+static void slack_callback(void *user_data) {
+  g_slack_fired[*(int *)user_data]++;
+}
+
+/* Timer 0: due at 100, no slack. Timer 1: due at deadline_1 */
+static void slack_create_pair(safetimer_handle_t *h, timer_mode_t mode_1,
+                              uint32_t deadline_1, uint8_t slack_1) {
+  if (!SAFETIMER_PERIOD_FITS(deadline_1)) {
+    TEST_IGNORE_MESSAGE("Period not accepted by this slot layout");
+  }
+  g_slack_fired[0] = 0;
+  g_slack_fired[1] = 0;
+  h[0] = safetimer_create(100, TIMER_MODE_ONE_SHOT, slack_callback,
+                          &g_slack_ids[0]);
+  h[1] = safetimer_create(deadline_1, mode_1, slack_callback,
+                          &g_slack_ids[1]);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_set_slack(h[1], slack_1));
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h[0]));
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h[1]));
+}
+
+/* ========== Test Cases ========== */
+
+/**
+ * Test: timer due at 105 with 10 ms slack, other timer due at 100
+ * Verify: no early fire without a wakeup, both fire in the pass at 100
+ */
+void test_slack_coalesces_into_wakeup(void) {
+  safetimer_handle_t h[2];
+#if SAFETIMER_ENABLE_STATS
+  safetimer_stats_t st;
+#endif
+
+  slack_create_pair(h, TIMER_MODE_ONE_SHOT, 105, 10);
+  TEST_ASSERT_EQUAL_UINT32(100, safetimer_get_next_expiry());
+
+  mock_bsp_set_ticks(96); /* Inside the slack window, nothing due */
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(0, g_slack_fired[1]);
+
+  mock_bsp_set_ticks(100);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(1, g_slack_fired[0]);
+  TEST_ASSERT_EQUAL_INT(1, g_slack_fired[1]);
+  TEST_ASSERT_EQUAL_UINT32(SAFETIMER_NO_EXPIRY, safetimer_get_next_expiry());
+
+#if SAFETIMER_ENABLE_STATS
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_get_stats(h[1], &st));
+  TEST_ASSERT_EQUAL_UINT32(0, st.last_lateness); /* Early, not late */
+#endif
+}
+
+/**
+ * Test: timer due at 120 with 10 ms slack, other timer due at 100
+ * Verify: wakeup outside the window does not pull it in
+ */
+void test_slack_outside_window(void) {
+  safetimer_handle_t h[2];
+
+  slack_create_pair(h, TIMER_MODE_ONE_SHOT, 120, 10);
+
+  mock_bsp_set_ticks(100);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(1, g_slack_fired[0]);
+  TEST_ASSERT_EQUAL_INT(0, g_slack_fired[1]);
+  TEST_ASSERT_EQUAL_UINT32(20, safetimer_get_next_expiry());
+
+  mock_bsp_set_ticks(120);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(1, g_slack_fired[1]);
+}
+
+/**
+ * Test: 103 ms REPEAT timer with 5 ms slack fired early at 100, first
+ *       pass after start (stale cache)
+ * Verify: next deadline stays phase-locked at 206
+ */
+void test_slack_repeat_phase_locked(void) {
+  safetimer_handle_t h[2];
+
+  slack_create_pair(h, TIMER_MODE_REPEAT, 103, 5);
+
+  mock_bsp_set_ticks(100);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(1, g_slack_fired[1]);
+  TEST_ASSERT_EQUAL_UINT32(106, safetimer_get_next_expiry()); /* At 206 */
+}
+
+/**
+ * Test: slack not below the period, invalid handle, slot reuse
+ * Verify: rejected, and a re-created timer starts without slack
+ */
+void test_slack_rules(void) {
+  safetimer_handle_t late, early;
+
+  if (!SAFETIMER_PERIOD_FITS(105UL)) {
+    TEST_IGNORE_MESSAGE("Period not accepted by this slot layout");
+  }
+
+  g_slack_fired[0] = 0;
+  g_slack_fired[1] = 0;
+  late = safetimer_create(105, TIMER_MODE_ONE_SHOT, slack_callback,
+                          &g_slack_ids[1]);
+  TEST_ASSERT_EQUAL(TIMER_ERR_INVALID, safetimer_set_slack(late, 105));
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_set_slack(late, 104));
+  TEST_ASSERT_EQUAL(TIMER_ERR_INVALID,
+                    safetimer_set_slack(SAFETIMER_INVALID_HANDLE, 1));
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_delete(late));
+
+  /* Reuses the slot: slack back to 0, so 105 is not pulled into 100 */
+  late = safetimer_create(105, TIMER_MODE_ONE_SHOT, slack_callback,
+                          &g_slack_ids[1]);
+  early = safetimer_create(100, TIMER_MODE_ONE_SHOT, slack_callback,
+                           &g_slack_ids[0]);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(late));
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(early));
+
+  mock_bsp_set_ticks(100);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(1, g_slack_fired[0]);
+  TEST_ASSERT_EQUAL_INT(0, g_slack_fired[1]);
+}
+
+#endif /* SAFETIMER_ENABLE_SLACK */
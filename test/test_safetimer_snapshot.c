@@ -0,0 +1,180 @@
+/**
+ * @file    test_safetimer_snapshot.c
+ * @brief   Unit tests for the single-snapshot dispatch pass
+ * @version 1.0.0
+ * @date    2026-10-14
+ *
+ * Behavioral tests run in both dispatch modes; critical-section counts are
+ * only asserted with SAFETIMER_PROCESS_SNAPSHOT=1.
+ */
+
+#include "mock_bsp.h"
+#include "safetimer.h"
+#include "unity.h"
+
+/* External test helper from safetimer.c */
+#ifdef UNIT_TEST
+extern void safetimer_test_reset_pool(void);
+#endif
+
+/* ========== Test Data ========== */
+
+/* Due timers that fit in a single snapshot batch */
+#if SAFETIMER_SNAPSHOT_BATCH < 4
+#define SNAP_DUE_COUNT SAFETIMER_SNAPSHOT_BATCH
+#else
+#define SNAP_DUE_COUNT 4
+#endif
+
+static int g_snap_fire_count = 0;
+static safetimer_handle_t g_snap_victim = SAFETIMER_INVALID_HANDLE;
+static safetimer_handle_t g_snap_restart = SAFETIMER_INVALID_HANDLE;
+static bsp_tick_t g_snap_restart_ticks[4];
+static int g_snap_restart_fires = 0;
+
+static void snap_callback(void *user_data) {
+  int *counter = (int *)user_data;
+  if (counter != NULL) {
+    (*counter)++;
+  }
+  g_snap_fire_count++;
+}
+
+static void snap_delete_victim_callback(void *user_data) {
+  (void)user_data;
+  g_snap_fire_count++;
+  safetimer_delete(g_snap_victim);
+}
+
+static void snap_restart_other_callback(void *user_data) {
+  (void)user_data;
+  g_snap_fire_count++;
+  safetimer_start(g_snap_restart);
+}
+
+static void snap_log_tick_callback(void *user_data) {
+  (void)user_data;
+  if (g_snap_restart_fires < 4) {
+    g_snap_restart_ticks[g_snap_restart_fires] = bsp_get_ticks();
+  }
+  g_snap_restart_fires++;
+}
+
+/* ========== Test Cases ========== */
+
+/**
+ * Test: every due timer fires once per pass
+ * Verify: snapshot mode needs two critical sections for the whole batch
+ */
+void test_snapshot_dispatches_all_due(void) {
+  safetimer_handle_t h;
+  mock_bsp_stats_t stats;
+  int i;
+
+  g_snap_fire_count = 0;
+  for (i = 0; i < SNAP_DUE_COUNT; i++) {
+    h = safetimer_create(100, TIMER_MODE_REPEAT, snap_callback, NULL);
+    TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+  }
+
+  mock_bsp_set_ticks(100);
+  mock_bsp_reset_stats();
+  safetimer_process();
+  mock_bsp_get_stats(&stats);
+
+  TEST_ASSERT_EQUAL_INT(SNAP_DUE_COUNT, g_snap_fire_count);
+#if SAFETIMER_PROCESS_SNAPSHOT
+  TEST_ASSERT_EQUAL_UINT32(2, stats.enter_critical_count);
+#else
+  (void)stats;
+#endif
+
+  /* Committed deadlines: next fire at 200, not before */
+  mock_bsp_set_ticks(199);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(SNAP_DUE_COUNT, g_snap_fire_count);
+
+  mock_bsp_set_ticks(200);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(2 * SNAP_DUE_COUNT, g_snap_fire_count);
+}
+
+/**
+ * Test: a callback deletes another timer due in the same pass
+ * Verify: the deleted timer's callback is not invoked
+ */
+void test_snapshot_skips_timer_deleted_by_earlier_callback(void) {
+  safetimer_handle_t killer;
+  int victim_count = 0;
+
+  if (SAFETIMER_COMPACT_SLOTS == 2) {
+    TEST_IGNORE_MESSAGE("Requires user_data (SAFETIMER_COMPACT_SLOTS=2)");
+  }
+
+  g_snap_fire_count = 0;
+  killer = safetimer_create(50, TIMER_MODE_ONE_SHOT,
+                            snap_delete_victim_callback, NULL);
+  g_snap_victim =
+      safetimer_create(50, TIMER_MODE_REPEAT, snap_callback, &victim_count);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(killer));
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(g_snap_victim));
+
+  mock_bsp_set_ticks(50);
+  safetimer_process();
+
+  TEST_ASSERT_EQUAL_INT(1, g_snap_fire_count);
+  TEST_ASSERT_EQUAL_INT(0, victim_count);
+#if ENABLE_PARAM_CHECK
+  TEST_ASSERT_EQUAL(TIMER_ERR_INVALID, safetimer_start(g_snap_victim));
+#endif
+}
+
+/**
+ * Test: a callback restarts another ONE_SHOT due in the same pass
+ * Verify: the old deadline is dropped, the timer fires only at the new one
+ */
+void test_snapshot_skips_timer_restarted_by_earlier_callback(void) {
+  safetimer_handle_t starter;
+
+  g_snap_fire_count = 0;
+  g_snap_restart_fires = 0;
+  starter = safetimer_create(10, TIMER_MODE_ONE_SHOT,
+                             snap_restart_other_callback, NULL);
+  g_snap_restart = safetimer_create(10, TIMER_MODE_ONE_SHOT,
+                                    snap_log_tick_callback, NULL);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(starter));
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(g_snap_restart));
+
+  mock_bsp_set_ticks(10);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(1, g_snap_fire_count);
+  TEST_ASSERT_EQUAL_INT(0, g_snap_restart_fires);
+
+  mock_bsp_set_ticks(20);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(1, g_snap_restart_fires);
+  TEST_ASSERT_EQUAL_UINT32(20, g_snap_restart_ticks[0]);
+}
+
+/**
+ * Test: more due timers than fit in one batch
+ * Verify: the remainder is dispatched by following passes, none lost
+ */
+void test_snapshot_batch_overflow_defers(void) {
+  safetimer_handle_t h;
+  int i;
+
+  g_snap_fire_count = 0;
+  for (i = 0; i < SAFETIMER_RUNTIME_TIMERS; i++) {
+    h = safetimer_create(10, TIMER_MODE_ONE_SHOT, snap_callback, NULL);
+    TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+  }
+
+  mock_bsp_set_ticks(10);
+  for (i = 0; i < SAFETIMER_RUNTIME_TIMERS; i++) {
+    safetimer_process();
+  }
+
+  TEST_ASSERT_EQUAL_INT(SAFETIMER_RUNTIME_TIMERS, g_snap_fire_count);
+  TEST_ASSERT_EQUAL_UINT32(SAFETIMER_NO_EXPIRY, safetimer_get_next_expiry());
+}
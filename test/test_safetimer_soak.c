@@ -0,0 +1,149 @@
+/**
+ * @file    test_safetimer_soak.c
+ * @brief   Long-horizon soak tests on the Mock BSP virtual clock
+ * @version 1.0.0
+ * @date    2026-10-14
+ *
+ * Runs weeks of simulated uptime and hundreds of tick wraparounds through
+ * mock_bsp_fast_forward(), which only calls safetimer_process() at due
+ * deadlines. Verifies exact fire counts, exact fire ticks across wraps,
+ * and that idle time costs a single pass.
+ */
+
+#include "mock_bsp.h"
+#include "safetimer.h"
+#include "unity.h"
+
+/* ========== Test Data ========== */
+
+#define SOAK_WEEK_TICKS (7UL * 24UL * 3600UL * 1000UL) /* 604,800,000 */
+
+static unsigned long g_soak_fired[3];
+
+/* Fire tick bookkeeping for test_soak_wraparound_exact_ticks() */
+static bsp_tick_t g_soak_last_tick;
+static bsp_tick_t g_soak_period;
+static unsigned long g_soak_late;
+
+static void soak_count_callback(void *user_data) {
+  unsigned long *counter = (unsigned long *)user_data;
+  (*counter)++;
+}
+
+static void soak_tick_callback(void *user_data) {
+  bsp_tick_t now = mock_bsp_get_current_ticks();
+
+  (void)user_data;
+  if ((bsp_tick_t)(now - g_soak_last_tick) != g_soak_period) {
+    g_soak_late++;
+  }
+  g_soak_last_tick = now;
+  g_soak_fired[0]++;
+}
+
+/* ========== Test Cases ========== */
+
+/**
+ * Test: REPEAT timers of 997, 25000 and 30011 ticks for one week of
+ *       virtual time
+ * Verify: exact fire counts, phase kept (remaining at the end), one pass
+ *         per distinct deadline at most
+ */
+void test_soak_week_repeat_exact_counts(void) {
+  static const uint32_t periods[3] = {997UL, 25000UL, 30011UL};
+  safetimer_handle_t h[3];
+  unsigned long passes;
+  unsigned long fires = 0;
+  int i;
+
+  for (i = 0; i < 3; i++) {
+    if (!SAFETIMER_PERIOD_FITS(periods[i])) {
+      TEST_IGNORE_MESSAGE("Period not accepted by this slot layout");
+    }
+  }
+
+  for (i = 0; i < 3; i++) {
+    g_soak_fired[i] = 0;
+    h[i] = safetimer_create(periods[i], TIMER_MODE_REPEAT,
+                            soak_count_callback, &g_soak_fired[i]);
+    TEST_ASSERT_NOT_EQUAL(SAFETIMER_INVALID_HANDLE, h[i]);
+    TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h[i]));
+  }
+
+  passes = mock_bsp_fast_forward(SOAK_WEEK_TICKS);
+
+  for (i = 0; i < 3; i++) {
+    TEST_ASSERT_EQUAL_UINT32(SOAK_WEEK_TICKS / periods[i], g_soak_fired[i]);
+    fires += g_soak_fired[i];
+  }
+  TEST_ASSERT_TRUE(passes <= fires + 1UL); /* + final pass at end tick */
+
+#if ENABLE_QUERY_API
+  {
+    uint32_t remaining = 0;
+
+    for (i = 0; i < 3; i++) {
+      TEST_ASSERT_EQUAL(TIMER_OK, safetimer_get_remaining(h[i], &remaining));
+      TEST_ASSERT_EQUAL_UINT32(periods[i] - SOAK_WEEK_TICKS % periods[i],
+                               remaining);
+    }
+  }
+#endif
+}
+
+/**
+ * Test: REPEAT timer of SAFETIMER_MAX_PERIOD / 3 ticks started 50 ticks
+ *       before wraparound, run for 3000 periods (hundreds of wraps in
+ *       both tick widths)
+ * Verify: every expiry exactly one period after the previous one
+ */
+void test_soak_wraparound_exact_ticks(void) {
+  safetimer_handle_t h;
+  uint32_t period = SAFETIMER_MAX_PERIOD / 3UL;
+  int i;
+
+  mock_bsp_set_ticks((bsp_tick_t)(0U - 50U));
+  g_soak_period = (bsp_tick_t)period;
+  g_soak_last_tick = mock_bsp_get_current_ticks();
+  g_soak_late = 0;
+  g_soak_fired[0] = 0;
+
+  h = safetimer_create(period, TIMER_MODE_REPEAT, soak_tick_callback, NULL);
+  TEST_ASSERT_NOT_EQUAL(SAFETIMER_INVALID_HANDLE, h);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+
+  for (i = 0; i < 3000; i++) {
+    mock_bsp_fast_forward(period);
+  }
+
+  TEST_ASSERT_EQUAL_UINT32(3000, g_soak_fired[0]);
+  TEST_ASSERT_EQUAL_UINT32(0, g_soak_late);
+}
+
+/**
+ * Test: one week with no timer, then one week with a single ONE_SHOT
+ *       (500 ticks)
+ * Verify: idle week is one pass, the ONE_SHOT adds exactly one, clock
+ *         lands on the end tick
+ */
+void test_soak_idle_costs_one_pass(void) {
+  safetimer_handle_t h;
+  bsp_tick_t start = mock_bsp_get_current_ticks();
+
+  if (SAFETIMER_COMPACT_SLOTS == 2) {
+    TEST_IGNORE_MESSAGE("Requires user_data (SAFETIMER_COMPACT_SLOTS=2)");
+  }
+
+  TEST_ASSERT_EQUAL_UINT32(1, mock_bsp_fast_forward(SOAK_WEEK_TICKS));
+  TEST_ASSERT_EQUAL_UINT32((bsp_tick_t)(start + SOAK_WEEK_TICKS),
+                           mock_bsp_get_current_ticks());
+
+  g_soak_fired[0] = 0;
+  h = safetimer_create(500, TIMER_MODE_ONE_SHOT, soak_count_callback,
+                       &g_soak_fired[0]);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+  TEST_ASSERT_EQUAL_UINT32(2, mock_bsp_fast_forward(SOAK_WEEK_TICKS));
+  TEST_ASSERT_EQUAL_UINT32(1, g_soak_fired[0]);
+  TEST_ASSERT_EQUAL_UINT32((bsp_tick_t)(start + 2UL * SOAK_WEEK_TICKS),
+                           mock_bsp_get_current_ticks());
+}
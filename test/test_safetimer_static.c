@@ -0,0 +1,143 @@
+/**
+ * @file    test_safetimer_static.c
+ * @brief   Unit tests for the ROM static timer table
+ * @version 1.0.0
+ * @date    2026-10-14
+ *
+ * Tests that timers declared with SAFETIMER_STATIC_TABLE run from reset on
+ * their compile-time handles, reject delete/period changes, and that
+ * runtime creation only uses the remaining slots
+ * (SAFETIMER_STATIC_TIMERS > 0).
+ */
+
+#include "mock_bsp.h"
+#include "safetimer.h"
+#include "unity.h"
+
+/* External test helper from safetimer.c */
+#ifdef UNIT_TEST
+extern void safetimer_test_reset_pool(void);
+#endif
+
+#if SAFETIMER_STATIC_TIMERS > 0
+
+#if SAFETIMER_STATIC_TIMERS < 2
+#error "test_safetimer_static.c declares 2 static timers"
+#endif
+
+/* ========== Test Data ========== */
+
+static int g_static_fired[2];
+
+static void static_callback(void *user_data) {
+  int *counter = (int *)user_data;
+  (*counter)++;
+}
+
+SAFETIMER_STATIC_TABLE = {
+    SAFETIMER_STATIC_TIMER(100, TIMER_MODE_REPEAT, static_callback,
+                           &g_static_fired[0]),
+    SAFETIMER_STATIC_TIMER(30, TIMER_MODE_ONE_SHOT, static_callback,
+                           &g_static_fired[1])};
+
+#define STATIC_BLINK SAFETIMER_STATIC_HANDLE(0)
+#define STATIC_PULSE SAFETIMER_STATIC_HANDLE(1)
+
+/* ========== Test Cases ========== */
+
+/**
+ * Test: REPEAT (100 ms) and ONE_SHOT (30 ms) static timers started at
+ *       tick 0 without safetimer_create()
+ * Verify: fire on their table periods with their table user_data, the
+ *         ONE_SHOT stops after firing
+ */
+void test_static_timers_run_from_reset(void) {
+  int running = 0;
+
+  g_static_fired[0] = 0;
+  g_static_fired[1] = 0;
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(STATIC_BLINK));
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(STATIC_PULSE));
+  TEST_ASSERT_EQUAL_UINT32(30, safetimer_get_next_expiry());
+
+  mock_bsp_set_ticks(30);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(0, g_static_fired[0]);
+  TEST_ASSERT_EQUAL_INT(1, g_static_fired[1]);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_get_status(STATIC_PULSE, &running));
+  TEST_ASSERT_EQUAL_INT(0, running);
+
+  mock_bsp_set_ticks(100);
+  safetimer_process();
+  mock_bsp_set_ticks(200);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(2, g_static_fired[0]);
+  TEST_ASSERT_EQUAL_INT(1, g_static_fired[1]);
+}
+
+/**
+ * Test: delete and period changes on a static timer
+ * Verify: TIMER_ERR_INVALID (also with ENABLE_PARAM_CHECK=0: the ROM slot
+ *         has no RAM period or meta), timer keeps its period and handle
+ */
+void test_static_timers_are_fixed(void) {
+  uint32_t remaining = 0;
+
+  TEST_ASSERT_EQUAL(TIMER_ERR_INVALID, safetimer_delete(STATIC_BLINK));
+  TEST_ASSERT_EQUAL(TIMER_ERR_INVALID, safetimer_set_period(STATIC_BLINK, 5));
+  TEST_ASSERT_EQUAL(TIMER_ERR_INVALID,
+                    safetimer_advance_period(STATIC_BLINK, 5));
+#if SAFETIMER_ENABLE_ISR_QUEUE
+  TEST_ASSERT_EQUAL(TIMER_ERR_INVALID, safetimer_delete_from_isr(STATIC_BLINK));
+  TEST_ASSERT_EQUAL(TIMER_ERR_INVALID,
+                    safetimer_set_period_from_isr(STATIC_BLINK, 5));
+#endif
+
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(STATIC_BLINK));
+  TEST_ASSERT_EQUAL(TIMER_OK,
+                    safetimer_get_remaining(STATIC_BLINK, &remaining));
+  TEST_ASSERT_EQUAL_UINT32(100, remaining);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_stop(STATIC_BLINK));
+}
+
+/**
+ * Test: fill the pool with runtime timers, delete one, create again
+ * Verify: only slots above the table are handed out, usage counts the
+ *         static timers, static handles never collide with runtime ones
+ */
+void test_static_slots_reserved(void) {
+  safetimer_handle_t h;
+  safetimer_handle_t first = SAFETIMER_INVALID_HANDLE;
+  int used = 0;
+  int total = 0;
+  int i;
+
+  for (i = 0; i < MAX_TIMERS - SAFETIMER_STATIC_TIMERS; i++) {
+    h = safetimer_create(1000, TIMER_MODE_ONE_SHOT, NULL, NULL);
+    TEST_ASSERT_NOT_EQUAL(SAFETIMER_INVALID_HANDLE, h);
+    TEST_ASSERT_NOT_EQUAL(STATIC_BLINK, h);
+    TEST_ASSERT_NOT_EQUAL(STATIC_PULSE, h);
+    if (i == 0) {
+      first = h;
+    }
+  }
+  TEST_ASSERT_EQUAL(SAFETIMER_INVALID_HANDLE,
+                    safetimer_create(1000, TIMER_MODE_ONE_SHOT, NULL, NULL));
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_get_pool_usage(&used, &total));
+  TEST_ASSERT_EQUAL_INT(MAX_TIMERS, used);
+  TEST_ASSERT_EQUAL_INT(MAX_TIMERS, total);
+
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_delete(first));
+  h = safetimer_create(1000, TIMER_MODE_ONE_SHOT, NULL, NULL);
+  TEST_ASSERT_NOT_EQUAL(SAFETIMER_INVALID_HANDLE, h);
+  TEST_ASSERT_NOT_EQUAL(STATIC_BLINK, h);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(STATIC_BLINK));
+
+  /* Pool reset keeps the static timers valid */
+  safetimer_test_reset_pool();
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_get_pool_usage(&used, NULL));
+  TEST_ASSERT_EQUAL_INT(SAFETIMER_STATIC_TIMERS, used);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(STATIC_PULSE));
+}
+
+#endif /* SAFETIMER_STATIC_TIMERS > 0 */
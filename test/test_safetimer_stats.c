@@ -0,0 +1,139 @@
+/**
+ * @file    test_safetimer_stats.c
+ * @brief   Unit tests for timing statistics (SAFETIMER_ENABLE_STATS)
+ * @version 1.0.0
+ * @date    2026-10-14
+ *
+ * Tests fire/missed counts, lateness, callback and pass durations, and the
+ * reset rules of the statistics query API.
+ */
+
+#include "mock_bsp.h"
+#include "safetimer.h"
+#include "unity.h"
+
+/* External test helper from safetimer.c */
+#ifdef UNIT_TEST
+extern void safetimer_test_reset_pool(void);
+#endif
+
+#if SAFETIMER_ENABLE_STATS
+
+/* ========== Test Data ========== */
+
+static void stats_empty_callback(void *user_data) { (void)user_data; }
+
+/* Simulates a slow callback: 5 ms (or 500 cycles) of work */
+static void stats_slow_callback(void *user_data) {
+  (void)user_data;
+#if SAFETIMER_STATS_CYCLES
+  mock_bsp_advance_cycles(500);
+#else
+  mock_bsp_advance_time(5);
+#endif
+}
+
+/* ========== Test Cases ========== */
+
+/**
+ * Test: 10 ms REPEAT timer processed 3 ms late, then 25 ms late
+ * Verify: fire count, last/max lateness, coalesced periods (skip mode)
+ */
+void test_stats_lateness_and_missed(void) {
+  safetimer_stats_t st;
+  safetimer_handle_t h;
+
+  h = safetimer_create(10, TIMER_MODE_REPEAT, stats_empty_callback, NULL);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+
+  mock_bsp_set_ticks(13);
+  safetimer_process();
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_get_stats(h, &st));
+  TEST_ASSERT_EQUAL_UINT32(1, st.fire_count);
+  TEST_ASSERT_EQUAL_UINT32(3, st.last_lateness);
+  TEST_ASSERT_EQUAL_UINT32(0, st.missed_count);
+
+  mock_bsp_set_ticks(45); /* Deadline 20: 30 and 40 elapsed as well */
+  safetimer_process();
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_get_stats(h, &st));
+  TEST_ASSERT_EQUAL_UINT32(2, st.fire_count);
+  TEST_ASSERT_EQUAL_UINT32(25, st.last_lateness);
+  TEST_ASSERT_EQUAL_UINT32(25, st.max_lateness);
+#if SAFETIMER_ENABLE_CATCHUP == SAFETIMER_CATCHUP_BURST
+  TEST_ASSERT_EQUAL_UINT32(0, st.missed_count); /* Replayed, not skipped */
+#else
+  TEST_ASSERT_EQUAL_UINT32(2, st.missed_count);
+#endif
+
+  mock_bsp_set_ticks(50);
+  safetimer_process();
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_get_stats(h, &st));
+  TEST_ASSERT_EQUAL_UINT32(25, st.max_lateness); /* Max is kept */
+}
+
+/**
+ * Test: callback that runs for 5 ms (500 cycles with a cycle counter)
+ * Verify: max callback duration and longest pass
+ */
+void test_stats_callback_duration(void) {
+  safetimer_pool_stats_t ps;
+  safetimer_stats_t st;
+  safetimer_handle_t h;
+
+  h = safetimer_create(10, TIMER_MODE_ONE_SHOT, stats_slow_callback, NULL);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+  safetimer_reset_pool_stats();
+
+  mock_bsp_advance_time(10);
+  safetimer_process();
+
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_get_stats(h, &st));
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_get_pool_stats(&ps));
+#if SAFETIMER_STATS_CYCLES
+  TEST_ASSERT_EQUAL_UINT32(500, st.max_duration);
+  TEST_ASSERT_EQUAL_UINT32(500, ps.max_pass);
+#else
+  TEST_ASSERT_EQUAL_UINT32(5, st.max_duration);
+  TEST_ASSERT_EQUAL_UINT32(5, ps.max_pass);
+  TEST_ASSERT_EQUAL_UINT32(0, ps.max_critical); /* Not timed in ticks */
+#endif
+
+  safetimer_reset_pool_stats();
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_get_pool_stats(&ps));
+  TEST_ASSERT_EQUAL_UINT32(0, ps.max_pass);
+}
+
+/**
+ * Test: reset, slot reuse and invalid arguments
+ * Verify: reset and re-create start from zero, bad input is rejected
+ */
+void test_stats_reset_rules(void) {
+  safetimer_stats_t st;
+  safetimer_handle_t h;
+
+  h = safetimer_create(10, TIMER_MODE_REPEAT, stats_empty_callback, NULL);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+  mock_bsp_advance_time(12);
+  safetimer_process();
+
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_reset_stats(h));
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_get_stats(h, &st));
+  TEST_ASSERT_EQUAL_UINT32(0, st.fire_count);
+  TEST_ASSERT_EQUAL_UINT32(0, st.max_lateness);
+
+  mock_bsp_advance_time(10);
+  safetimer_process();
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_delete(h));
+  TEST_ASSERT_EQUAL(TIMER_ERR_INVALID, safetimer_get_stats(h, &st));
+
+  h = safetimer_create(10, TIMER_MODE_REPEAT, stats_empty_callback, NULL);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_get_stats(h, &st));
+  TEST_ASSERT_EQUAL_UINT32(0, st.fire_count); /* Reused slot */
+
+  TEST_ASSERT_EQUAL(TIMER_ERR_INVALID, safetimer_get_stats(h, NULL));
+  TEST_ASSERT_EQUAL(TIMER_ERR_INVALID, safetimer_get_pool_stats(NULL));
+  TEST_ASSERT_EQUAL(TIMER_ERR_INVALID,
+                    safetimer_reset_stats(SAFETIMER_INVALID_HANDLE));
+}
+
+#endif /* SAFETIMER_ENABLE_STATS */
@@ -79,7 +79,7 @@ void test_stress_1000_create_delete_cycles(void) {
 
   /* Verify pool is empty after all deletions */
   safetimer_get_pool_usage(&used_timers, &total_timers);
-  TEST_ASSERT_EQUAL_INT(0, used_timers);
+  TEST_ASSERT_EQUAL_INT(SAFETIMER_STATIC_TIMERS, used_timers);
 
   printf("[STRESS] ✓ All %d cycles completed successfully\n", CYCLES);
 }
@@ -92,15 +92,20 @@ void test_stress_1000_create_delete_cycles(void) {
  * @ac      AC2: All timers can be active simultaneously without errors
  */
 void test_stress_all_timers_active_simultaneously(void) {
-  safetimer_handle_t handles[MAX_TIMERS];
+  safetimer_handle_t handles[SAFETIMER_RUNTIME_TIMERS];
   int i;
   int total_timers, used_timers;
-  int callbacks_fired[MAX_TIMERS] = {0};
+  int callbacks_fired[SAFETIMER_RUNTIME_TIMERS] = {0};
 
-  printf("\n[STRESS] Creating %d timers simultaneously...\n", MAX_TIMERS);
+  if (SAFETIMER_COMPACT_SLOTS == 2) {
+    TEST_IGNORE_MESSAGE("Requires user_data (SAFETIMER_COMPACT_SLOTS=2)");
+  }
+
+  printf("\n[STRESS] Creating %d timers simultaneously...\n",
+         SAFETIMER_RUNTIME_TIMERS);
 
   /* Create all timers */
-  for (i = 0; i < MAX_TIMERS; i++) {
+  for (i = 0; i < SAFETIMER_RUNTIME_TIMERS; i++) {
     /* Staggered periods to ensure different expiration times */
     uint32_t period = 100 + (i * 10);
     handles[i] = safetimer_create(period, TIMER_MODE_REPEAT, counting_callback,
@@ -113,7 +118,7 @@ void test_stress_all_timers_active_simultaneously(void) {
   TEST_ASSERT_EQUAL_INT(MAX_TIMERS, used_timers);
 
   /* Start all timers */
-  for (i = 0; i < MAX_TIMERS; i++) {
+  for (i = 0; i < SAFETIMER_RUNTIME_TIMERS; i++) {
     TEST_ASSERT_EQUAL_INT(TIMER_OK, safetimer_start(handles[i]));
   }
 
@@ -124,21 +129,22 @@ void test_stress_all_timers_active_simultaneously(void) {
   }
 
   /* Verify all timers fired at least once */
-  for (i = 0; i < MAX_TIMERS; i++) {
+  for (i = 0; i < SAFETIMER_RUNTIME_TIMERS; i++) {
     TEST_ASSERT_GREATER_THAN_INT(0, callbacks_fired[i]);
   }
 
   /* Stop and delete all timers */
-  for (i = 0; i < MAX_TIMERS; i++) {
+  for (i = 0; i < SAFETIMER_RUNTIME_TIMERS; i++) {
     TEST_ASSERT_EQUAL_INT(TIMER_OK, safetimer_stop(handles[i]));
     TEST_ASSERT_EQUAL_INT(TIMER_OK, safetimer_delete(handles[i]));
   }
 
   /* Verify pool is empty */
   safetimer_get_pool_usage(&used_timers, &total_timers);
-  TEST_ASSERT_EQUAL_INT(0, used_timers);
+  TEST_ASSERT_EQUAL_INT(SAFETIMER_STATIC_TIMERS, used_timers);
 
-  printf("[STRESS] ✓ All %d timers handled simultaneously\n", MAX_TIMERS);
+  printf("[STRESS] ✓ All %d timers handled simultaneously\n",
+         SAFETIMER_RUNTIME_TIMERS);
 }
 
 /**
@@ -243,14 +249,14 @@ void test_stress_long_running_timer_10_days(void) {
 void test_stress_rapid_create_delete_without_cleanup(void) {
   const int ITERATIONS = 100;
   int i, j;
-  safetimer_handle_t handles[MAX_TIMERS];
+  safetimer_handle_t handles[SAFETIMER_RUNTIME_TIMERS];
   int total_timers, used_timers;
 
   printf("\n[STRESS] Testing pool fragmentation resistance...\n");
 
   for (i = 0; i < ITERATIONS; i++) {
     /* Fill pool */
-    for (j = 0; j < MAX_TIMERS; j++) {
+    for (j = 0; j < SAFETIMER_RUNTIME_TIMERS; j++) {
       handles[j] = safetimer_create(100, TIMER_MODE_ONE_SHOT, NULL, NULL);
       TEST_ASSERT_NOT_EQUAL(SAFETIMER_INVALID_HANDLE, handles[j]);
     }
@@ -260,14 +266,15 @@ void test_stress_rapid_create_delete_without_cleanup(void) {
     TEST_ASSERT_EQUAL_INT(MAX_TIMERS, used_timers);
 
     /* Delete in random order (middle-out pattern) */
-    for (j = 0; j < MAX_TIMERS; j++) {
-      int index = (j % 2 == 0) ? (j / 2) : (MAX_TIMERS - 1 - j / 2);
+    for (j = 0; j < SAFETIMER_RUNTIME_TIMERS; j++) {
+      int index =
+          (j % 2 == 0) ? (j / 2) : (SAFETIMER_RUNTIME_TIMERS - 1 - j / 2);
       TEST_ASSERT_EQUAL_INT(TIMER_OK, safetimer_delete(handles[index]));
     }
 
     /* Verify pool is empty */
     safetimer_get_pool_usage(&used_timers, &total_timers);
-    TEST_ASSERT_EQUAL_INT(0, used_timers);
+    TEST_ASSERT_EQUAL_INT(SAFETIMER_STATIC_TIMERS, used_timers);
 
     if ((i + 1) % 20 == 0) {
       printf("  Completed %d/%d iterations\n", i + 1, ITERATIONS);
@@ -320,7 +327,7 @@ void test_stress_memory_leak_detection(void) {
 
     /* Verify pool is clean */
     safetimer_get_pool_usage(&used_timers, &total_timers);
-    TEST_ASSERT_EQUAL_INT(0, used_timers);
+    TEST_ASSERT_EQUAL_INT(SAFETIMER_STATIC_TIMERS, used_timers);
 
     if ((i + 1) % 100 == 0) {
       printf("  Completed %d/%d iterations - no leaks\n", i + 1, ITERATIONS);
@@ -387,6 +394,10 @@ void test_stress_multiple_timers_different_periods_long_run(void) {
   const uint32_t RUNTIME_MS = 60000; /* 1 minute */
   uint32_t elapsed;
 
+  if (SAFETIMER_COMPACT_SLOTS == 2) {
+    TEST_IGNORE_MESSAGE("Requires user_data (SAFETIMER_COMPACT_SLOTS=2)");
+  }
+
   printf("\n[STRESS] Multiple timers over 60 seconds...\n");
 
   /* Create timers with different periods */
@@ -0,0 +1,198 @@
+/**
+ * @file    test_safetimer_tick_unit.c
+ * @brief   Unit tests for the tick unit and the hardware compare path
+ * @version 1.0.0
+ * @date    2026-10-14
+ *
+ * Tests the SAFETIMER_TICK_US conversion macros and period limits (any
+ * tick unit), and (SAFETIMER_ENABLE_HW_COMPARE) that the Mock BSP compare
+ * register always holds the earliest running deadline.
+ */
+
+#include "mock_bsp.h"
+#include "safetimer.h"
+#include "unity.h"
+
+/* External test helper from safetimer.c */
+#ifdef UNIT_TEST
+extern void safetimer_test_reset_pool(void);
+#endif
+
+/* ========== Test Data ========== */
+
+static int g_unit_fired = 0;
+
+static void unit_callback(void *user_data) {
+  (void)user_data;
+  g_unit_fired++;
+}
+
+/* ========== Test Cases ========== */
+
+/**
+ * Test: SAFETIMER_US_TO_TICKS / SAFETIMER_MS_TO_TICKS
+ * Verify: smallest tick count covering the duration (never early)
+ */
+void test_tick_unit_conversion_rounds_up(void) {
+  uint32_t t;
+
+  t = SAFETIMER_MS_TO_TICKS(1);
+  TEST_ASSERT_TRUE(t * SAFETIMER_TICK_US >= 1000UL);
+  TEST_ASSERT_TRUE((t - 1U) * SAFETIMER_TICK_US < 1000UL);
+
+  t = SAFETIMER_US_TO_TICKS(250);
+  TEST_ASSERT_TRUE(t * SAFETIMER_TICK_US >= 250UL);
+  TEST_ASSERT_TRUE((t - 1U) * SAFETIMER_TICK_US < 250UL);
+
+  TEST_ASSERT_EQUAL_UINT32(SAFETIMER_US_TO_TICKS(3000UL),
+                           SAFETIMER_MS_TO_TICKS(3));
+
+#if SAFETIMER_TICK_US == 1000
+  TEST_ASSERT_EQUAL_UINT32(5, SAFETIMER_MS_TO_TICKS(5));
+  TEST_ASSERT_EQUAL_UINT32(1, SAFETIMER_US_TO_TICKS(250));
+#elif SAFETIMER_TICK_US == 10
+  TEST_ASSERT_EQUAL_UINT32(500, SAFETIMER_MS_TO_TICKS(5));
+  TEST_ASSERT_EQUAL_UINT32(25, SAFETIMER_US_TO_TICKS(250));
+#endif
+}
+
+/**
+ * Test: periods at and beyond SAFETIMER_MAX_PERIOD
+ * Verify: limit accepted, limit + 1 rejected by create and set_period
+ */
+void test_tick_unit_period_limit(void) {
+#if ENABLE_PARAM_CHECK
+  safetimer_handle_t h;
+
+  h = safetimer_create(SAFETIMER_MAX_PERIOD, TIMER_MODE_ONE_SHOT, NULL,
+                       NULL);
+  TEST_ASSERT_NOT_EQUAL(SAFETIMER_INVALID_HANDLE, h);
+  TEST_ASSERT_EQUAL(TIMER_ERR_INVALID,
+                    safetimer_set_period(h, SAFETIMER_MAX_PERIOD + 1UL));
+  TEST_ASSERT_EQUAL(SAFETIMER_INVALID_HANDLE,
+                    safetimer_create(SAFETIMER_MAX_PERIOD + 1UL,
+                                     TIMER_MODE_ONE_SHOT, NULL, NULL));
+#else
+  TEST_IGNORE_MESSAGE("Requires ENABLE_PARAM_CHECK=1");
+#endif
+}
+
+/**
+ * Test: REPEAT timer of 250 us in the configured tick unit
+ * Verify: fires on the first tick covering 250 us, then every period
+ */
+void test_tick_unit_sub_ms_period(void) {
+  safetimer_handle_t h;
+  bsp_tick_t period = (bsp_tick_t)SAFETIMER_US_TO_TICKS(250);
+
+  if (!SAFETIMER_PERIOD_FITS(SAFETIMER_US_TO_TICKS(250))) {
+    TEST_IGNORE_MESSAGE("Period not accepted by this slot layout");
+  }
+
+  g_unit_fired = 0;
+  h = safetimer_create(period, TIMER_MODE_REPEAT, unit_callback, NULL);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+
+  mock_bsp_set_ticks((bsp_tick_t)(period - 1U));
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(0, g_unit_fired);
+
+  mock_bsp_set_ticks(period);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(1, g_unit_fired);
+
+  mock_bsp_set_ticks((bsp_tick_t)(2U * period));
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(2, g_unit_fired);
+}
+
+#if SAFETIMER_ENABLE_HW_COMPARE
+/**
+ * Test: ONE_SHOT timers started at tick 100 (50, 20, 500 ticks)
+ * Verify: compare moved only by an earlier deadline, re-programmed to the
+ *         next deadline by each pass
+ */
+void test_hw_compare_tracks_earliest(void) {
+  safetimer_handle_t a, b, c;
+
+  g_unit_fired = 0;
+  a = safetimer_create(50, TIMER_MODE_ONE_SHOT, unit_callback, NULL);
+  b = safetimer_create(20, TIMER_MODE_ONE_SHOT, unit_callback, NULL);
+  c = safetimer_create(500, TIMER_MODE_ONE_SHOT, unit_callback, NULL);
+  mock_bsp_set_ticks(100);
+
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(a));
+  TEST_ASSERT_EQUAL_UINT32(150, mock_bsp_get_compare());
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(b));
+  TEST_ASSERT_EQUAL_UINT32(120, mock_bsp_get_compare());
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(c));
+  TEST_ASSERT_EQUAL_UINT32(2, mock_bsp_get_compare_count());
+
+  mock_bsp_set_ticks(120); /* Compare match */
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(1, g_unit_fired);
+  TEST_ASSERT_EQUAL_UINT32(150, mock_bsp_get_compare());
+
+  mock_bsp_set_ticks(150);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(2, g_unit_fired);
+  TEST_ASSERT_EQUAL_UINT32(600, mock_bsp_get_compare());
+}
+
+/**
+ * Test: earliest timer stopped
+ * Verify: heap engine moves the compare at once; bitmap engine takes the
+ *         stale match, and that empty pass re-programs the remaining
+ *         deadline
+ */
+void test_hw_compare_stale_deadline(void) {
+  safetimer_handle_t a, b;
+
+  g_unit_fired = 0;
+  a = safetimer_create(50, TIMER_MODE_ONE_SHOT, unit_callback, NULL);
+  b = safetimer_create(80, TIMER_MODE_ONE_SHOT, unit_callback, NULL);
+  mock_bsp_set_ticks(100);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(a));
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(b));
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_stop(a));
+#if SAFETIMER_ENGINE == SAFETIMER_ENGINE_HEAP
+  TEST_ASSERT_EQUAL_UINT32(180, mock_bsp_get_compare());
+#else
+  TEST_ASSERT_EQUAL_UINT32(150, mock_bsp_get_compare());
+#endif
+
+  mock_bsp_set_ticks(150);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(0, g_unit_fired);
+  TEST_ASSERT_EQUAL_UINT32(180, mock_bsp_get_compare());
+}
+
+/**
+ * Test: REPEAT timer (10 ticks) triggered, then stopped
+ * Verify: trigger programs the current tick, periodic re-arm follows the
+ *         period, nothing programmed once no timer runs
+ */
+void test_hw_compare_trigger_and_idle(void) {
+  safetimer_handle_t h;
+  unsigned long calls;
+
+  g_unit_fired = 0;
+  h = safetimer_create(10, TIMER_MODE_REPEAT, unit_callback, NULL);
+  mock_bsp_set_ticks(100);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+  TEST_ASSERT_EQUAL_UINT32(110, mock_bsp_get_compare());
+
+  mock_bsp_set_ticks(105);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_trigger(h));
+  TEST_ASSERT_EQUAL_UINT32(105, mock_bsp_get_compare());
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(1, g_unit_fired);
+  TEST_ASSERT_EQUAL_UINT32(115, mock_bsp_get_compare());
+
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_stop(h));
+  calls = mock_bsp_get_compare_count();
+  mock_bsp_set_ticks(115);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_UINT32(calls, mock_bsp_get_compare_count());
+}
+#endif /* SAFETIMER_ENABLE_HW_COMPARE */
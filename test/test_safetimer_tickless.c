@@ -0,0 +1,123 @@
+/**
+ * @file    test_safetimer_tickless.c
+ * @brief   Unit tests for the tickless BSP mode (SAFETIMER_BSP_TICKLESS)
+ * @version 1.0.0
+ * @date    2026-10-14
+ *
+ * Tests that safetimer_tickless_arm() programs the earliest deadline into
+ * the Mock BSP compare register, and that a pass after a long sleep handles
+ * the jump at once, with a cost independent of the slept ticks.
+ */
+
+#include "mock_bsp.h"
+#include "safetimer.h"
+#include "unity.h"
+
+/* External test helper from safetimer.c */
+#ifdef UNIT_TEST
+extern void safetimer_test_reset_pool(void);
+#endif
+
+#if SAFETIMER_BSP_TICKLESS
+
+/* ========== Test Data ========== */
+
+static int g_tickless_fired[2];
+
+static void tickless_callback(void *user_data) {
+  int *counter = (int *)user_data;
+  (*counter)++;
+}
+
+/* Two ONE_SHOT timers (300/7000 ms) started at tick 0, first pass run */
+static void tickless_setup(void) {
+  safetimer_handle_t h;
+
+  if (!SAFETIMER_PERIOD_FITS(300UL) || !SAFETIMER_PERIOD_FITS(7000UL)) {
+    TEST_IGNORE_MESSAGE("Period not accepted by this slot layout");
+  }
+  g_tickless_fired[0] = 0;
+  g_tickless_fired[1] = 0;
+  h = safetimer_create(300, TIMER_MODE_ONE_SHOT, tickless_callback,
+                       &g_tickless_fired[0]);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+  h = safetimer_create(7000, TIMER_MODE_ONE_SHOT, tickless_callback,
+                       &g_tickless_fired[1]);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+  safetimer_process();
+}
+
+/* Sleep jump of 'ticks', one pass; returns the pass's critical sections */
+static unsigned long tickless_wake(bsp_tick_t ticks) {
+  mock_bsp_stats_t stats;
+
+  mock_bsp_advance_time(ticks);
+  mock_bsp_reset_stats();
+  safetimer_process();
+  mock_bsp_get_stats(&stats);
+  return stats.enter_critical_count;
+}
+
+/* ========== Test Cases ========== */
+
+/**
+ * Test: arm, sleep exactly until each deadline, wake
+ * Verify: each deadline programmed in turn, one pass fires it, then the
+ *         idle value once no timer is running
+ */
+void test_tickless_arm_programs_next_deadline(void) {
+  tickless_setup();
+
+  TEST_ASSERT_EQUAL_UINT32(300, safetimer_tickless_arm());
+  TEST_ASSERT_EQUAL_UINT32(300, mock_bsp_get_wakeup());
+
+  (void)tickless_wake(300);
+  TEST_ASSERT_EQUAL_INT(1, g_tickless_fired[0]);
+  TEST_ASSERT_EQUAL_UINT32(6700, safetimer_tickless_arm());
+  TEST_ASSERT_EQUAL_UINT32(6700, mock_bsp_get_wakeup());
+
+  (void)tickless_wake(6700);
+  TEST_ASSERT_EQUAL_INT(1, g_tickless_fired[1]);
+  TEST_ASSERT_EQUAL_UINT32(SAFETIMER_NO_EXPIRY, safetimer_tickless_arm());
+  TEST_ASSERT_EQUAL_UINT32(SAFETIMER_NO_EXPIRY, mock_bsp_get_wakeup());
+}
+
+/**
+ * Test: arm while a timer is already due
+ * Verify: returns 0, compare register left untouched
+ */
+void test_tickless_arm_due_programs_nothing(void) {
+  tickless_setup();
+
+  mock_bsp_set_ticks(400);
+  TEST_ASSERT_EQUAL_UINT32(0, safetimer_tickless_arm());
+  TEST_ASSERT_EQUAL_UINT32(0, mock_bsp_get_wakeup());
+}
+
+/**
+ * Test: overslept both deadlines (woken by another interrupt)
+ * Verify: one pass fires both, and costs the same for a 7500 or a 20000
+ *         tick jump (no per-tick work)
+ */
+void test_tickless_large_jump_one_pass(void) {
+  unsigned long crit_short;
+  unsigned long crit_long;
+
+  tickless_setup();
+  crit_short = tickless_wake(7500);
+  TEST_ASSERT_EQUAL_INT(1, g_tickless_fired[0]);
+  TEST_ASSERT_EQUAL_INT(1, g_tickless_fired[1]);
+
+  safetimer_test_reset_pool();
+  mock_bsp_reset();
+  tickless_setup();
+  crit_long = tickless_wake(20000);
+  TEST_ASSERT_EQUAL_INT(1, g_tickless_fired[0]);
+  TEST_ASSERT_EQUAL_INT(1, g_tickless_fired[1]);
+
+  TEST_ASSERT_EQUAL_UINT32(crit_short, crit_long);
+  TEST_ASSERT_TRUE(crit_long < 4UL * MAX_TIMERS + 16UL);
+  TEST_ASSERT_EQUAL_UINT32(SAFETIMER_NO_EXPIRY, safetimer_get_next_expiry());
+}
+
+#endif /* SAFETIMER_BSP_TICKLESS */
@@ -0,0 +1,173 @@
+/**
+ * @file    test_safetimer_trace.c
+ * @brief   Unit tests for the binary event trace (SAFETIMER_ENABLE_TRACE)
+ * @version 1.0.0
+ * @date    2026-10-14
+ *
+ * Tests the recorded event sequence, late-fire and skip arguments, ring
+ * overwrite, the record count past 16 bits, and the attach parameter
+ * checks.
+ */
+
+#include "mock_bsp.h"
+#include "safetimer.h"
+#include "unity.h"
+
+/* External test helper from safetimer.c */
+#ifdef UNIT_TEST
+extern void safetimer_test_reset_pool(void);
+#endif
+
+#if SAFETIMER_ENABLE_TRACE
+
+#define TRACE_TEST_CAPACITY 16
+
+/* ========== Test Data ========== */
+
+static safetimer_trace_record_t g_trace[TRACE_TEST_CAPACITY];
+
+static void trace_empty_callback(void *user_data) { (void)user_data; }
+
+static void trace_assert_record(uint16_t index, uint8_t event,
+                                safetimer_handle_t handle, uint32_t tick,
+                                uint8_t arg) {
+  const safetimer_trace_record_t *rec = &g_trace[index];
+
+  TEST_ASSERT_EQUAL_UINT8(event, rec->event);
+  TEST_ASSERT_EQUAL_UINT16((uint16_t)handle, rec->handle);
+  TEST_ASSERT_EQUAL_UINT32(tick, (uint32_t)rec->tick);
+  TEST_ASSERT_EQUAL_UINT8(arg, rec->arg);
+}
+
+/* ========== Test Cases ========== */
+
+/**
+ * Test: create, start, fire on time, stop, delete a REPEAT timer
+ * Verify: one record per event, with tick and handle
+ */
+void test_trace_event_sequence(void) {
+  safetimer_handle_t h;
+
+  TEST_ASSERT_EQUAL(TIMER_OK,
+                    safetimer_trace_attach(g_trace, TRACE_TEST_CAPACITY));
+
+  mock_bsp_set_ticks(5);
+  h = safetimer_create(100, TIMER_MODE_REPEAT, trace_empty_callback, NULL);
+  TEST_ASSERT_NOT_EQUAL(SAFETIMER_INVALID_HANDLE, h);
+  mock_bsp_set_ticks(10);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+
+  mock_bsp_set_ticks(110);
+  safetimer_process();
+
+  mock_bsp_set_ticks(150);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_stop(h));
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_delete(h));
+  safetimer_process(); /* Applies queued commands with the ISR queue */
+
+  TEST_ASSERT_EQUAL_UINT16(5, safetimer_trace_count());
+  trace_assert_record(0, SAFETIMER_TRACE_CREATE, h, 5, 0);
+  trace_assert_record(1, SAFETIMER_TRACE_START, h, 10, 0);
+  trace_assert_record(2, SAFETIMER_TRACE_FIRE, h, 110, 0);
+  trace_assert_record(3, SAFETIMER_TRACE_STOP, h, 150, 0);
+  trace_assert_record(4, SAFETIMER_TRACE_DELETE, h, 150, 0);
+}
+
+/**
+ * Test: REPEAT timer processed 30 ms late, then 1200 ms late
+ * Verify: LATE_FIRE carries the lateness, SKIP the coalesced periods
+ *         (skip mode), both saturated at 255
+ */
+void test_trace_late_fire_and_skip(void) {
+  safetimer_handle_t h;
+
+  h = safetimer_create(100, TIMER_MODE_REPEAT, trace_empty_callback, NULL);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+  TEST_ASSERT_EQUAL(TIMER_OK,
+                    safetimer_trace_attach(g_trace, TRACE_TEST_CAPACITY));
+
+  mock_bsp_set_ticks(130);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_UINT16(1, safetimer_trace_count());
+  trace_assert_record(0, SAFETIMER_TRACE_LATE_FIRE, h, 130, 30);
+
+#if SAFETIMER_ENABLE_CATCHUP != SAFETIMER_CATCHUP_BURST
+  mock_bsp_set_ticks(1400); /* Due at 200: periods 300~1400 coalesced */
+  safetimer_process();
+  TEST_ASSERT_EQUAL_UINT16(3, safetimer_trace_count());
+  trace_assert_record(1, SAFETIMER_TRACE_LATE_FIRE, h, 1400, 255);
+  trace_assert_record(2, SAFETIMER_TRACE_SKIP, h, 1400, 12);
+#endif
+}
+
+/**
+ * Test: 3 timers created and started into a 4-record ring
+ * Verify: oldest records overwritten, count keeps the total
+ */
+void test_trace_ring_overwrite(void) {
+  safetimer_handle_t h[3];
+  int i;
+
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_trace_attach(g_trace, 4));
+  for (i = 0; i < 3; i++) {
+    mock_bsp_set_ticks((bsp_tick_t)(i * 10));
+    h[i] = safetimer_create(100, TIMER_MODE_ONE_SHOT, trace_empty_callback,
+                            NULL);
+    TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h[i]));
+  }
+
+  TEST_ASSERT_EQUAL_UINT16(6, safetimer_trace_count());
+  trace_assert_record(0, SAFETIMER_TRACE_CREATE, h[2], 20, 0); /* #4 */
+  trace_assert_record(1, SAFETIMER_TRACE_START, h[2], 20, 0);  /* #5 */
+  trace_assert_record(2, SAFETIMER_TRACE_CREATE, h[1], 10, 0); /* #2 */
+  trace_assert_record(3, SAFETIMER_TRACE_START, h[1], 10, 0);  /* #3 */
+}
+
+/**
+ * Test: 65541 records (create + 65540 restarts, tick = restart number)
+ *       into a 16-record ring
+ * Verify: count past 65536 still reports a wrapped ring (16 + 5, not 5),
+ *         newest record at (count - 1) % 16, oldest at count % 16
+ */
+void test_trace_count_past_16_bits(void) {
+  safetimer_handle_t h;
+  uint32_t i;
+  uint16_t count;
+
+  TEST_ASSERT_EQUAL(TIMER_OK,
+                    safetimer_trace_attach(g_trace, TRACE_TEST_CAPACITY));
+  h = safetimer_create(100, TIMER_MODE_ONE_SHOT, trace_empty_callback, NULL);
+  for (i = 0; i < 65540UL; i++) {
+    mock_bsp_set_ticks((bsp_tick_t)i);
+    TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+  }
+
+  count = safetimer_trace_count();
+  TEST_ASSERT_EQUAL_UINT16(TRACE_TEST_CAPACITY + 5, count);
+  trace_assert_record((uint16_t)((count - 1U) % TRACE_TEST_CAPACITY),
+                      SAFETIMER_TRACE_START, h,
+                      (uint32_t)(bsp_tick_t)65539UL, 0);
+  trace_assert_record((uint16_t)(count % TRACE_TEST_CAPACITY),
+                      SAFETIMER_TRACE_START, h,
+                      (uint32_t)(bsp_tick_t)65524UL, 0);
+}
+
+/**
+ * Test: invalid capacities and detach
+ * Verify: rejected without changing the ring, nothing recorded detached
+ */
+void test_trace_attach_rules(void) {
+  TEST_ASSERT_EQUAL(TIMER_ERR_INVALID, safetimer_trace_attach(g_trace, 0));
+  TEST_ASSERT_EQUAL(TIMER_ERR_INVALID, safetimer_trace_attach(g_trace, 1));
+  TEST_ASSERT_EQUAL(TIMER_ERR_INVALID, safetimer_trace_attach(g_trace, 12));
+
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_trace_attach(g_trace, 2));
+  (void)safetimer_create(100, TIMER_MODE_REPEAT, trace_empty_callback, NULL);
+  TEST_ASSERT_EQUAL_UINT16(1, safetimer_trace_count());
+
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_trace_attach(NULL, 0));
+  (void)safetimer_create(100, TIMER_MODE_REPEAT, trace_empty_callback, NULL);
+  TEST_ASSERT_EQUAL_UINT16(0, safetimer_trace_count());
+}
+
+#endif /* SAFETIMER_ENABLE_TRACE */
@@ -0,0 +1,308 @@
+/**
+ * @file    test_safetimer_trigger.c
+ * @brief   Unit tests for safetimer_trigger() and event-driven semaphores
+ * @version 1.0.0
+ * @date    2026-10-14
+ *
+ * Tests that a triggered timer fires on the next pass and keeps its
+ * period, and (SAFETIMER_ENABLE_SEM_WAKE) that a signaled semaphore
+ * resumes its waiting coroutine without polling.
+ */
+
+#include "mock_bsp.h"
+#include "safetimer.h"
+#include "unity.h"
+#if SAFETIMER_ENABLE_SEM_WAKE
+#include "safetimer_coro.h"
+#include "safetimer_sem.h"
+#endif
+
+/* External test helper from safetimer.c */
+#ifdef UNIT_TEST
+extern void safetimer_test_reset_pool(void);
+#endif
+
+/* ========== Test Data ========== */
+
+static int g_trigger_fired = 0;
+
+static void trigger_callback(void *user_data) {
+  (void)user_data;
+  g_trigger_fired++;
+}
+
+/* ========== Test Cases ========== */
+
+/**
+ * Test: REPEAT timer (1000 ms) triggered at tick 10
+ * Verify: fires on the next pass, next deadline one period later
+ */
+void test_trigger_fires_running_timer(void) {
+  safetimer_handle_t h;
+
+  g_trigger_fired = 0;
+  h = safetimer_create(1000, TIMER_MODE_REPEAT, trigger_callback, NULL);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+
+  mock_bsp_set_ticks(10);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_trigger(h));
+  TEST_ASSERT_EQUAL_UINT32(0, safetimer_get_next_expiry());
+
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(1, g_trigger_fired);
+  TEST_ASSERT_EQUAL_UINT32(1000, safetimer_get_next_expiry());
+
+  /* Original deadline (1000) replaced, not added to */
+  mock_bsp_set_ticks(1000);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(1, g_trigger_fired);
+  mock_bsp_set_ticks(1010);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(2, g_trigger_fired);
+}
+
+/**
+ * Test: trigger a stopped ONE_SHOT timer
+ * Verify: started and fired once, then stopped again
+ */
+void test_trigger_starts_stopped_timer(void) {
+  safetimer_handle_t h;
+  int running = 0;
+
+  g_trigger_fired = 0;
+  h = safetimer_create(100, TIMER_MODE_ONE_SHOT, trigger_callback, NULL);
+
+  mock_bsp_set_ticks(5);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_trigger(h));
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_get_status(h, &running));
+  TEST_ASSERT_EQUAL_INT(1, running);
+
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(1, g_trigger_fired);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_get_status(h, &running));
+  TEST_ASSERT_EQUAL_INT(0, running);
+
+  mock_bsp_set_ticks(200);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(1, g_trigger_fired);
+  TEST_ASSERT_EQUAL_UINT32(SAFETIMER_NO_EXPIRY, safetimer_get_next_expiry());
+}
+
+/**
+ * Test: trigger with invalid and deleted handles
+ * Verify: TIMER_ERR_INVALID, no timer fires
+ */
+void test_trigger_invalid_handle(void) {
+#if ENABLE_PARAM_CHECK
+  safetimer_handle_t h;
+
+  g_trigger_fired = 0;
+  TEST_ASSERT_EQUAL(TIMER_ERR_INVALID,
+                    safetimer_trigger(SAFETIMER_INVALID_HANDLE));
+
+  h = safetimer_create(100, TIMER_MODE_ONE_SHOT, trigger_callback, NULL);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_delete(h));
+  TEST_ASSERT_EQUAL(TIMER_ERR_INVALID, safetimer_trigger(h));
+
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(0, g_trigger_fired);
+#else
+  TEST_IGNORE_MESSAGE("Requires ENABLE_PARAM_CHECK=1");
+#endif
+}
+
+#if SAFETIMER_ENABLE_ISR_QUEUE
+/**
+ * Test: trigger queued from an ISR
+ * Verify: no critical section in the ISR, fired by the pass applying it
+ */
+void test_trigger_from_isr(void) {
+  mock_bsp_stats_t stats;
+  safetimer_handle_t h;
+
+  g_trigger_fired = 0;
+  h = safetimer_create(1000, TIMER_MODE_REPEAT, trigger_callback, NULL);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+
+  mock_bsp_set_ticks(20);
+  mock_bsp_reset_stats();
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_trigger_from_isr(h));
+  mock_bsp_get_stats(&stats);
+  TEST_ASSERT_EQUAL_UINT32(0, stats.enter_critical_count);
+
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(1, g_trigger_fired);
+  TEST_ASSERT_EQUAL_UINT32(1000, safetimer_get_next_expiry());
+}
+#endif
+
+#if SAFETIMER_ENABLE_SEM_WAKE
+
+/* ========== Coroutine Under Test ========== */
+
+typedef struct {
+  SAFETIMER_CORO_CONTEXT;
+  int runs;    /* Callback invocations */
+  int resumed; /* Waits completed */
+  int result;  /* Semaphore value seen after the last wait */
+} sem_coro_t;
+
+static volatile safetimer_sem_t g_sem;
+static sem_coro_t g_coro;
+static uint8_t g_forever = 0;
+
+static void sem_coro(void *user_data) {
+  sem_coro_t *ctx = (sem_coro_t *)user_data;
+
+  ctx->runs++;
+  SAFETIMER_CORO_BEGIN(ctx);
+  while (1) {
+    if (g_forever) {
+      SAFETIMER_CORO_WAIT_SEM_FOREVER(g_sem, 500);
+    } else {
+      SAFETIMER_CORO_WAIT_SEM(g_sem, 10, 100); /* 1000 ms timeout */
+    }
+    ctx->result = g_sem;
+    ctx->resumed++;
+    g_sem = 1; /* Consume */
+  }
+  SAFETIMER_CORO_END();
+}
+
+/* Coroutine timer (REPEAT 10 ms) started at 0, waiting after tick 10 */
+static safetimer_handle_t sem_coro_setup(uint8_t forever) {
+  safetimer_handle_t h;
+
+  g_coro._coro_lc = 0;
+  g_coro._coro_handle = 0;
+  g_coro.runs = 0;
+  g_coro.resumed = 0;
+  g_coro.result = 99;
+  g_forever = forever;
+  g_sem = 1; /* Not signaled */
+
+  h = safetimer_create(10, TIMER_MODE_REPEAT, sem_coro, &g_coro);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+  mock_bsp_set_ticks(10);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(1, g_coro.runs);
+  TEST_ASSERT_EQUAL_INT(0, g_coro.resumed);
+  return h;
+}
+
+/**
+ * Test: WAIT_SEM entered at tick 10, signaled at tick 50
+ * Verify: single 1000 ms deadline instead of 10 ms polls, resumed by the
+ *         first pass after the signal
+ */
+void test_sem_wake_resumes_waiter(void) {
+  (void)sem_coro_setup(0);
+  TEST_ASSERT_EQUAL_UINT32(1000, safetimer_get_next_expiry());
+
+  mock_bsp_set_ticks(40); /* Former poll ticks: no invocation */
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(1, g_coro.runs);
+
+  mock_bsp_set_ticks(50);
+  SAFETIMER_SEM_SIGNAL(g_sem);
+  TEST_ASSERT_EQUAL_UINT32(0, safetimer_get_next_expiry());
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(2, g_coro.runs);
+  TEST_ASSERT_EQUAL_INT(1, g_coro.resumed);
+  TEST_ASSERT_EQUAL_INT(0, g_coro.result);
+
+  /* Waiting again: new deadline from tick 50 */
+  TEST_ASSERT_EQUAL_UINT32(1000, safetimer_get_next_expiry());
+}
+
+/**
+ * Test: WAIT_SEM entered at tick 10, never signaled
+ * Verify: resumed once at the 1010 deadline with SAFETIMER_SEM_TIMEOUT,
+ *         a later signal (no waiter) triggers nothing
+ */
+void test_sem_wake_timeout(void) {
+  (void)sem_coro_setup(0);
+
+  mock_bsp_set_ticks(1009);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(1, g_coro.runs);
+
+  mock_bsp_set_ticks(1010);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(2, g_coro.runs);
+  TEST_ASSERT_EQUAL_INT(1, g_coro.resumed);
+  TEST_ASSERT_EQUAL_INT(SAFETIMER_SEM_TIMEOUT, g_coro.result);
+
+  /* Waiting again (until 2010): signal another semaphore, no wake */
+  {
+    static volatile safetimer_sem_t other = 1;
+    SAFETIMER_SEM_SIGNAL(other);
+  }
+  TEST_ASSERT_EQUAL_UINT32(1000, safetimer_get_next_expiry());
+}
+
+/**
+ * Test: WAIT_SEM_FOREVER (500 ms re-check) signaled at tick 30
+ * Verify: resumed by the next pass, not the next re-check
+ */
+void test_sem_wake_forever(void) {
+  (void)sem_coro_setup(1);
+  TEST_ASSERT_EQUAL_UINT32(500, safetimer_get_next_expiry());
+
+  mock_bsp_set_ticks(30);
+  SAFETIMER_SEM_SIGNAL(g_sem);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(2, g_coro.runs);
+  TEST_ASSERT_EQUAL_INT(1, g_coro.resumed);
+  TEST_ASSERT_EQUAL_INT(0, g_coro.result);
+}
+
+#if SAFETIMER_ENABLE_ISR_QUEUE
+/**
+ * Test: WAIT_SEM entered at tick 10, signaled from an ISR at tick 50
+ * Verify: the signal never masks interrupts, the next pass applies the
+ *         queued wake and resumes the waiter
+ */
+void test_sem_wake_from_isr(void) {
+  mock_bsp_stats_t stats;
+
+  (void)sem_coro_setup(0);
+
+  mock_bsp_set_ticks(50);
+  mock_bsp_reset_stats();
+  SAFETIMER_SEM_SIGNAL_FROM_ISR(g_sem);
+  mock_bsp_get_stats(&stats);
+  TEST_ASSERT_EQUAL_UINT32(0, stats.enter_critical_count);
+  TEST_ASSERT_EQUAL_INT(0, g_sem);
+  TEST_ASSERT_EQUAL_UINT32(960, safetimer_get_next_expiry()); /* Queued */
+
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(2, g_coro.runs);
+  TEST_ASSERT_EQUAL_INT(1, g_coro.resumed);
+  TEST_ASSERT_EQUAL_INT(0, g_coro.result);
+  TEST_ASSERT_EQUAL_UINT32(1000, safetimer_get_next_expiry());
+}
+#endif
+
+/**
+ * Test: waiting coroutine timer deleted, slot reused
+ * Verify: signal wakes neither the deleted nor the new timer
+ */
+void test_sem_wake_deleted_waiter(void) {
+  safetimer_handle_t h;
+
+  h = sem_coro_setup(0);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_delete(h));
+
+  g_trigger_fired = 0;
+  h = safetimer_create(1000, TIMER_MODE_ONE_SHOT, trigger_callback, NULL);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+
+  SAFETIMER_SEM_SIGNAL(g_sem);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(0, g_trigger_fired);
+  TEST_ASSERT_EQUAL_INT(1, g_coro.runs);
+  TEST_ASSERT_EQUAL_UINT32(1000, safetimer_get_next_expiry());
+}
+
+#endif /* SAFETIMER_ENABLE_SEM_WAKE */
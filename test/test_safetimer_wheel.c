@@ -0,0 +1,245 @@
+/**
+ * @file    test_safetimer_wheel.c
+ * @brief   Unit tests for the timing wheel engine (SAFETIMER_ENGINE_WHEEL)
+ * @version 1.0.0
+ * @date    2026-10-14
+ *
+ * Behavioral tests run with every engine; pass-cost checks only apply to
+ * the wheel.
+ */
+
+#include "mock_bsp.h"
+#include "safetimer.h"
+#include "unity.h"
+
+/* External test helper from safetimer.c */
+#ifdef UNIT_TEST
+extern void safetimer_test_reset_pool(void);
+#endif
+
+/* Ticks per wheel turn (any value works for the bitmap engine) */
+#if SAFETIMER_ENGINE == SAFETIMER_ENGINE_WHEEL
+#define WHEEL_TEST_TURN SAFETIMER_WHEEL_SIZE
+#else
+#define WHEEL_TEST_TURN 64
+#endif
+
+/* ========== Test Data ========== */
+
+static int g_wheel_fire_count = 0;
+static safetimer_handle_t g_wheel_victim = SAFETIMER_INVALID_HANDLE;
+
+static void wheel_callback(void *user_data) {
+  int *counter = (int *)user_data;
+  if (counter != NULL) {
+    (*counter)++;
+  }
+  g_wheel_fire_count++;
+}
+
+static void wheel_delete_victim_callback(void *user_data) {
+  (void)user_data;
+  g_wheel_fire_count++;
+  safetimer_delete(g_wheel_victim);
+}
+
+/* ========== Test Cases ========== */
+
+/**
+ * Test: deadline several wheel turns away
+ * Verify: sharing a bucket with earlier ticks does not fire early
+ */
+void test_wheel_far_deadline_waits_full_turns(void) {
+  safetimer_handle_t h;
+  uint32_t period = 3U * WHEEL_TEST_TURN + 5U;
+  uint32_t t;
+
+  if (!SAFETIMER_PERIOD_FITS(period)) {
+    TEST_IGNORE_MESSAGE("Period not accepted by this slot layout");
+  }
+
+  g_wheel_fire_count = 0;
+  h = safetimer_create(period, TIMER_MODE_ONE_SHOT, wheel_callback, NULL);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+
+  for (t = 1; t < period; t++) {
+    mock_bsp_set_ticks((bsp_tick_t)t);
+    safetimer_process();
+  }
+  TEST_ASSERT_EQUAL_INT(0, g_wheel_fire_count);
+
+  mock_bsp_set_ticks((bsp_tick_t)period);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(1, g_wheel_fire_count);
+}
+
+/**
+ * Test: full pool of running timers, one tick elapses
+ * Verify: wheel pass cost does not depend on the number of running timers
+ */
+void test_wheel_pass_cost_independent_of_pool(void) {
+  safetimer_handle_t h;
+  mock_bsp_stats_t stats;
+  int i;
+
+  g_wheel_fire_count = 0;
+  for (i = 0; i < SAFETIMER_RUNTIME_TIMERS; i++) {
+    h = safetimer_create(1000, TIMER_MODE_REPEAT, wheel_callback, NULL);
+    TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+  }
+
+  mock_bsp_set_ticks(1);
+  mock_bsp_reset_stats();
+  safetimer_process();
+  mock_bsp_get_stats(&stats);
+
+  TEST_ASSERT_EQUAL_INT(0, g_wheel_fire_count);
+#if SAFETIMER_ENGINE == SAFETIMER_ENGINE_WHEEL
+  /* Fast-path check + one bucket + cache publish */
+  TEST_ASSERT_EQUAL_UINT32(3, stats.enter_critical_count);
+#else
+  (void)stats;
+#endif
+
+  /* Repeat passes drain bounded snapshot batches; nothing fires twice */
+  mock_bsp_set_ticks(1000);
+  for (i = 0; i < SAFETIMER_RUNTIME_TIMERS; i++) {
+    safetimer_process();
+  }
+  TEST_ASSERT_EQUAL_INT(SAFETIMER_RUNTIME_TIMERS, g_wheel_fire_count);
+}
+
+/**
+ * Test: stop and restart move a timer to its new bucket
+ * Verify: fires at the restarted deadline only
+ */
+void test_wheel_restart_relinks_timer(void) {
+  safetimer_handle_t h;
+  int count = 0;
+
+  if (SAFETIMER_COMPACT_SLOTS == 2) {
+    TEST_IGNORE_MESSAGE("Requires user_data (SAFETIMER_COMPACT_SLOTS=2)");
+  }
+
+  h = safetimer_create(50, TIMER_MODE_ONE_SHOT, wheel_callback, &count);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h));
+
+  mock_bsp_set_ticks(20);
+  safetimer_process();
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_stop(h));
+
+  mock_bsp_set_ticks(30);
+  safetimer_process();
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(h)); /* Due at 80 */
+
+  mock_bsp_set_ticks(50);
+  safetimer_process();
+  mock_bsp_set_ticks(79);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(0, count);
+
+  mock_bsp_set_ticks(80);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(1, count);
+}
+
+/**
+ * Test: safetimer_process() not called for more than a wheel turn
+ * Verify: overdue timers fire once, REPEAT stays phase-locked afterwards
+ */
+void test_wheel_lagging_pass_catches_up(void) {
+  safetimer_handle_t fast, slow;
+  int fast_count = 0;
+  int slow_count = 0;
+  uint32_t stall;
+
+  if (!SAFETIMER_PERIOD_FITS(10UL) ||
+      !SAFETIMER_PERIOD_FITS(WHEEL_TEST_TURN + 7UL)) {
+    TEST_IGNORE_MESSAGE("Period not accepted by this slot layout");
+  }
+
+  fast = safetimer_create(10, TIMER_MODE_REPEAT, wheel_callback, &fast_count);
+  slow = safetimer_create(WHEEL_TEST_TURN + 7U, TIMER_MODE_ONE_SHOT,
+                          wheel_callback, &slow_count);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(fast));
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(slow));
+
+  /* Stall for 3 turns */
+  stall = 3U * WHEEL_TEST_TURN + 5U;
+  mock_bsp_set_ticks((bsp_tick_t)stall);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(1, slow_count);
+  TEST_ASSERT_EQUAL_INT(1, fast_count);
+
+#if SAFETIMER_ENABLE_CATCHUP != SAFETIMER_CATCHUP_BURST
+  /* Skip mode: next fast deadline is the next multiple of 10 */
+  mock_bsp_set_ticks((bsp_tick_t)((stall / 10U + 1U) * 10U - 1U));
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(1, fast_count);
+
+  mock_bsp_set_ticks((bsp_tick_t)((stall / 10U + 1U) * 10U));
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(2, fast_count);
+#endif
+}
+
+/**
+ * Test: a callback deletes a timer due in the same tick
+ * Verify: the deleted timer does not fire, its handle is rejected
+ */
+void test_wheel_delete_from_callback(void) {
+  safetimer_handle_t killer;
+  int victim_count = 0;
+
+  if (!SAFETIMER_PERIOD_FITS(WHEEL_TEST_TURN)) {
+    TEST_IGNORE_MESSAGE("Period not accepted by this slot layout");
+  }
+
+  g_wheel_fire_count = 0;
+  killer = safetimer_create(WHEEL_TEST_TURN, TIMER_MODE_ONE_SHOT,
+                            wheel_delete_victim_callback, NULL);
+  g_wheel_victim = safetimer_create(WHEEL_TEST_TURN, TIMER_MODE_REPEAT,
+                                    wheel_callback, &victim_count);
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(killer));
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(g_wheel_victim));
+
+  mock_bsp_set_ticks(WHEEL_TEST_TURN);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(1, g_wheel_fire_count);
+  TEST_ASSERT_EQUAL_INT(0, victim_count);
+
+  mock_bsp_set_ticks(2U * WHEEL_TEST_TURN);
+  safetimer_process();
+  TEST_ASSERT_EQUAL_INT(0, victim_count);
+#if ENABLE_PARAM_CHECK
+  TEST_ASSERT_EQUAL(TIMER_ERR_INVALID, safetimer_start(g_wheel_victim));
+#endif
+}
+
+/**
+ * Test: every slot of the pool gets a distinct, valid handle
+ * Verify: recreating a deleted slot invalidates the old handle (ABA)
+ */
+void test_wheel_full_pool_handles(void) {
+  safetimer_handle_t handles[SAFETIMER_RUNTIME_TIMERS];
+  safetimer_handle_t old_handle, new_handle;
+  int i;
+
+  for (i = 0; i < SAFETIMER_RUNTIME_TIMERS; i++) {
+    handles[i] = safetimer_create(100, TIMER_MODE_REPEAT, NULL, NULL);
+    TEST_ASSERT_NOT_EQUAL(SAFETIMER_INVALID_HANDLE, handles[i]);
+    TEST_ASSERT_TRUE(handles[i] >= 0);
+  }
+  TEST_ASSERT_EQUAL(SAFETIMER_INVALID_HANDLE,
+                    safetimer_create(100, TIMER_MODE_REPEAT, NULL, NULL));
+
+  old_handle = handles[SAFETIMER_RUNTIME_TIMERS - 1];
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_delete(old_handle));
+  new_handle = safetimer_create(100, TIMER_MODE_REPEAT, NULL, NULL);
+  TEST_ASSERT_NOT_EQUAL(SAFETIMER_INVALID_HANDLE, new_handle);
+  TEST_ASSERT_NOT_EQUAL(old_handle, new_handle);
+#if ENABLE_PARAM_CHECK
+  TEST_ASSERT_EQUAL(TIMER_ERR_INVALID, safetimer_start(old_handle));
+#endif
+  TEST_ASSERT_EQUAL(TIMER_OK, safetimer_start(new_handle));
+}